@@ -0,0 +1,15 @@
+TEMPLATE = app
+TARGET = blackjackbench
+
+CONFIG += console c++17 thread
+CONFIG -= qt app_bundle
+
+CONFIG(release, debug|release): QMAKE_CXXFLAGS_RELEASE += -O3
+
+include(BlackjackCore.pri)
+
+HEADERS += \
+    benchmark.h
+
+SOURCES += \
+    benchmarkmain.cpp
@@ -0,0 +1,81 @@
+# Qt-free blackjack model shared by the game and the headless simulator
+
+INCLUDEPATH += $$PWD
+
+SOURCES += \
+    $$PWD/bankrollsimulator.cpp \
+    $$PWD/bettingpolicy.cpp \
+    $$PWD/blockcodec.cpp \
+    $$PWD/botstrategy.cpp \
+    $$PWD/card.cpp \
+    $$PWD/cardcounter.cpp \
+    $$PWD/continuousshuffler.cpp \
+    $$PWD/dealerprobabilities.cpp \
+    $$PWD/deck.cpp \
+    $$PWD/evengine.cpp \
+    $$PWD/gameeventlog.cpp \
+    $$PWD/gamestate.cpp \
+    $$PWD/goldenrun.cpp \
+    $$PWD/handhistoryreader.cpp \
+    $$PWD/handhistorywriter.cpp \
+    $$PWD/hand.cpp \
+    $$PWD/historyreplayer.cpp \
+    $$PWD/montecarlorunner.cpp \
+    $$PWD/playertable.cpp \
+    $$PWD/quantilesketch.cpp \
+    $$PWD/rng.cpp \
+    $$PWD/roundsnapshot.cpp \
+    $$PWD/shoecomposition.cpp \
+    $$PWD/shoepool.cpp \
+    $$PWD/shufflekernel.cpp \
+    $$PWD/simulator.cpp \
+    $$PWD/statistics.cpp \
+    $$PWD/strategychart.cpp \
+    $$PWD/strategygenerator.cpp \
+    $$PWD/tablemirror.cpp \
+    $$PWD/tablerules.cpp \
+    $$PWD/timerwheel.cpp
+
+HEADERS += \
+    $$PWD/bankrollsimulator.h \
+    $$PWD/bettingpolicy.h \
+    $$PWD/blockcodec.h \
+    $$PWD/botstrategy.h \
+    $$PWD/card.h \
+    $$PWD/cardcounter.h \
+    $$PWD/compositioncache.h \
+    $$PWD/continuousshuffler.h \
+    $$PWD/dealerprobabilities.h \
+    $$PWD/deck.h \
+    $$PWD/evengine.h \
+    $$PWD/gameevent.h \
+    $$PWD/gameeventlog.h \
+    $$PWD/gamestate.h \
+    $$PWD/goldenrun.h \
+    $$PWD/hand.h \
+    $$PWD/handhistory.h \
+    $$PWD/handhistoryreader.h \
+    $$PWD/handhistorywriter.h \
+    $$PWD/historyreplayer.h \
+    $$PWD/packedstrategy.h \
+    $$PWD/montecarlorunner.h \
+    $$PWD/player.h \
+    $$PWD/playerStatus.h \
+    $$PWD/playertable.h \
+    $$PWD/quantilesketch.h \
+    $$PWD/rank.h \
+    $$PWD/rng.h \
+    $$PWD/roundsnapshot.h \
+    $$PWD/shoecomposition.h \
+    $$PWD/shoeorder.h \
+    $$PWD/shoepool.h \
+    $$PWD/shufflekernel.h \
+    $$PWD/simulator.h \
+    $$PWD/spscring.h \
+    $$PWD/statistics.h \
+    $$PWD/strategychart.h \
+    $$PWD/strategygenerator.h \
+    $$PWD/suits.h \
+    $$PWD/tablemirror.h \
+    $$PWD/tablerules.h \
+    $$PWD/timerwheel.h
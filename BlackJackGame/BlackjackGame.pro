@@ -6,6 +6,8 @@ CONFIG += c++17
 
 DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
+include(BlackjackCore.pri)
+
 SOURCES += \
     Box2D/Collision/Shapes/b2ChainShape.cpp \
     Box2D/Collision/Shapes/b2CircleShape.cpp \
@@ -53,18 +55,13 @@ SOURCES += \
     Box2D/Dynamics/b2World.cpp \
     Box2D/Dynamics/b2WorldCallbacks.cpp \
     Box2D/Rope/b2Rope.cpp \
-    botstrategy.cpp \
     box2dbase.cpp \
-    card.cpp \
+    cardimages.cpp \
     controller.cpp \
-    deck.cpp \
-    gamestate.cpp \
-    hand.cpp \
     main.cpp \
     mainwindow.cpp \
     playerinfoview.cpp \
     screens.cpp \
-    statistics.cpp \
     tableview.cpp \
     timermanager.cpp \
     tutorialpopup.cpp
@@ -117,23 +114,15 @@ HEADERS += \
     Box2D/Dynamics/b2World.h \
     Box2D/Dynamics/b2WorldCallbacks.h \
     Box2D/Rope/b2Rope.h \
-    botstrategy.h \
     box2dbase.h \
-    card.h \
+    cardimages.h \
     controller.h \
-    deck.h \
-    gamestate.h \
-    hand.h \
     mainwindow.h \
-    player.h \
-    playerStatus.h \
     playerinfoview.h \
-    rank.h \
     screens.h \
-    statistics.h \
-    suits.h \
     tableview.h \
     timermanager.h \
+    timescale.h \
     tutorialpopup.h
 
 FORMS += \
@@ -0,0 +1,22 @@
+TEMPLATE = app
+TARGET = blackjackload
+
+CONFIG += console c++17 thread
+CONFIG -= qt app_bundle
+
+CONFIG(release, debug|release): QMAKE_CXXFLAGS_RELEASE += -O3
+
+include(BlackjackCore.pri)
+
+# Plays against blackjackserver over epoll, so this target is Linux only
+
+HEADERS += \
+    loadgenerator.h \
+    servertable.h \
+    tableprotocol.h
+
+SOURCES += \
+    loadgenerator.cpp \
+    loadgeneratormain.cpp \
+    servertable.cpp \
+    tableprotocol.cpp
@@ -0,0 +1,28 @@
+TEMPLATE = app
+TARGET = blackjackserver
+
+CONFIG += console c++17 thread
+CONFIG -= qt app_bundle
+
+CONFIG(release, debug|release): QMAKE_CXXFLAGS_RELEASE += -O3
+
+include(BlackjackCore.pri)
+
+# The socket server runs on epoll, so this target is Linux only
+
+HEADERS += \
+    loopbackclient.h \
+    servertable.h \
+    socketserver.h \
+    tableprotocol.h \
+    tableserver.h \
+    workstealingpool.h
+
+SOURCES += \
+    loopbackclient.cpp \
+    servertable.cpp \
+    socketserver.cpp \
+    tableprotocol.cpp \
+    tableserver.cpp \
+    tableservermain.cpp \
+    workstealingpool.cpp
@@ -0,0 +1,16 @@
+TEMPLATE = app
+TARGET = blackjacksim
+
+CONFIG += console c++17 thread
+CONFIG -= qt app_bundle
+
+# The simulator is only useful with optimizations on
+CONFIG(release, debug|release): QMAKE_CXXFLAGS_RELEASE += -O3
+
+include(BlackjackCore.pri)
+
+# The golden runs blackjacksim --golden checks. Write them again with --golden-write after a change meant to alter play
+DEFINES += GOLDEN_FILE=\\\"$$PWD/golden/bankrolls.txt\\\"
+
+SOURCES += \
+    simulatormain.cpp
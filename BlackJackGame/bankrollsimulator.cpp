@@ -0,0 +1,215 @@
+/**
+ * @brief Implementation of The BankrollSimulator class. It estimates the risk of ruin and how a bankroll moves,
+ * by playing sessions across several threads and from Brownian motion approximations
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/10/2025
+ */
+
+#include "bankrollsimulator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+using PlayerStatus::PLAYERSTATUS;
+
+/**
+ * @brief normalCdf Gets the chance a standard normal is at or below a value
+ * @param x The value
+ * @return The cumulative probability
+ */
+static double normalCdf(double x)
+{
+    return 0.5 * std::erfc(-x / std::sqrt(2.0));
+}
+
+/**
+ * @brief normalDensity Gets the standard normal density at a value
+ * @param x The value
+ * @return The density
+ */
+static double normalDensity(double x)
+{
+    return std::exp(-0.5 * x * x) / std::sqrt(2 * M_PI);
+}
+
+void BankrollResult::merge(const BankrollResult &other)
+{
+    sessions += other.sessions;
+    ruined += other.ruined;
+    play.merge(other.play);
+    ruinRounds.merge(other.ruinRounds);
+    finalMoney.merge(other.finalMoney);
+
+    if (trajectory.size() < other.trajectory.size())
+    {
+        checkpoints = other.checkpoints;
+        trajectory.resize(other.trajectory.size());
+    }
+    for (std::size_t i = 0; i < other.trajectory.size(); i++)
+        trajectory[i].merge(other.trajectory[i]);
+}
+
+double BankrollResult::riskOfRuin() const
+{
+    return sessions > 0 ? static_cast<double>(ruined) / sessions : 0;
+}
+
+double BankrollResult::riskOfRuinError() const
+{
+    if (sessions == 0)
+        return 0;
+    double risk = riskOfRuin();
+    return std::sqrt(risk * (1 - risk) / sessions);
+}
+
+BankrollSimulator::BankrollSimulator(const TableRules &rules, const BettingPolicy &policy, int startingMoney, unsigned int threadCount, uint64_t masterSeed, BACKEND backend)
+    : rules(rules), policy(policy), startingMoney(startingMoney), threadCount(threadCount), masterSeed(masterSeed), backend(backend), useChart(false)
+{
+    if (this->threadCount == 0)
+        this->threadCount = std::max(1u, std::thread::hardware_concurrency());
+}
+
+BankrollResult BankrollSimulator::run(long long sessions, long long rounds) const
+{
+    BankrollResult empty;
+    for (int i = 1; i <= checkpointCount; i++)
+        empty.checkpoints.push_back(std::max(1LL, rounds * i / checkpointCount));
+    empty.trajectory.resize(checkpointCount);
+
+    std::vector<BankrollResult> results(threadCount, empty);
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int i = 0; i < threadCount; i++)
+    {
+        // Split the sessions evenly, the first threads take the remainder
+        long long share = sessions / threadCount + (i < sessions % threadCount ? 1 : 0);
+        workers.emplace_back([this, i, share, rounds, &results]()
+                             { playSessions(i, share, rounds, results[i]); });
+    }
+
+    for (std::thread &worker : workers)
+        worker.join();
+
+    // Merge in thread order so the result only depends on the seed and thread count
+    BankrollResult merged = empty;
+    for (const BankrollResult &result : results)
+        merged.merge(result);
+
+    merged.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return merged;
+}
+
+void BankrollSimulator::playSessions(unsigned int threadIndex, long long sessions, long long rounds, BankrollResult &result) const
+{
+    // Each thread draws its sessions' seeds from its own stream
+    Rng seeds = Rng::stream(masterSeed, threadIndex);
+    Simulator simulator(1, rules, policy.amount, Rng(0), backend);
+    simulator.setBettingPolicy(policy);
+    if (useChart)
+        simulator.setChart(chart);
+    const PlayerTable &table = simulator.getPlayerTable();
+
+    for (long long session = 0; session < sessions; session++)
+    {
+        simulator.startSession(startingMoney, seeds());
+
+        std::size_t checkpoint = 0;
+        long long round = 0;
+        while (round < rounds && table.status(0) != PLAYERSTATUS::BANKRUPT)
+        {
+            simulator.playRound(result.play);
+            round++;
+            if (checkpoint < result.checkpoints.size() && round == result.checkpoints[checkpoint])
+                result.trajectory[checkpoint++].add(table.money(0));
+        }
+
+        // A bankrupt seat has nothing at every checkpoint it didn't reach
+        bool bankrupt = table.status(0) == PLAYERSTATUS::BANKRUPT;
+        if (bankrupt)
+        {
+            result.ruined++;
+            result.ruinRounds.add(round);
+            for (; checkpoint < result.trajectory.size(); checkpoint++)
+                result.trajectory[checkpoint].add(0);
+        }
+        result.finalMoney.add(bankrupt ? 0 : table.money(0));
+        result.sessions++;
+    }
+}
+
+unsigned int BankrollSimulator::getThreadCount() const
+{
+    return threadCount;
+}
+
+void BankrollSimulator::setChart(const StrategyChart &chart)
+{
+    this->chart = chart;
+    useChart = true;
+}
+
+double BankrollSimulator::nZero(double mean, double variance)
+{
+    if (mean == 0)
+        return std::numeric_limits<double>::infinity();
+    return variance / (mean * mean);
+}
+
+double BankrollSimulator::analyticRiskOfRuin(const BettingPolicy &policy, int startingMoney, double mean, double variance, long long rounds)
+{
+    if (startingMoney <= 0)
+        return 1;
+    if (policy.amount <= 0)
+        return 0;
+
+    if (policy.type == BETTING::FLAT)
+        return ruinChance(mean, variance, static_cast<double>(startingMoney) / policy.amount, rounds);
+
+    // Below the floor the share of the money is less than the smallest bet, so the seat bets flat from there
+    double floor = static_cast<double>(policy.divisor) * policy.amount;
+    double flatRisk = ruinChance(mean, variance, std::min<double>(startingMoney, floor) / policy.amount, rounds);
+    if (startingMoney <= floor)
+        return flatRisk;
+
+    // A round moves the log of the money by log(1 + f X), which drifts by f mean - f^2 E[X^2] / 2 to second order
+    double fraction = 1.0 / policy.divisor;
+    double growth = fraction * mean - fraction * fraction * (variance + mean * mean) / 2;
+    double growthVariance = fraction * fraction * variance;
+    return ruinChance(growth, growthVariance, std::log(startingMoney / floor), rounds) * flatRisk;
+}
+
+double BankrollSimulator::ruinChance(double drift, double variance, double distance, long long rounds)
+{
+    if (distance <= 0)
+        return 1;
+    if (variance <= 0)
+        return drift < 0 && (rounds == 0 || -drift * rounds >= distance) ? 1 : 0;
+
+    // Falling that far ever is certain without an edge, and exponentially unlikely with one
+    if (rounds == 0)
+        return drift <= 0 ? 1 : std::exp(-2 * drift * distance / variance);
+
+    // The first passage of Brownian motion with drift: P = Phi(below) + exp(-2 drift distance / variance) Phi(above)
+    double spread = std::sqrt(variance * rounds);
+    double below = (-distance - drift * rounds) / spread;
+    double above = (-distance + drift * rounds) / spread;
+    double exponent = -2 * drift * distance / variance;
+
+    double reflected;
+    if (exponent <= 0 || above > -8)
+        reflected = std::exp(exponent) * normalCdf(above);
+    else
+    {
+        // exp(exponent) overflows on a long way down, but exp(exponent) density(above) is density(below),
+        // so use Phi(above) = density(above) times the asymptotic Mills ratio instead
+        double inverse = 1 / (above * above);
+        double mills = (1 - inverse + 3 * inverse * inverse - 15 * inverse * inverse * inverse) / -above;
+        reflected = normalDensity(below) * mills;
+    }
+    return std::clamp(normalCdf(below) + reflected, 0.0, 1.0);
+}
@@ -0,0 +1,208 @@
+#ifndef BANKROLLSIMULATOR_H
+#define BANKROLLSIMULATOR_H
+
+#include "bettingpolicy.h"
+#include "quantilesketch.h"
+#include "simulator.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The BankrollResult struct holds what happened to a batch of sessions that each start one seat with the same money.
+ * Everything is kept in sketches and running sums, so it takes the same memory however many sessions and rounds are played
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/10/2025
+ */
+struct BankrollResult
+{
+    /**
+     * @brief sessions The number of sessions played
+     */
+    long long sessions = 0;
+
+    /**
+     * @brief ruined The number of sessions that went bankrupt
+     */
+    long long ruined = 0;
+
+    /**
+     * @brief seconds The wall clock time spent playing the sessions
+     */
+    double seconds = 0;
+
+    /**
+     * @brief play Every hand played, in units of the bet placed on it, for the edge and variance the analytic estimates need
+     */
+    SimulationResult play;
+
+    /**
+     * @brief ruinRounds The rounds each bankrupt session lasted
+     */
+    QuantileSketch ruinRounds;
+
+    /**
+     * @brief finalMoney The money each session ended with, 0 if it went bankrupt
+     */
+    QuantileSketch finalMoney;
+
+    /**
+     * @brief checkpoints The rounds the money is sketched after
+     */
+    std::vector<long long> checkpoints;
+
+    /**
+     * @brief trajectory The money of every session after each checkpoint, 0 once bankrupt
+     */
+    std::vector<QuantileSketch> trajectory;
+
+    /**
+     * @brief merge Adds another batch of sessions with the same checkpoints to this one
+     * @param other The result to add
+     */
+    void merge(const BankrollResult &other);
+
+    /**
+     * @brief riskOfRuin Gets the fraction of sessions that went bankrupt
+     * @return The risk of ruin, or 0 if no sessions were played
+     */
+    double riskOfRuin() const;
+
+    /**
+     * @brief riskOfRuinError Gets the standard error of the risk of ruin
+     * @return The standard error
+     */
+    double riskOfRuinError() const;
+};
+
+/**
+ * @brief The BankrollSimulator class estimates the risk of ruin and how a bankroll moves for a betting policy, a strategy and table rules.
+ * Monte Carlo sessions each seat one player at their own table with the starting money and play until it goes bankrupt or the rounds run out.
+ * They are split across threads like MonteCarloRunner, each session dealt from its own seed, so the result is the same for the same seed and thread count.
+ * The analytic estimates treat a bankroll as Brownian motion with the measured edge and variance per bet, which is close for bankrolls of many bets
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/10/2025
+ */
+class BankrollSimulator
+{
+public:
+    /**
+     * @brief checkpointCount The number of evenly spaced rounds the money of every session is sketched after
+     */
+    static constexpr int checkpointCount = 10;
+
+    /**
+     * @brief BankrollSimulator Constructor that sets up the sessions each thread will play
+     * @param rules The house rules of each table, including the number of decks
+     * @param policy How the seat bets from its money
+     * @param startingMoney The money every session starts with
+     * @param threadCount The number of worker threads, 0 uses every hardware thread
+     * @param masterSeed The seed every session's seed is drawn from
+     * @param backend How the seat chooses its moves
+     */
+    BankrollSimulator(const TableRules &rules, const BettingPolicy &policy, int startingMoney, unsigned int threadCount, uint64_t masterSeed, BACKEND backend = BACKEND::BASIC);
+
+    /**
+     * @brief run Plays the sessions split across the threads and merges what happened to them
+     * @param sessions The number of sessions to play
+     * @param rounds The most rounds a session lasts
+     * @return The merged results of every thread
+     */
+    BankrollResult run(long long sessions, long long rounds) const;
+
+    /**
+     * @brief getThreadCount Gets the number of threads the sessions are split across
+     * @return The number of threads
+     */
+    unsigned int getThreadCount() const;
+
+    /**
+     * @brief setChart Has every table's BASIC backend play from a chart generated for the rules
+     * @param chart The chart to play from
+     */
+    void setChart(const StrategyChart &chart);
+
+    /**
+     * @brief nZero Gets the rounds it takes for the expected win to equal one standard deviation of the result
+     * @param mean The expected result of a round in bets
+     * @param variance The variance of a round in squared bets
+     * @return N0, or infinity with no edge
+     */
+    static double nZero(double mean, double variance);
+
+    /**
+     * @brief analyticRiskOfRuin Estimates the chance a policy goes bankrupt. A flat bettor's bankroll drifts by the edge with the round's variance.
+     * A proportional bettor's log bankroll drifts by the growth rate until it falls to where the smallest bet takes over, then bets flat,
+     * and the two are treated as independent with the whole horizon each, which leans high
+     * @param policy How the seat bets from its money
+     * @param startingMoney The money the seat starts with
+     * @param mean The expected result of a round in bets
+     * @param variance The variance of a round in squared bets
+     * @param rounds The most rounds played, 0 to play forever
+     * @return The risk of ruin
+     */
+    static double analyticRiskOfRuin(const BettingPolicy &policy, int startingMoney, double mean, double variance, long long rounds);
+
+private:
+    /**
+     * @brief rules The house rules of each table
+     */
+    TableRules rules;
+
+    /**
+     * @brief policy How the seat bets from its money
+     */
+    BettingPolicy policy;
+
+    /**
+     * @brief startingMoney The money every session starts with
+     */
+    int startingMoney;
+
+    /**
+     * @brief threadCount The number of worker threads
+     */
+    unsigned int threadCount;
+
+    /**
+     * @brief masterSeed The seed every session's seed is drawn from
+     */
+    uint64_t masterSeed;
+
+    /**
+     * @brief backend How the seat chooses its moves
+     */
+    BACKEND backend;
+
+    /**
+     * @brief chart The chart the tables play from when useChart is set
+     */
+    StrategyChart chart;
+
+    /**
+     * @brief useChart True if the tables play from chart rather than the hand written tables
+     */
+    bool useChart;
+
+    /**
+     * @brief playSessions Plays one thread's share of the sessions
+     * @param threadIndex The index of the thread, which picks its stream of session seeds
+     * @param sessions The number of sessions to play
+     * @param rounds The most rounds a session lasts
+     * @param result The result to add the sessions to, with its checkpoints already set
+     */
+    void playSessions(unsigned int threadIndex, long long sessions, long long rounds, BankrollResult &result) const;
+
+    /**
+     * @brief ruinChance Gets the chance Brownian motion falls a distance below where it starts
+     * @param drift The expected move per round
+     * @param variance The variance of a round
+     * @param distance How far it has to fall
+     * @param rounds The most rounds, 0 for forever
+     * @return The chance of falling that far
+     */
+    static double ruinChance(double drift, double variance, double distance, long long rounds);
+};
+
+#endif // BANKROLLSIMULATOR_H
@@ -0,0 +1,49 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief The Benchmark namespace holds a tiny timing harness for the microbenchmarks in benchmarkmain.cpp
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/25/2025
+ */
+namespace Benchmark
+{
+
+    /**
+     * @brief sink Results are folded in here so the optimizer can't remove the measured work
+     */
+    inline volatile uint64_t sink = 0;
+
+    /**
+     * @brief measure Runs a function the given number of times and prints the average time per call
+     * @param name The name to print for the measurement
+     * @param iterations The number of times to call the function
+     * @param function The work to measure, returns a value that is folded into the sink
+     * @return The average number of nanoseconds per call
+     */
+    template <typename Function>
+    double measure(const std::string &name, long long iterations, Function function)
+    {
+        uint64_t result = 0;
+        auto start = std::chrono::steady_clock::now();
+
+        for (long long i = 0; i < iterations; i++)
+            result += function(i);
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        sink = sink + result;
+
+        double nanoseconds = seconds * 1e9 / iterations;
+        std::cout << "  " << name << ": " << nanoseconds << " ns/op\n";
+        return nanoseconds;
+    }
+
+}
+
+#endif // BENCHMARK_H
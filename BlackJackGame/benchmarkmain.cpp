@@ -0,0 +1,618 @@
+/**
+ * @brief Main for the blackjack microbenchmarks. Each benchmark compares a hot path of the model against the implementation it replaced
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/25/2025
+ */
+
+#include "benchmark.h"
+#include "blockcodec.h"
+#include "cardcounter.h"
+#include "dealerprobabilities.h"
+#include "evengine.h"
+#include "hand.h"
+#include "handhistoryreader.h"
+#include "handhistorywriter.h"
+#include "historyreplayer.h"
+#include "packedstrategy.h"
+#include "rank.h"
+#include "rng.h"
+#include "shufflekernel.h"
+#include "simulator.h"
+#include "tablerules.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief rescanTotalAndSoft The previous Hand::calculateTotalAndSoft, which rescanned every card on each query
+ * @param hand The hand to total
+ * @return A pair of the total and if the hand is soft
+ */
+static std::pair<int, bool> rescanTotalAndSoft(const Hand &hand)
+{
+    int total = 0;
+    int softAces = 0;
+
+    for (const Card &card : hand.getCards())
+    {
+        int value = Rank::blackjackValue(card.getRank());
+        if (value == 11)
+            softAces++;
+        total += value;
+    }
+
+    while (total > 21 && softAces > 0)
+    {
+        total -= 10;
+        softAces--;
+    }
+
+    return std::make_pair(total, softAces > 0);
+}
+
+/**
+ * @brief randomHands Deals random hands of 2 to 5 cards
+ * @param count The number of hands to deal
+ * @return The dealt hands
+ */
+static std::vector<Hand> randomHands(int count)
+{
+    Rng rng(2025);
+    std::vector<Hand> hands(count);
+
+    for (Hand &hand : hands)
+    {
+        int cards = 2 + rng() % 4;
+        for (int i = 0; i < cards; i++)
+            hand.addCard(Card::fromCode(rng() % Card::count));
+    }
+    return hands;
+}
+
+/**
+ * @brief benchmarkHand Compares the per decision cost of the incremental hand totals against rescanning the cards.
+ * A decision asks for the pair check, softness and total like BotStrategy::getNextMove and GameState::isBust do
+ */
+static void benchmarkHand()
+{
+    std::cout << "Hand queries per decision (pair, soft, total, bust)\n";
+
+    const int handCount = 4096;
+    const long long iterations = 50000000;
+    std::vector<Hand> hands = randomHands(handCount);
+
+    double rescan = Benchmark::measure("rescan", iterations, [&](long long i)
+                                       {
+        const Hand &hand = hands[i & (handCount - 1)];
+        CardView cards = hand.getCards();
+        bool pair = cards.size() == 2 && cards[0].getRank() == cards[1].getRank();
+        bool soft = rescanTotalAndSoft(hand).second;
+        int total = rescanTotalAndSoft(hand).first;
+        bool bust = rescanTotalAndSoft(hand).first > 21;
+        return static_cast<uint64_t>(total + pair + soft + bust); });
+
+    double incremental = Benchmark::measure("incremental", iterations, [&](long long i)
+                                            {
+        const Hand &hand = hands[i & (handCount - 1)];
+        bool pair = hand.isPair();
+        bool soft = hand.isSoft();
+        int total = hand.getTotal();
+        bool bust = hand.getTotal() > 21;
+        return static_cast<uint64_t>(total + pair + soft + bust); });
+
+    std::cout << "  speedup: " << rescan / incremental << "x\n";
+}
+
+/**
+ * @brief benchmarkDealer Compares computing the dealer's outcome distribution from scratch against looking it up once the shoe has been seen
+ */
+static void benchmarkDealer()
+{
+    std::cout << "Dealer outcomes for a 6 deck shoe\n";
+
+    DealerProbabilities dealer;
+    ShoeComposition shoe(6);
+
+    double cold = Benchmark::measure("cold", 20, [&](long long i)
+                                     {
+        dealer.clearCache();
+        return static_cast<uint64_t>(dealer.get(i % ShoeComposition::valueCount, shoe)[0] * 1000); });
+
+    dealer.reset(shoe);
+    double warm = Benchmark::measure("warm", 100000000, [&](long long i)
+                                     { return static_cast<uint64_t>(dealer.getCurrent(i % ShoeComposition::valueCount)[0] * 1000); });
+
+    std::cout << "  speedup: " << cold / warm << "x\n";
+}
+
+/**
+ * @brief benchmarkCount Compares keeping the true count as cards are dealt against rescanning every dealt card for each query,
+ * through 80% of a 6 deck shoe with a query after every card
+ */
+static void benchmarkCount()
+{
+    std::cout << "True count through a 6 deck shoe\n";
+
+    const int shoeSize = 6 * Card::count;
+    const int dealt = shoeSize * 8 / 10;
+    std::vector<Card> shoe;
+    Rng rng(2025);
+    for (int i = 0; i < shoeSize; i++)
+        shoe.push_back(Card::fromCode(rng() % Card::count));
+
+    double rescan = Benchmark::measure("rescan", 200, [&](long long)
+                                       {
+        double sum = 0;
+        for (int i = 1; i <= dealt; i++)
+        {
+            CardCounter counter(SYSTEM::HILO, 6);
+            for (int j = 0; j < i; j++)
+                counter.count(shoe[j]);
+            sum += counter.getTrueCount(shoeSize - i);
+        }
+        return static_cast<uint64_t>(sum); });
+
+    double incremental = Benchmark::measure("incremental", 20000, [&](long long)
+                                            {
+        double sum = 0;
+        CardCounter counter(SYSTEM::HILO, 6);
+        for (int i = 1; i <= dealt; i++)
+        {
+            counter.count(shoe[i - 1]);
+            sum += counter.getTrueCount(shoeSize - i);
+        }
+        return static_cast<uint64_t>(sum); });
+
+    std::cout << "  speedup: " << rescan / incremental << "x\n";
+}
+
+/**
+ * @brief tableMove The previous BotStrategy::getTableMove, which branched on the pair, soft and hard tables and indexed them through Rank::blackjackValue
+ * @param hand The player's hand
+ * @param dealerCard The dealer's up card
+ * @return The move from the Statistics tables
+ */
+static MOVE tableMove(const Hand &hand, const Card &dealerCard)
+{
+    int dealer = Rank::blackjackValue(dealerCard.getRank()) - 2;
+    if (hand.isPair())
+        return Statistics::PairTable[Rank::blackjackValue(hand.getCards()[0].getRank()) - 2][dealer];
+    if (hand.isSoft())
+        return Statistics::SoftTable[hand.getTotal() - 13][dealer];
+    return Statistics::HardTable[hand.getTotal() - 5][dealer];
+}
+
+/**
+ * @brief benchmarkStrategy Compares the packed constexpr strategy table against the previous branching lookup,
+ * over every two and three card hand a player can act on against every up card, in a random order
+ */
+static void benchmarkStrategy()
+{
+    std::cout << "Basic strategy lookup over every reachable decision\n";
+
+    std::vector<std::pair<Hand, Card>> decisions;
+    for (RANK dealer : Rank::allRanks)
+        for (RANK first : Rank::allRanks)
+            for (RANK second : Rank::allRanks)
+                for (int third = -1; third < static_cast<int>(Card::count / 4); third++)
+                {
+                    Hand hand;
+                    hand.addCard(Card(SUIT::SPADES, first));
+                    hand.addCard(Card(SUIT::HEARTS, second));
+                    if (third >= 0)
+                        hand.addCard(Card(SUIT::CLUBS, static_cast<RANK>(third)));
+                    if (hand.getTotal() < 21 || (hand.getTotal() == 21 && !hand.isBlackjack()))
+                        decisions.emplace_back(hand, Card(SUIT::DIAMONDS, dealer));
+                }
+
+    Rng rng(2025);
+    for (std::size_t i = decisions.size() - 1; i > 0; i--)
+        std::swap(decisions[i], decisions[rng() % (i + 1)]);
+
+    std::size_t mismatches = 0;
+    for (const auto &decision : decisions)
+        mismatches += tableMove(decision.first, decision.second) != gameStrategy.getMove(decision.first, decision.second);
+    std::cout << "  decisions: " << decisions.size() << ", mismatches: " << mismatches << "\n";
+
+    // Measure over a power of two sample so picking the next decision is a mask
+    const std::size_t sampleSize = 16384;
+    decisions.resize(sampleSize);
+    const long long iterations = 100000000;
+    double branching = Benchmark::measure("branching", iterations, [&](long long i)
+                                          {
+        const auto &decision = decisions[i & (sampleSize - 1)];
+        return static_cast<uint64_t>(tableMove(decision.first, decision.second)); });
+
+    double packed = Benchmark::measure("packed", iterations, [&](long long i)
+                                       {
+        const auto &decision = decisions[i & (sampleSize - 1)];
+        return static_cast<uint64_t>(gameStrategy.getMove(decision.first, decision.second)); });
+
+    std::cout << "  speedup: " << branching / packed << "x\n";
+}
+
+/**
+ * @brief benchmarkShuffle Compares the batched shuffle kernel against std::shuffle with the Rng and with std::default_random_engine,
+ * which Deck used before the Rng, for shoes of 1, 2, 6 and 8 decks. The casino procedure is timed too, for shuffle tracking runs
+ */
+static void benchmarkShuffle()
+{
+    for (int decks : {1, 2, 6, 8})
+    {
+        std::cout << "Shuffling a " << decks << " deck shoe\n";
+
+        std::vector<Card> shoe;
+        for (int i = 0; i < decks; i++)
+            for (unsigned int code = 0; code < Card::count; code++)
+                shoe.push_back(Card::fromCode(code));
+
+        // Fewer iterations for bigger shoes so each measurement takes about as long
+        const long long iterations = 4000000 / decks;
+
+        std::default_random_engine engine(2025);
+        double standard = Benchmark::measure("std::shuffle, default_random_engine", iterations, [&](long long)
+                                             {
+            std::shuffle(shoe.begin(), shoe.end(), engine);
+            return shoe[0].getCode(); });
+
+        Rng rng(2025);
+        double standardRng = Benchmark::measure("std::shuffle, Rng", iterations, [&](long long)
+                                                {
+            std::shuffle(shoe.begin(), shoe.end(), rng);
+            return shoe[0].getCode(); });
+
+        double kernel = Benchmark::measure("ShuffleKernel", iterations, [&](long long)
+                                           {
+            ShuffleKernel::shuffle(shoe.data(), shoe.size(), rng);
+            return shoe[0].getCode(); });
+
+        ShuffleModel casino = ShuffleModel::casino(0.2);
+        Benchmark::measure("casino procedure", iterations / 10, [&](long long)
+                           {
+            ShuffleKernel::shuffle(shoe, rng, casino);
+            return shoe[0].getCode(); });
+
+        std::cout << "  speedup: " << standard / kernel << "x over default_random_engine, " << standardRng / kernel << "x over Rng\n";
+    }
+}
+
+/**
+ * @brief benchmarkHistory Measures what recording a hand history adds to a simulated round, and how fast its blocks compress and decompress.
+ * The history is written to a scratch file that is removed afterwards
+ */
+static void benchmarkHistory()
+{
+    std::cout << "Hand history for 3 seats, 6 decks\n";
+
+    TableRules rules;
+    rules.deckCount = 6;
+    const long long rounds = 400000;
+    const std::string path = "benchmark-history.bjh";
+
+    Simulator plain(3, rules, 10, Rng(2025));
+    SimulationResult plainResult;
+    double unrecorded = Benchmark::measure("round", rounds, [&](long long)
+                                           {
+        plain.playRound(plainResult);
+        return static_cast<uint64_t>(plainResult.hands); });
+
+    long long rawBytes;
+    long long fileBytes;
+    double recorded;
+    {
+        HandHistoryWriter history(path, 3, rules.deckCount);
+        Simulator recording(3, rules, 10, Rng(2025));
+        recording.setHistory(&history);
+        SimulationResult recordedResult;
+        recorded = Benchmark::measure("recorded round", rounds, [&](long long)
+                                      {
+            recording.playRound(recordedResult);
+            return static_cast<uint64_t>(recordedResult.hands); });
+        history.close();
+        rawBytes = history.getRawBytes();
+        fileBytes = history.getFileBytes();
+    }
+    std::remove(path.c_str());
+
+    double overhead = recorded - unrecorded;
+    std::cout << "  recording: " << overhead << " ns per round, " << 3000.0 / overhead << " million hands/sec, "
+              << static_cast<double>(rawBytes) / rounds << " bytes per round compressed " << static_cast<double>(rawBytes) / fileBytes << "x\n";
+
+    // A block of records from a short recorded run, timed through the codec on its own
+    std::vector<uint8_t> block;
+    {
+        HandHistoryWriter history(path, 3, rules.deckCount, 1 << 30);
+        Simulator recording(3, rules, 10, Rng(7));
+        recording.setHistory(&history);
+        SimulationResult result;
+        while (history.getRawBytes() < static_cast<long long>(HandHistoryWriter::defaultBlockSize))
+            recording.playRound(result);
+        history.close();
+
+        std::FILE *file = std::fopen(path.c_str(), "rb");
+        std::vector<uint8_t> bytes(static_cast<std::size_t>(history.getFileBytes()));
+        bytes.resize(std::fread(bytes.data(), 1, bytes.size(), file));
+        std::fclose(file);
+        HistoryBlockHeader header = HistoryBlockHeader::read(bytes.data() + HistoryFileHeader::size);
+        BlockCodec::decompress(bytes.data() + HistoryFileHeader::size + HistoryBlockHeader::size, header.storedSize, block, header.rawSize);
+    }
+    std::remove(path.c_str());
+
+    BlockCodec codec;
+    std::vector<uint8_t> compressed;
+    std::vector<uint8_t> decompressed;
+    double compress = Benchmark::measure("compress block", 2000, [&](long long)
+                                         {
+        codec.compress(block.data(), block.size(), compressed);
+        return static_cast<uint64_t>(compressed.size()); });
+    double decompress = Benchmark::measure("decompress block", 2000, [&](long long)
+                                           {
+        BlockCodec::decompress(compressed.data(), compressed.size(), decompressed, block.size());
+        return static_cast<uint64_t>(decompressed[0]); });
+    std::cout << "  codec: " << block.size() * 1000.0 / compress << " MB/s compressing, " << block.size() * 1000.0 / decompress << " MB/s decompressing\n";
+}
+
+/**
+ * @brief benchmarkHistoryRead Measures reading a recorded hand history back: scanning every record on one thread and on every hardware thread,
+ * seeking to random rounds, and replaying the rounds through GameState. The history is written to a scratch file that is removed afterwards
+ */
+static void benchmarkHistoryRead()
+{
+    std::cout << "Hand history reading for 3 seats, 6 decks\n";
+
+    TableRules rules;
+    rules.deckCount = 6;
+    const long long rounds = 1000000;
+    const std::string path = "benchmark-history-read.bjh";
+    {
+        HandHistoryWriter history(path, 3, rules.deckCount);
+        Simulator recording(3, rules, 10, Rng(2025));
+        recording.setHistory(&history);
+        SimulationResult result;
+        for (long long i = 0; i < rounds; i++)
+            recording.playRound(result);
+    }
+
+    {
+        auto start = std::chrono::steady_clock::now();
+        HandHistoryReader reader(path);
+        double indexing = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "  index: " << reader.getBlockCount() << " blocks of " << reader.getFileBytes() / 1000000.0 << " MB in " << indexing << " us\n";
+
+        // Counts the hands settled, one total per thread so the threads share nothing
+        std::vector<uint64_t> hands;
+        auto countHands = [&hands](unsigned int thread, HistoryCursor &cursor)
+        {
+            while (cursor.next())
+                if (cursor.getRecord() == RECORD::SETTLE)
+                    hands[thread] += cursor.getStatuses().size();
+        };
+
+        for (unsigned int threads : {1u, std::max(1u, std::thread::hardware_concurrency())})
+        {
+            hands.assign(threads, 0);
+            double scan = Benchmark::measure("scan on " + std::to_string(threads) + " threads", 5, [&](long long)
+                                             { return static_cast<uint64_t>(reader.scan(threads, countHands)); });
+            uint64_t total = 0;
+            for (uint64_t count : hands)
+                total += count;
+            std::cout << "    " << rounds * 1000.0 / scan << " million rounds/sec, " << total / 5 * 1000.0 / scan << " million hands/sec, "
+                      << reader.getFileBytes() / scan << " GB/s of file\n";
+        }
+
+        HistoryReplayer replayer(reader);
+        HistoryRound round;
+        Rng rng(9);
+        Benchmark::measure("seek to a random round", 1000, [&](long long)
+                           {
+            replayer.seek(static_cast<long long>(rng() % static_cast<uint64_t>(rounds)));
+            replayer.nextRound(round);
+            return static_cast<uint64_t>(round.number); });
+
+        // One replay of every round, checked against the recorded money as it goes
+        start = std::chrono::steady_clock::now();
+        long long replayed = replayer.replay(0, rounds, rules, nullptr);
+        double replay = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / replayed;
+        std::cout << "  replay round: " << replay << " ns/op, " << 1000.0 / replay << " million rounds/sec through GameState\n";
+    }
+    std::remove(path.c_str());
+}
+
+/**
+ * @brief printLatencies Prints the mean, median, 99th percentile and worst of a set of timings
+ * @param micros The timings in microseconds, sorted in place
+ */
+static void printLatencies(std::vector<double> &micros)
+{
+    std::sort(micros.begin(), micros.end());
+    double total = std::accumulate(micros.begin(), micros.end(), 0.0);
+    std::cout << "  " << micros.size() << " decisions: mean " << total / micros.size() << " us, median " << micros[micros.size() / 2]
+              << " us, p99 " << micros[micros.size() * 99 / 100] << " us, worst " << micros.back() << " us, "
+              << micros.size() * 1e6 / total << " decisions/sec\n";
+}
+
+/**
+ * @brief benchmarkDecision Times every EVEngine::evaluate the composition strategy makes, for three seats dealt from a shoe the way Simulator deals it.
+ * Seats hit until the engine says otherwise and the dealer draws to 17, so the shoe runs down to the cut card between shuffles
+ * @param preset The rules to deal and evaluate by
+ * @param rounds The number of rounds to deal
+ */
+static void benchmarkDecision(PRESET preset, int rounds)
+{
+    TableRules rules = TableRules::fromPreset(preset);
+    std::cout << "Composition decisions, " << rules.describe() << "\n";
+
+    EVEngine engine(rules);
+    Rng rng(2025);
+    std::vector<Card> shoe;
+    for (int i = 0; i < rules.deckCount; i++)
+        for (unsigned int code = 0; code < Card::count; code++)
+            shoe.push_back(Card::fromCode(code));
+    std::size_t cut = static_cast<std::size_t>(shoe.size() * rules.penetration);
+    std::size_t next = shoe.size();
+    ShoeComposition unseen;
+
+    auto draw = [&]()
+    {
+        Card card = shoe[next++];
+        unseen.removeCard(card);
+        return card;
+    };
+
+    std::vector<double> micros;
+    for (int round = 0; round < rounds; round++)
+    {
+        if (rules.shuffleEveryRound || next > cut)
+        {
+            ShuffleKernel::shuffle(shoe.data(), shoe.size(), rng);
+            unseen = ShoeComposition(rules.deckCount);
+            next = 0;
+        }
+
+        Hand seats[3];
+        for (Hand &seat : seats)
+            seat.addCard(draw());
+        Hand dealer;
+        dealer.addCard(draw());
+        for (Hand &seat : seats)
+            seat.addCard(draw());
+
+        // The hole card stays unseen until the seats are done
+        Card hole = shoe[next++];
+        int upIndex = ShoeComposition::indexOf(dealer.getCards()[0]);
+        for (Hand &seat : seats)
+        {
+            while (seat.getTotal() < 21)
+            {
+                auto start = std::chrono::steady_clock::now();
+                MOVE move = engine.evaluate(seat, upIndex, unseen).getBestMove();
+                micros.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+                if (move != MOVE::HIT && move != MOVE::DOUBLE)
+                    break;
+                seat.addCard(draw());
+                if (move == MOVE::DOUBLE)
+                    break;
+            }
+        }
+
+        unseen.removeCard(hole);
+        dealer.addCard(hole);
+        while (dealer.getTotal() < 17)
+            dealer.addCard(draw());
+    }
+
+    printLatencies(micros);
+}
+
+/**
+ * @brief benchmarkSplit Times EVEngine::getSplitOutcome for the pair of each seat's first card against the up card, from a 6 deck shoe dealt down to a 75% cut.
+ * Every split is a decision the composition strategy makes cold the first time a pair shows up for a shoe
+ * @param maxSplitHands The most hands a seat may split into
+ * @param rounds The number of rounds to deal
+ */
+static void benchmarkSplit(int maxSplitHands, int rounds)
+{
+    TableRules rules = TableRules::fromPreset(PRESET::VEGAS_STRIP);
+    rules.maxSplitHands = maxSplitHands;
+    rules.doubleAfterSplit = true;
+    rules.resplitAces = true;
+    std::cout << "Split decisions, " << rules.describe() << "\n";
+
+    EVEngine engine(rules);
+    Rng rng(2025);
+    std::vector<Card> shoe;
+    for (int i = 0; i < rules.deckCount; i++)
+        for (unsigned int code = 0; code < Card::count; code++)
+            shoe.push_back(Card::fromCode(code));
+    std::size_t cut = static_cast<std::size_t>(shoe.size() * 0.75);
+    std::size_t next = shoe.size();
+    ShoeComposition unseen;
+
+    std::vector<double> micros;
+    double expectedHands = 0;
+    for (int round = 0; round < rounds; round++)
+    {
+        if (next > cut)
+        {
+            ShuffleKernel::shuffle(shoe.data(), shoe.size(), rng);
+            unseen = ShoeComposition(rules.deckCount);
+            next = 0;
+        }
+
+        // Three seats' first cards and an up card are seen, the hole card isn't
+        int pairs[3];
+        for (int &pair : pairs)
+            pair = ShoeComposition::indexOf(shoe[next++]);
+        int upIndex = ShoeComposition::indexOf(shoe[next++]);
+        for (std::size_t i = next - 4; i < next; i++)
+            unseen.removeCard(shoe[i]);
+
+        for (int pair : pairs)
+        {
+            auto start = std::chrono::steady_clock::now();
+            expectedHands += engine.getSplitOutcome(pair, upIndex, unseen).expectedHands;
+            micros.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+        }
+
+        // The rest of the round takes about as many cards again
+        for (int i = 0; i < 4 && next < shoe.size(); i++)
+            unseen.removeCard(shoe[next++]);
+    }
+
+    printLatencies(micros);
+    std::cout << "  expected hands per split: " << expectedHands / micros.size() << "\n";
+}
+
+/**
+ * @brief main The point of execution
+ * @param argc Number of args
+ * @param argv Char array of args, the names of the benchmarks to run or none to run all of them
+ * @return int An int for the success or failues of the program
+ */
+int main(int argc, char *argv[])
+{
+    auto selected = [&](const char *name)
+    {
+        if (argc < 2)
+            return true;
+        for (int i = 1; i < argc; i++)
+            if (std::strcmp(argv[i], name) == 0)
+                return true;
+        return false;
+    };
+
+    if (selected("hand"))
+        benchmarkHand();
+    if (selected("count"))
+        benchmarkCount();
+    if (selected("dealer"))
+        benchmarkDealer();
+    if (selected("strategy"))
+        benchmarkStrategy();
+    if (selected("shuffle"))
+        benchmarkShuffle();
+    if (selected("history"))
+        benchmarkHistory();
+    if (selected("historyread"))
+        benchmarkHistoryRead();
+    if (selected("decision"))
+    {
+        benchmarkDecision(PRESET::GAME, 2000);
+        benchmarkDecision(PRESET::VEGAS_STRIP, 500);
+    }
+    if (selected("split"))
+    {
+        benchmarkSplit(2, 300);
+        benchmarkSplit(4, 300);
+    }
+
+    return 0;
+}
@@ -0,0 +1,39 @@
+/**
+ * @brief Implementation of The BettingPolicy struct. It sizes a seat's bet from its money
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/10/2025
+ */
+
+#include "bettingpolicy.h"
+#include <algorithm>
+
+BettingPolicy BettingPolicy::flat(int amount)
+{
+    BettingPolicy policy;
+    policy.type = BETTING::FLAT;
+    policy.amount = amount;
+    return policy;
+}
+
+BettingPolicy BettingPolicy::proportional(int divisor, int minimum)
+{
+    BettingPolicy policy;
+    policy.type = BETTING::PROPORTIONAL;
+    policy.amount = minimum;
+    policy.divisor = divisor;
+    return policy;
+}
+
+int BettingPolicy::getBet(int money) const
+{
+    int bet = type == BETTING::FLAT ? amount : std::max(money / divisor, amount);
+    return std::min(bet, money);
+}
+
+std::string BettingPolicy::describe() const
+{
+    if (type == BETTING::FLAT)
+        return BettingType::toString(type) + ": " + std::to_string(amount);
+    return BettingType::toString(type) + ": money / " + std::to_string(divisor) + ", at least " + std::to_string(amount);
+}
@@ -0,0 +1,102 @@
+#ifndef BETTINGPOLICY_H
+#define BETTINGPOLICY_H
+
+#include <array>
+#include <string>
+
+namespace BettingType
+{
+
+    /**
+     * @brief The BETTING enum How a seat sizes its bet from its money
+     *
+     * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+     * @date 5/10/2025
+     */
+    enum class BETTING
+    {
+        FLAT,
+        PROPORTIONAL
+    };
+
+    /**
+     * @brief toString Converts a BETTING to a string
+     * @param betting The BETTING to convert
+     * @return A string of the BETTING provided
+     */
+    inline std::string toString(BETTING betting)
+    {
+        switch (betting)
+        {
+        case BETTING::FLAT:
+            return "Flat";
+        case BETTING::PROPORTIONAL:
+            return "Proportional";
+        default:
+            return "Unknown";
+        }
+    }
+
+    /**
+     * @brief allBettings An array of all BETTING values for iteration
+     */
+    static constexpr std::array<BETTING, 2> allBettings = {BETTING::FLAT, BETTING::PROPORTIONAL};
+}
+
+using BettingType::BETTING;
+
+/**
+ * @brief The BettingPolicy struct describes how a seat bets from its money. FLAT bets the same amount every round.
+ * PROPORTIONAL bets a share of the money, never less than a minimum, the way Controller's bots bet a tenth of their money.
+ * No bet is more than the seat has, so a seat only goes bankrupt by losing its last chip
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/10/2025
+ */
+struct BettingPolicy
+{
+    /**
+     * @brief type How the bet is sized
+     */
+    BETTING type = BETTING::FLAT;
+
+    /**
+     * @brief amount The flat bet, or the smallest proportional bet
+     */
+    int amount = 10;
+
+    /**
+     * @brief divisor The money is divided by this for a proportional bet
+     */
+    int divisor = 10;
+
+    /**
+     * @brief flat Gets a policy that bets the same every round
+     * @param amount The bet
+     * @return The betting policy
+     */
+    static BettingPolicy flat(int amount);
+
+    /**
+     * @brief proportional Gets a policy that bets a share of the money
+     * @param divisor The money is divided by this for the bet
+     * @param minimum The smallest bet
+     * @return The betting policy
+     */
+    static BettingPolicy proportional(int divisor, int minimum = 1);
+
+    /**
+     * @brief getBet Sizes the bet for a seat
+     * @param money The seat's money before betting
+     * @return The bet, no more than the money
+     */
+    int getBet(int money) const;
+
+    /**
+     * @brief describe Summarizes the policy in one line, for example "Proportional: money / 10, at least 1"
+     * @return The summary
+     */
+    std::string describe() const;
+};
+
+#endif // BETTINGPOLICY_H
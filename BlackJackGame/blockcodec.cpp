@@ -0,0 +1,189 @@
+/**
+ * @brief Implementation of The BlockCodec class. It compresses blocks of bytes with a small LZ77 coder in the style of LZ4
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/6/2025
+ */
+
+#include "blockcodec.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+void BlockCodec::compress(const uint8_t *source, std::size_t size, std::vector<uint8_t> &destination)
+{
+    // The worst case is every byte a literal, plus the length bytes and the token
+    destination.resize(size + size / 255 + 16);
+    uint8_t *out = destination.data();
+    positions.fill(0);
+
+    std::size_t anchor = 0;
+    std::size_t position = 0;
+    std::size_t misses = 0;
+    while (size >= minMatch && position <= size - minMatch)
+    {
+        uint32_t sequence = read32(source + position);
+        uint32_t &slot = positions[hash(sequence)];
+        std::size_t candidate = slot;
+        slot = static_cast<uint32_t>(position + 1);
+
+        // Slots hold the position plus one so an empty slot never matches
+        if (candidate == 0 || position + 1 - candidate > maxOffset || read32(source + candidate - 1) != sequence)
+        {
+            // Step further the longer nothing has matched, so data that doesn't compress passes quickly
+            position += 1 + (misses++ >> 5);
+            continue;
+        }
+        candidate--;
+        misses = 0;
+
+        // Compare 8 bytes at a time, the first differing byte is found from the bits of their difference
+        std::size_t length = minMatch;
+        while (position + length + 8 <= size)
+        {
+            uint64_t difference = read64(source + candidate + length) ^ read64(source + position + length);
+            if (difference != 0)
+            {
+                length += firstDifference(difference);
+                break;
+            }
+            length += 8;
+        }
+        if (position + length + 8 > size)
+            while (position + length < size && source[candidate + length] == source[position + length])
+                length++;
+
+        out = writeSequence(source + anchor, position - anchor, position - candidate, length, out);
+        position += length;
+        anchor = position;
+    }
+
+    out = writeSequence(source + anchor, size - anchor, 0, 0, out);
+    destination.resize(static_cast<std::size_t>(out - destination.data()));
+}
+
+void BlockCodec::decompress(const uint8_t *source, std::size_t size, std::vector<uint8_t> &destination, std::size_t originalSize)
+{
+    destination.resize(originalSize);
+    const uint8_t *in = source;
+    const uint8_t *end = source + size;
+    std::size_t out = 0;
+
+    // Lengths past the nibble are runs of 255 ended by a smaller byte
+    auto readLength = [&in, end](std::size_t length)
+    {
+        if (length != 15)
+            return length;
+        uint8_t byte;
+        do
+        {
+            if (in == end)
+                throw std::runtime_error("BlockCodec: truncated length");
+            byte = *in++;
+            length += byte;
+        } while (byte == 255);
+        return length;
+    };
+
+    while (in < end)
+    {
+        uint8_t token = *in++;
+
+        std::size_t literalCount = readLength(token >> 4);
+        if (literalCount > static_cast<std::size_t>(end - in) || literalCount > originalSize - out)
+            throw std::runtime_error("BlockCodec: literals overrun the block");
+        std::memcpy(destination.data() + out, in, literalCount);
+        in += literalCount;
+        out += literalCount;
+
+        // The last sequence has no match
+        if (in == end)
+            break;
+
+        if (end - in < 2)
+            throw std::runtime_error("BlockCodec: truncated offset");
+        std::size_t offset = in[0] | (in[1] << 8);
+        in += 2;
+        std::size_t length = readLength(token & 15) + minMatch;
+        if (offset == 0 || offset > out || length > originalSize - out)
+            throw std::runtime_error("BlockCodec: match out of range");
+
+        // A match at least 8 back copies 8 bytes at a time, a closer one overlaps what it is copying so runs repeat byte by byte
+        uint8_t *target = destination.data() + out;
+        const uint8_t *from = target - offset;
+        std::size_t i = 0;
+        if (offset >= 8)
+            for (; i + 8 <= length; i += 8)
+                std::memcpy(target + i, from + i, 8);
+        for (; i < length; i++)
+            target[i] = from[i];
+        out += length;
+    }
+
+    if (out != originalSize)
+        throw std::runtime_error("BlockCodec: block is shorter than its size");
+}
+
+uint8_t *BlockCodec::writeLength(std::size_t length, uint8_t *out)
+{
+    for (; length >= 255; length -= 255)
+        *out++ = 255;
+    *out++ = static_cast<uint8_t>(length);
+    return out;
+}
+
+uint8_t *BlockCodec::writeSequence(const uint8_t *literals, std::size_t literalCount, std::size_t offset, std::size_t matchLength, uint8_t *out)
+{
+    std::size_t matchCode = matchLength == 0 ? 0 : matchLength - minMatch;
+    *out++ = static_cast<uint8_t>((std::min<std::size_t>(literalCount, 15) << 4) | std::min<std::size_t>(matchCode, 15));
+    if (literalCount >= 15)
+        out = writeLength(literalCount - 15, out);
+    std::memcpy(out, literals, literalCount);
+    out += literalCount;
+
+    if (matchLength == 0)
+        return out;
+    *out++ = static_cast<uint8_t>(offset);
+    *out++ = static_cast<uint8_t>(offset >> 8);
+    if (matchCode >= 15)
+        out = writeLength(matchCode - 15, out);
+    return out;
+}
+
+uint32_t BlockCodec::read32(const uint8_t *bytes)
+{
+    uint32_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+uint64_t BlockCodec::read64(const uint8_t *bytes)
+{
+    uint64_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+std::size_t BlockCodec::firstDifference(uint64_t difference)
+{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return static_cast<std::size_t>(__builtin_clzll(difference)) / 8;
+#elif defined(__GNUC__)
+    return static_cast<std::size_t>(__builtin_ctzll(difference)) / 8;
+#else
+    // Assumes a little endian machine without the builtins
+    std::size_t byte = 0;
+    while ((difference & 0xFF) == 0)
+    {
+        difference >>= 8;
+        byte++;
+    }
+    return byte;
+#endif
+}
+
+uint32_t BlockCodec::hash(uint32_t sequence)
+{
+    // Knuth's multiplicative hash, the top bits are the best mixed
+    return (sequence * 2654435761u) >> (32 - hashBits);
+}
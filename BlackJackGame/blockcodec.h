@@ -0,0 +1,107 @@
+#ifndef BLOCKCODEC_H
+#define BLOCKCODEC_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The BlockCodec class compresses blocks of bytes with a small LZ77 coder in the style of LZ4. Repeats of 4 or more bytes
+ * within the last 64 KiB are found through a hash table of the last position each 4 byte sequence was seen at, and written as an offset and a length.
+ * Hand histories repeat the same seats, bets and record shapes every round, so they shrink several times over at a few hundred MB/s with no dependencies.
+ *
+ * A block is a list of sequences. Each starts with a token byte, the high nibble the number of literal bytes and the low nibble the match length less 4,
+ * either one 15 meaning more length follows in bytes of 255 until a smaller byte. Then come the literals, then the 2 byte little endian offset back to the match.
+ * The last sequence of a block is only literals, with no offset
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/6/2025
+ */
+class BlockCodec
+{
+public:
+    /**
+     * @brief compress Compresses a block of bytes
+     * @param source The bytes to compress
+     * @param size The number of bytes
+     * @param destination Set to the compressed bytes
+     */
+    void compress(const uint8_t *source, std::size_t size, std::vector<uint8_t> &destination);
+
+    /**
+     * @brief decompress Decompresses a block of bytes. Throws std::runtime_error if the block is corrupt
+     * @param source The compressed bytes
+     * @param size The number of compressed bytes
+     * @param destination Set to the decompressed bytes
+     * @param originalSize The number of bytes the block decompresses to
+     */
+    static void decompress(const uint8_t *source, std::size_t size, std::vector<uint8_t> &destination, std::size_t originalSize);
+
+private:
+    /**
+     * @brief hashBits The number of bits of the hash of a 4 byte sequence
+     */
+    static constexpr int hashBits = 12;
+
+    /**
+     * @brief minMatch The shortest repeat worth an offset and a token
+     */
+    static constexpr std::size_t minMatch = 4;
+
+    /**
+     * @brief maxOffset The farthest back a match can start
+     */
+    static constexpr std::size_t maxOffset = 65535;
+
+    /**
+     * @brief positions One more than the last position each hash of 4 bytes was seen at in the current block, 0 for never
+     */
+    std::array<uint32_t, 1 << hashBits> positions;
+
+    /**
+     * @brief writeLength Writes the part of a length that didn't fit in its nibble
+     * @param length The length less 15
+     * @param out Where to write
+     * @return The byte after the last one written
+     */
+    static uint8_t *writeLength(std::size_t length, uint8_t *out);
+
+    /**
+     * @brief writeSequence Writes literals and the match after them
+     * @param literals The first literal byte
+     * @param literalCount The number of literal bytes
+     * @param offset How far back the match starts, unused without a match
+     * @param matchLength The length of the match, 0 for the last sequence
+     * @param out Where to write
+     * @return The byte after the last one written
+     */
+    static uint8_t *writeSequence(const uint8_t *literals, std::size_t literalCount, std::size_t offset, std::size_t matchLength, uint8_t *out);
+
+    /**
+     * @brief read32 Reads 4 bytes as a number in the machine's byte order, only compared with other reads
+     * @param bytes The first byte
+     */
+    static uint32_t read32(const uint8_t *bytes);
+
+    /**
+     * @brief read64 Reads 8 bytes as a number in the machine's byte order
+     * @param bytes The first byte
+     */
+    static uint64_t read64(const uint8_t *bytes);
+
+    /**
+     * @brief firstDifference Gets the first byte in memory where two 8 byte reads differ
+     * @param difference The two reads xored together, not 0
+     * @return The index of the byte, from 0 to 7
+     */
+    static std::size_t firstDifference(uint64_t difference);
+
+    /**
+     * @brief hash Hashes 4 bytes into the table
+     * @param sequence The 4 bytes
+     */
+    static uint32_t hash(uint32_t sequence);
+};
+
+#endif // BLOCKCODEC_H
@@ -8,51 +8,196 @@
 
 #include "botstrategy.h"
 #include "statistics.h"
+#include "packedstrategy.h"
 #include "rank.h"
+#include "strategygenerator.h"
 
-BotStrategy::BotStrategy() {}
+BotStrategy::BotStrategy(BACKEND backend, const TableRules &rules) : backend(backend), rules(rules), evEngine(rules), useChart(false) {}
 
-MOVE BotStrategy::getNextMove(const Hand &playerHand, const Card &dealerCard)
+MOVE BotStrategy::getMove(const Hand &playerHand, const Card &dealerCard, const ShoeComposition &unseen, const HandOptions &options, double trueCount)
 {
-    // Check for a pair, only valid for 2 cards
+    if (backend == BACKEND::COMPOSITION)
+    {
+        MoveValues values = evEngine.evaluate(playerHand, ShoeComposition::indexOf(dealerCard), unseen, options.handCount);
+        values.canDouble = values.canDouble && options.canDouble;
+        values.canSplit = values.canSplit && options.canSplit;
+        values.canSurrender = options.canSurrender;
+        return values.getBestMove();
+    }
+    if (backend == BACKEND::COUNTING)
+        return getCountedMove(playerHand, dealerCard, trueCount, rules, options);
+
+    return getBasicMove(playerHand, dealerCard, options);
+}
+
+MOVE BotStrategy::getBasicMove(const Hand &playerHand, const Card &dealerCard, const HandOptions &options) const
+{
+    if (useChart)
+        return getChartMove(chart, playerHand, dealerCard, options);
+    return getNextMove(playerHand, dealerCard, rules, options);
+}
+
+void BotStrategy::setChart(const StrategyChart &chart)
+{
+    this->chart = chart;
+    useChart = true;
+}
+
+bool BotStrategy::loadChart(const std::string &directory)
+{
+    bool generated;
+    setChart(StrategyGenerator::loadOrGenerate(rules, directory, generated));
+    return !generated;
+}
+
+bool BotStrategy::hasChart() const
+{
+    return useChart;
+}
+
+BACKEND BotStrategy::getBackend() const
+{
+    return backend;
+}
+
+const TableRules &BotStrategy::getRules() const
+{
+    return rules;
+}
+
+MOVE BotStrategy::getNextMove(const Hand &playerHand, const Card &dealerCard, const TableRules &rules, const HandOptions &options)
+{
+    if (options.canSurrender && shouldSurrender(playerHand, dealerCard, rules))
+        return MOVE::SURRENDER;
+
+    return adjustMove(getTableMove(playerHand, dealerCard), playerHand, dealerCard, rules, options);
+}
+
+MOVE BotStrategy::getTableMove(const Hand &playerHand, const Card &dealerCard)
+{
+    // Pairs, soft and hard hands all come out of the one packed table by the hand's state id
+    return gameStrategy.getMove(playerHand, dealerCard);
+}
+
+MOVE BotStrategy::getChartMove(const StrategyChart &chart, const Hand &playerHand, const Card &dealerCard, const HandOptions &options)
+{
+    int dealerIndex = ShoeComposition::indexOf(dealerCard);
+
     if (isPair(playerHand))
-        return getPairHandMove(playerHand, dealerCard);
+    {
+        int pairIndex = ShoeComposition::indexOf(playerHand.getCards()[0]);
+        if (options.canSurrender && chart.surrenderPair[pairIndex][dealerIndex])
+            return MOVE::SURRENDER;
+
+        // A pair that can't split plays as its total
+        MOVE move = chart.pairMove(pairIndex, dealerIndex);
+        if (move != MOVE::SPLIT || options.canSplit)
+            return replaceDouble(move, playerHand, options);
+    }
 
-    // Check for soft hand
+    // Aces and twos are below the start of the soft and hard tables and always hit
+    int total = playerHand.getTotal();
     if (playerHand.isSoft())
-        return getSoftHandMove(playerHand, dealerCard);
+        return total < 13 ? MOVE::HIT : replaceDouble(chart.softMove(total, dealerIndex), playerHand, options);
+    if (total < 5)
+        return MOVE::HIT;
 
-    // Treat as a hard hand
-    return getHardHandMove(playerHand, dealerCard);
+    if (options.canSurrender && playerHand.getCards().size() == 2 && chart.surrenderHard[total - 5][dealerIndex])
+        return MOVE::SURRENDER;
+    return replaceDouble(chart.hardMove(total, dealerIndex), playerHand, options);
 }
 
-MOVE BotStrategy::getHardHandMove(const Hand &playerHand, const Card &dealerCard)
+MOVE BotStrategy::getCountedMove(const Hand &playerHand, const Card &dealerCard, double trueCount, const TableRules &rules, const HandOptions &options)
 {
-    int row = playerHand.getTotal() - 5;
+    if (options.canSurrender && shouldSurrender(playerHand, dealerCard, rules))
+        return MOVE::SURRENDER;
 
-    return Statistics::HardTable[row][cardToIndex(dealerCard)];
+    // No deviation takes back a split
+    MOVE basic = getNextMove(playerHand, dealerCard, rules, options);
+    if (basic == MOVE::SPLIT)
+        return basic;
+
+    bool pair = isPair(playerHand);
+    bool soft = playerHand.isSoft();
+    int total = playerHand.getTotal();
+    int pairValue = Rank::blackjackValue(playerHand.getCards()[0].getRank());
+    int dealerValue = Rank::blackjackValue(dealerCard.getRank());
+
+    for (const Deviation &deviation : Statistics::Deviations)
+    {
+        if (deviation.dealerValue != dealerValue)
+            continue;
+
+        // Hard total deviations don't cover soft hands
+        bool matches = deviation.pair ? pair && pairValue == deviation.total : !soft && total == deviation.total;
+        if (matches)
+            return adjustMove(trueCount >= deviation.index ? deviation.atOrAbove : deviation.below, playerHand, dealerCard, rules, options);
+    }
+
+    return basic;
 }
 
-MOVE BotStrategy::getSoftHandMove(const Hand &playerHand, const Card &dealerCard)
+bool BotStrategy::shouldSurrender(const Hand &playerHand, const Card &dealerCard, const TableRules &rules)
 {
-    int effective = playerHand.getTotal() - 11;
-    int row = effective - 2;
+    if (playerHand.isSoft() || playerHand.getCards().size() != 2)
+        return false;
+
+    int total = playerHand.getTotal();
+    int dealerValue = Rank::blackjackValue(dealerCard.getRank());
 
-    return Statistics::SoftTable[row][cardToIndex(dealerCard)];
+    // Multi deck late surrender, eights are split rather than given up unless the dealer hits soft 17 against an ace
+    if (total == 16 && !isPair(playerHand) && dealerValue >= 9)
+        return true;
+    if (total == 15 && dealerValue == 10)
+        return true;
+    return rules.dealerHitsSoft17 && dealerValue == 11 && total >= 15 && total <= 17;
 }
 
-MOVE BotStrategy::getPairHandMove(const Hand &playerHand, const Card &dealerCard)
+MOVE BotStrategy::adjustMove(MOVE move, const Hand &playerHand, const Card &dealerCard, const TableRules &rules, const HandOptions &options)
 {
-    int row = cardToIndex(playerHand.getCards()[0]);
-    return Statistics::PairTable[row][cardToIndex(dealerCard)];
+    int dealerValue = Rank::blackjackValue(dealerCard.getRank());
+
+    if (move == MOVE::SPLIT)
+    {
+        // Without doubling after the split, the small pairs only split against the weakest up cards
+        if (!rules.doubleAfterSplit)
+        {
+            int pairValue = Rank::blackjackValue(playerHand.getCards()[0].getRank());
+            if (((pairValue == 2 || pairValue == 3) && dealerValue <= 3) || (pairValue == 4) || (pairValue == 6 && dealerValue == 2))
+                move = MOVE::HIT;
+        }
+
+        // A pair that can't split plays as its total. Aces and twos are below the start of the soft and hard tables and always hit
+        if (move == MOVE::SPLIT && !options.canSplit)
+        {
+            if (playerHand.isSoft() || playerHand.getTotal() < 5)
+                move = MOVE::HIT;
+            else
+                move = getHardHandMove(playerHand, dealerCard);
+        }
+    }
+
+    return replaceDouble(move, playerHand, options);
+}
+
+MOVE BotStrategy::replaceDouble(MOVE move, const Hand &playerHand, const HandOptions &options)
+{
+    // Soft 18 stands when it can't double, everything else hits
+    if (move == MOVE::DOUBLE && !options.canDouble)
+        return playerHand.isSoft() && playerHand.getTotal() >= 18 ? MOVE::STAND : MOVE::HIT;
+    return move;
+}
+
+MOVE BotStrategy::getHardHandMove(const Hand &playerHand, const Card &dealerCard)
+{
+    int row = playerHand.getTotal() - 5;
+
+    return Statistics::HardTable[row][cardToIndex(dealerCard)];
 }
 
 bool BotStrategy::isPair(const Hand &hand)
 {
-    const std::vector<Card> &cards = hand.getCards();
-    if (cards.size() != 2)
-        return false;
-    return (cards[0].getRank() == cards[1].getRank());
+    return hand.isPair();
 }
 
 int BotStrategy::cardToIndex(const Card &card)
@@ -4,6 +4,50 @@
 #include "hand.h"
 #include "card.h"
 #include "statistics.h"
+#include "evengine.h"
+#include "shoecomposition.h"
+#include "strategychart.h"
+#include "tablerules.h"
+#include <string>
+
+namespace StrategyBackend
+{
+
+    /**
+     * @brief The BACKEND enum An enum for the ways a BotStrategy can choose its moves
+     *
+     * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+     * @date 4/26/2025
+     */
+    enum class BACKEND
+    {
+        BASIC,
+        COMPOSITION,
+        COUNTING
+    };
+
+    /**
+     * @brief toString Converts a BACKEND to a string
+     * @param backend The BACKEND to convert
+     * @return A string of the BACKEND provided
+     */
+    inline std::string toString(BACKEND backend)
+    {
+        switch (backend)
+        {
+        case BACKEND::BASIC:
+            return "Basic";
+        case BACKEND::COMPOSITION:
+            return "Composition";
+        case BACKEND::COUNTING:
+            return "Counting";
+        }
+
+        return "Unknown backend";
+    }
+}
+
+using StrategyBackend::BACKEND;
 
 /**
  * @brief The BotStrategy class computes the reccomended blackack move based on proper stretegy.
@@ -17,16 +61,95 @@ class BotStrategy
 public:
     /**
      * @brief BotStrategy Constructer for the bot strategy class
+     * @param backend BASIC to use the basic strategy tables, COMPOSITION to compute the best move from the unseen cards,
+     * COUNTING to use the basic strategy tables with the count indexed deviations
+     * @param rules The house rules the strategy plays by
      */
-    BotStrategy();
+    BotStrategy(BACKEND backend = BACKEND::BASIC, const TableRules &rules = TableRules());
+
+    /**
+     * @brief getMove Determines the move for a hand using this strategy's backend
+     * @param playerHand The player's hand
+     * @param dealerCard The dealer's up card
+     * @param unseen The cards the player hasn't seen, including the dealer's hole card. Only used by the COMPOSITION backend
+     * @param options The optional moves the hand may make
+     * @param trueCount The Hi-Lo true count of the cards the player has seen. Only used by the COUNTING backend
+     * @return A MOVE corresponding to the recommended move (HIT, DOUBLE, SPLIT, STAND, SURRENDER)
+     */
+    MOVE getMove(const Hand &playerHand, const Card &dealerCard, const ShoeComposition &unseen, const HandOptions &options = HandOptions(), double trueCount = 0);
+
+    /**
+     * @brief getBasicMove Determines the basic strategy move for a hand, from the chart for the rules if one has been loaded,
+     * otherwise from the hand written tables adjusted for the rules
+     * @param playerHand The player's hand
+     * @param dealerCard The dealer's up card
+     * @param options The optional moves the hand may make
+     * @return A MOVE corresponding to the recommended move (HIT, DOUBLE, SPLIT, STAND, SURRENDER)
+     */
+    MOVE getBasicMove(const Hand &playerHand, const Card &dealerCard, const HandOptions &options = HandOptions()) const;
+
+    /**
+     * @brief setChart Plays the BASIC backend from a chart instead of the hand written tables
+     * @param chart The chart, which should have been generated for this strategy's rules
+     */
+    void setChart(const StrategyChart &chart);
+
+    /**
+     * @brief loadChart Loads the chart for this strategy's rules from a cache directory, generating and caching it if it isn't there yet
+     * @param directory The directory charts are cached in
+     * @return True if the chart was read from the cache, false if it had to be generated
+     */
+    bool loadChart(const std::string &directory);
+
+    /**
+     * @brief hasChart Checks if the BASIC backend plays from a chart
+     * @return True if a chart has been set or loaded
+     */
+    bool hasChart() const;
+
+    /**
+     * @brief getBackend Gets how this strategy chooses its moves
+     * @return The BACKEND of the strategy
+     */
+    BACKEND getBackend() const;
+
+    /**
+     * @brief getRules Gets the house rules the strategy plays by
+     * @return The rules
+     */
+    const TableRules &getRules() const;
 
     /**
      * @brief getNextMove Determines the recommended move (hit, double, split, or stand) given a player's hand and the dealer's visible card.
+     * The tables are adjusted for the rules, and a move the hand can't make is replaced by the best one it can
      * @param playerHand The player's hand.
      * @param dealerCard The dealer's up card.
-     * @return A MOVE corresponding to the recommended move (HIT, DOUBLE, SPLIT, STAND).
+     * @param rules The house rules of the table
+     * @param options The optional moves the hand may make
+     * @return A MOVE corresponding to the recommended move (HIT, DOUBLE, SPLIT, STAND, SURRENDER).
+     */
+    static MOVE getNextMove(const Hand &playerHand, const Card &dealerCard, const TableRules &rules = TableRules(), const HandOptions &options = HandOptions());
+
+    /**
+     * @brief getChartMove Determines the move for a hand from a chart. A move the hand can't make is replaced by the best one it can
+     * @param chart The chart to play from
+     * @param playerHand The player's hand
+     * @param dealerCard The dealer's up card
+     * @param options The optional moves the hand may make
+     * @return A MOVE corresponding to the recommended move (HIT, DOUBLE, SPLIT, STAND, SURRENDER)
+     */
+    static MOVE getChartMove(const StrategyChart &chart, const Hand &playerHand, const Card &dealerCard, const HandOptions &options = HandOptions());
+
+    /**
+     * @brief getCountedMove Determines the recommended move like getNextMove, then applies any deviation in Statistics::Deviations for the count
+     * @param playerHand The player's hand
+     * @param dealerCard The dealer's up card
+     * @param trueCount The Hi-Lo true count of the cards the player has seen
+     * @param rules The house rules of the table
+     * @param options The optional moves the hand may make
+     * @return A MOVE corresponding to the recommended move (HIT, DOUBLE, SPLIT, STAND, SURRENDER)
      */
-    static MOVE getNextMove(const Hand &playerHand, const Card &dealerCard);
+    static MOVE getCountedMove(const Hand &playerHand, const Card &dealerCard, double trueCount, const TableRules &rules = TableRules(), const HandOptions &options = HandOptions());
 
     /**
      * @brief isPair Checks if the hand is a pair (2 of the same card)
@@ -36,6 +159,31 @@ public:
     static bool isPair(const Hand &hand);
 
 private:
+    /**
+     * @brief backend How this strategy chooses its moves
+     */
+    BACKEND backend;
+
+    /**
+     * @brief rules The house rules the strategy plays by
+     */
+    TableRules rules;
+
+    /**
+     * @brief evEngine The expected value engine used by the COMPOSITION backend
+     */
+    EVEngine evEngine;
+
+    /**
+     * @brief chart The chart the BASIC backend plays from when useChart is set
+     */
+    StrategyChart chart;
+
+    /**
+     * @brief useChart True if the BASIC backend plays from chart rather than the hand written tables
+     */
+    bool useChart;
+
     /**
      * @brief cardToIndex Converts the current card to an index for a table by subtracting 2
      * @param card The card to convert
@@ -44,28 +192,49 @@ private:
     static int cardToIndex(const Card &card);
 
     /**
-     * @brief getSoftHandMove Determines the recommended move for a soft hand (ace counted as 11)
+     * @brief getTableMove Looks up the move for a hand in the strategy tables, as if every move were allowed
      * @param playerHand The player's hand
      * @param dealerCard The dealer's up card
      * @return A MOVE corresponding to the recommended move (HIT, DOUBLE, SPLIT, STAND)
      */
-    static MOVE getSoftHandMove(const Hand &playerHand, const Card &dealerCard);
+    static MOVE getTableMove(const Hand &playerHand, const Card &dealerCard);
 
     /**
-     * @brief getHARDHandMove Determines the recommended move for a hard hand
+     * @brief shouldSurrender Checks the late surrender strategy for a hand
      * @param playerHand The player's hand
      * @param dealerCard The dealer's up card
-     * @return A MOVE corresponding to the recommended move (HIT, DOUBLE, SPLIT, STAND)
+     * @param rules The house rules of the table
+     * @return True if the hand should surrender when it is allowed to
      */
-    static MOVE getHardHandMove(const Hand &playerHand, const Card &dealerCard);
+    static bool shouldSurrender(const Hand &playerHand, const Card &dealerCard, const TableRules &rules);
+
+    /**
+     * @brief adjustMove Changes a table move for the rules and replaces a move the hand can't make with the best one it can
+     * @param move The move from the tables
+     * @param playerHand The player's hand
+     * @param dealerCard The dealer's up card
+     * @param rules The house rules of the table
+     * @param options The optional moves the hand may make
+     * @return The move to make
+     */
+    static MOVE adjustMove(MOVE move, const Hand &playerHand, const Card &dealerCard, const TableRules &rules, const HandOptions &options);
 
     /**
-     * @brief getPairHandMove Determines the recommended move for a pair hand (Exactly 2 of the same RANK cards)
+     * @brief replaceDouble Replaces a double the hand can't make. Soft 18 and up stands, everything else hits
+     * @param move The move to check
+     * @param playerHand The player's hand
+     * @param options The optional moves the hand may make
+     * @return The move, or the one to make instead of doubling
+     */
+    static MOVE replaceDouble(MOVE move, const Hand &playerHand, const HandOptions &options);
+
+    /**
+     * @brief getHARDHandMove Determines the recommended move for a hard hand
      * @param playerHand The player's hand
      * @param dealerCard The dealer's up card
      * @return A MOVE corresponding to the recommended move (HIT, DOUBLE, SPLIT, STAND)
      */
-    static MOVE getPairHandMove(const Hand &playerHand, const Card &dealerCard);
+    static MOVE getHardHandMove(const Hand &playerHand, const Card &dealerCard);
 };
 
 #endif // BOTSTRATEGY_H
@@ -3,13 +3,14 @@
 
 #include "suits.h"
 #include "rank.h"
-#include <QtCore/qobject.h>
+#include <cstdint>
 
 using Rank::RANK;
 using Suit::SUIT;
 
 /**
- * @brief The Card class handles a single card object. Holds a SUIT, RANK, and image path corresponding to its png
+ * @brief The Card class handles a single card object. The SUIT and RANK are packed into a single byte (rank * 4 + suit)
+ * so cards are trivially copyable and dealing never touches the heap. The byte is also the index of the card's image, see CardImages
  *
  * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
  * @date 4/19/2025
@@ -25,73 +26,71 @@ class Card
     friend std::ostream &operator<<(std::ostream &os, const Card &card);
 
 public:
+    /**
+     * @brief count The number of distinct cards, and so the number of distinct codes
+     */
+    static constexpr unsigned int count = 52;
+
+    /**
+     * @brief Card Default constructor, creates the two of spades. Only needed for fixed size storage
+     */
+    constexpr Card() : code(0) {}
+
     /**
      * @brief Card Constructor which sets the rank and suit of the card
      * @param suit The suit of the card
      * @param rank The rank of the card
-     * @param imagePath The path of the image for the card
      */
-    Card(SUIT suit, RANK rank, QString imagePath);
+    constexpr Card(SUIT suit, RANK rank) : code(static_cast<uint8_t>(static_cast<int>(rank) * 4 + static_cast<int>(suit))) {}
+
+    /**
+     * @brief fromCode Creates a card from its packed byte
+     * @param code The rank * 4 + suit code of the card, must be less than count
+     * @return The card for the code
+     */
+    static constexpr Card fromCode(uint8_t code)
+    {
+        Card card;
+        card.code = code;
+        return card;
+    }
 
     /**
      * @brief getSuit Gets the suit of the card
      * @return Returns the suit of the card as a SUIT
      */
-    SUIT getSuit() const;
+    constexpr SUIT getSuit() const { return static_cast<SUIT>(code & 3); }
 
     /**
      * @brief getRank Gets the rank of the card
      * @return Returns the rank of the card as a RANK
      */
-    RANK getRank() const;
+    constexpr RANK getRank() const { return static_cast<RANK>(code >> 2); }
 
     /**
-     * @brief getImage Gets the QString path of the image
-     * @return A QString of the path
+     * @brief getCode Gets the packed byte of the card
+     * @return The rank * 4 + suit code of the card
      */
-    QString getImagePath() const;
+    constexpr uint8_t getCode() const { return code; }
 
     /**
-     * @brief setImagePath Sets the QString path of the image
-     * @param imagePath The new imagePath
+     * @brief operator == Checks if two cards have the same rank and suit
+     * @param other The card to compare to
+     * @return True if the cards are the same
      */
-    void setImagePath(QString imagePath);
-
-    /**
-     * @brief getImageFromVector Gets the corresponding image path from the private member variable images
-     * The images are layed out in this rank order 2, 3, 4, 5, 6, 7, 8, 9, 10, jack, queen, king, ace.
-     * The images are layoud out in this suit order spades, hearts, clubs, diamonds
-     * @param index The index to get
-     * @return
-     */
-    static QString getImageFromVector(unsigned int index);
+    constexpr bool operator==(const Card &other) const { return code == other.code; }
 
     /**
      * @brief toString Gives the string output of this card as Rank of Suit
      * @return "Rank of Suit"
      */
-    std::string toString();
+    std::string toString() const;
 
 private:
     /**
-     * @brief suit The suit of the card
-     */
-    SUIT suit;
-
-    /**
-     * @brief rank The rank of the card
-     */
-    RANK rank;
-
-    /**
-     * @brief imagePath The image path of the card
-     */
-    QString imagePath;
-
-    /**
-     * @brief images A vector of alll the card images
+     * @brief code The rank and suit of the card packed as rank * 4 + suit
      */
-    static std::vector<QString> images;
+    uint8_t code;
 };
 
 #endif // CARD_H
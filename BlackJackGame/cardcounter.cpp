@@ -0,0 +1,38 @@
+/**
+ * @brief Implementation of The CardCounter class. It keeps the running count of a shoe for one counting system
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/28/2025
+ */
+
+#include "cardcounter.h"
+#include <algorithm>
+
+/**
+ * @brief systemTags The tags of each system for two through nine, tens and aces, in SYSTEM order
+ */
+static const int systemTags[][ShoeComposition::valueCount] = {
+    // 2  3  4  5  6  7  8  9  T   A
+    {1, 1, 1, 1, 1, 0, 0, 0, -1, -1}, // Hi-Lo
+    {1, 1, 1, 1, 1, 1, 0, 0, -1, -1}, // KO
+    {1, 1, 2, 2, 2, 1, 0, -1, -2, 0}, // Omega II
+    {1, 1, 2, 2, 2, 1, 0, 0, -2, -1}  // Zen
+};
+
+CardCounter::CardCounter(SYSTEM system, int deckCount) : system(system), tags(systemTags[static_cast<int>(system)])
+{
+    // KO tags one more card than it takes away per deck, so it starts low and a count of 0 is its pivot
+    startingCount = system == SYSTEM::KO ? 4 - 4 * deckCount : 0;
+    runningCount = startingCount;
+}
+
+void CardCounter::reset()
+{
+    runningCount = startingCount;
+}
+
+double CardCounter::getTrueCount(int cardsRemaining) const
+{
+    // Dividing by a sliver of a deck just magnifies noise, the cut card always comes well before a quarter deck
+    return runningCount / std::max(decksRemaining(cardsRemaining), 0.25);
+}
@@ -0,0 +1,148 @@
+#ifndef CARDCOUNTER_H
+#define CARDCOUNTER_H
+
+#include "card.h"
+#include "shoecomposition.h"
+#include <string>
+
+namespace CountingSystem
+{
+
+    /**
+     * @brief The SYSTEM enum An enum for the card counting systems a CardCounter can keep
+     *
+     * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+     * @date 4/28/2025
+     */
+    enum class SYSTEM
+    {
+        HILO,
+        KO,
+        OMEGA2,
+        ZEN
+    };
+
+    /**
+     * @brief toString Converts a SYSTEM to a string
+     * @param system The SYSTEM to convert
+     * @return A string of the SYSTEM provided
+     */
+    inline std::string toString(SYSTEM system)
+    {
+        switch (system)
+        {
+        case SYSTEM::HILO:
+            return "Hi-Lo";
+        case SYSTEM::KO:
+            return "KO";
+        case SYSTEM::OMEGA2:
+            return "Omega II";
+        case SYSTEM::ZEN:
+            return "Zen";
+        }
+
+        return "Unknown system";
+    }
+
+    /**
+     * @brief allSystems An array of all counting systems
+     */
+    inline constexpr SYSTEM allSystems[] = {
+        SYSTEM::HILO,
+        SYSTEM::KO,
+        SYSTEM::OMEGA2,
+        SYSTEM::ZEN};
+}
+
+using CountingSystem::SYSTEM;
+
+/**
+ * @brief The CardCounter class keeps the running count of a shoe for one counting system.
+ * Each system is a table of tags by card value, so counting a card is a single table lookup and add
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/28/2025
+ */
+class CardCounter
+{
+public:
+    /**
+     * @brief CardCounter Constructor for the counter
+     * @param system The counting system to keep
+     * @param deckCount The number of decks in the shoe, used for the starting count of unbalanced systems
+     */
+    CardCounter(SYSTEM system = SYSTEM::HILO, int deckCount = 1);
+
+    /**
+     * @brief count Adds the tag of a dealt card to the running count
+     * @param card The card that was dealt
+     */
+    void count(const Card &card) { runningCount += tags[ShoeComposition::indexOf(card)]; }
+
+    /**
+     * @brief uncount Takes the tag of a card back out of the running count, for a card that was dealt face down
+     * @param card The card to take back
+     */
+    void uncount(const Card &card) { runningCount -= tags[ShoeComposition::indexOf(card)]; }
+
+    /**
+     * @brief reset Sets the running count back to the starting count for a fresh shoe
+     */
+    void reset();
+
+    /**
+     * @brief getTag Gets the tag of a card in this counter's system
+     * @param card The card to get the tag of
+     * @return The amount the card changes the running count by
+     */
+    int getTag(const Card &card) const { return tags[ShoeComposition::indexOf(card)]; }
+
+    /**
+     * @brief getRunningCount Gets the running count
+     * @return The sum of the tags of every card counted since the last reset, plus the starting count
+     */
+    int getRunningCount() const { return runningCount; }
+
+    /**
+     * @brief getTrueCount Gets the running count per deck remaining. Unbalanced systems like KO are normally played off the running count instead
+     * @param cardsRemaining The number of cards left in the shoe
+     * @return The true count, with the decks remaining never taken as less than a quarter
+     */
+    double getTrueCount(int cardsRemaining) const;
+
+    /**
+     * @brief getSystem Gets the counting system of this counter
+     * @return The SYSTEM being counted
+     */
+    SYSTEM getSystem() const { return system; }
+
+    /**
+     * @brief decksRemaining Converts a number of cards to decks
+     * @param cardsRemaining The number of cards left in the shoe
+     * @return The number of decks left
+     */
+    static double decksRemaining(int cardsRemaining) { return cardsRemaining / static_cast<double>(Card::count); }
+
+private:
+    /**
+     * @brief system The counting system being counted
+     */
+    SYSTEM system;
+
+    /**
+     * @brief tags The tag of each card value for the system, indexed like ShoeComposition
+     */
+    const int *tags;
+
+    /**
+     * @brief startingCount The running count of a fresh shoe, 0 for balanced systems
+     */
+    int startingCount;
+
+    /**
+     * @brief runningCount The current running count
+     */
+    int runningCount;
+};
+
+#endif // CARDCOUNTER_H
@@ -0,0 +1,89 @@
+/**
+ * @brief Implementation of the CardImages namespace. It maps cards to their image resources
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/19/2025
+ */
+
+#include "cardimages.h"
+
+/**
+ * @brief images The image of every card, indexed by the card's code.
+ * The images are layed out in this rank order 2, 3, 4, 5, 6, 7, 8, 9, 10, jack, queen, king, ace.
+ * The images are layoud out in this suit order spades, hearts, clubs, diamonds
+ */
+static const char *const images[Card::count] = {
+    ":/cardImages/cards_pngsource/2_of_spades.png",
+    ":/cardImages/cards_pngsource/2_of_hearts.png",
+    ":/cardImages/cards_pngsource/2_of_clubs.png",
+    ":/cardImages/cards_pngsource/2_of_diamonds.png",
+
+    ":/cardImages/cards_pngsource/3_of_spades.png",
+    ":/cardImages/cards_pngsource/3_of_hearts.png",
+    ":/cardImages/cards_pngsource/3_of_clubs.png",
+    ":/cardImages/cards_pngsource/3_of_diamonds.png",
+
+    ":/cardImages/cards_pngsource/4_of_spades.png",
+    ":/cardImages/cards_pngsource/4_of_hearts.png",
+    ":/cardImages/cards_pngsource/4_of_clubs.png",
+    ":/cardImages/cards_pngsource/4_of_diamonds.png",
+
+    ":/cardImages/cards_pngsource/5_of_spades.png",
+    ":/cardImages/cards_pngsource/5_of_hearts.png",
+    ":/cardImages/cards_pngsource/5_of_clubs.png",
+    ":/cardImages/cards_pngsource/5_of_diamonds.png",
+
+    ":/cardImages/cards_pngsource/6_of_spades.png",
+    ":/cardImages/cards_pngsource/6_of_hearts.png",
+    ":/cardImages/cards_pngsource/6_of_clubs.png",
+    ":/cardImages/cards_pngsource/6_of_diamonds.png",
+
+    ":/cardImages/cards_pngsource/7_of_spades.png",
+    ":/cardImages/cards_pngsource/7_of_hearts.png",
+    ":/cardImages/cards_pngsource/7_of_clubs.png",
+    ":/cardImages/cards_pngsource/7_of_diamonds.png",
+
+    ":/cardImages/cards_pngsource/8_of_spades.png",
+    ":/cardImages/cards_pngsource/8_of_hearts.png",
+    ":/cardImages/cards_pngsource/8_of_clubs.png",
+    ":/cardImages/cards_pngsource/8_of_diamonds.png",
+
+    ":/cardImages/cards_pngsource/9_of_spades.png",
+    ":/cardImages/cards_pngsource/9_of_hearts.png",
+    ":/cardImages/cards_pngsource/9_of_clubs.png",
+    ":/cardImages/cards_pngsource/9_of_diamonds.png",
+
+    ":/cardImages/cards_pngsource/10_of_spades.png",
+    ":/cardImages/cards_pngsource/10_of_hearts.png",
+    ":/cardImages/cards_pngsource/10_of_clubs.png",
+    ":/cardImages/cards_pngsource/10_of_diamonds.png",
+
+    ":/cardImages/cards_pngsource/jack_of_spades.png",
+    ":/cardImages/cards_pngsource/jack_of_hearts.png",
+    ":/cardImages/cards_pngsource/jack_of_clubs.png",
+    ":/cardImages/cards_pngsource/jack_of_diamonds.png",
+
+    ":/cardImages/cards_pngsource/queen_of_spades.png",
+    ":/cardImages/cards_pngsource/queen_of_hearts.png",
+    ":/cardImages/cards_pngsource/queen_of_clubs.png",
+    ":/cardImages/cards_pngsource/queen_of_diamonds.png",
+
+    ":/cardImages/cards_pngsource/king_of_spades.png",
+    ":/cardImages/cards_pngsource/king_of_hearts.png",
+    ":/cardImages/cards_pngsource/king_of_clubs.png",
+    ":/cardImages/cards_pngsource/king_of_diamonds.png",
+
+    ":/cardImages/cards_pngsource/ace_of_spades.png",
+    ":/cardImages/cards_pngsource/ace_of_hearts.png",
+    ":/cardImages/cards_pngsource/ace_of_clubs.png",
+    ":/cardImages/cards_pngsource/ace_of_diamonds.png"};
+
+QString CardImages::imagePath(const Card &card)
+{
+    return QString::fromLatin1(images[card.getCode()]);
+}
+
+QString CardImages::backOfCard()
+{
+    return QStringLiteral(":/cardImages/cards_pngsource/back_of_card.png");
+}
@@ -0,0 +1,31 @@
+#ifndef CARDIMAGES_H
+#define CARDIMAGES_H
+
+#include "card.h"
+#include <QString>
+
+/**
+ * @brief The CardImages namespace maps cards to their image resources. It is view side only, the model just deals Card bytes
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/19/2025
+ */
+namespace CardImages
+{
+
+    /**
+     * @brief imagePath Gets the resource path of a card's image
+     * @param card The card to get the image of
+     * @return The path of the image for the card
+     */
+    QString imagePath(const Card &card);
+
+    /**
+     * @brief backOfCard Gets the resource path of the back of a card, used for the dealer's hidden card
+     * @return The path of the back of card image
+     */
+    QString backOfCard();
+
+}
+
+#endif // CARDIMAGES_H
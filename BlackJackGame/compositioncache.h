@@ -0,0 +1,202 @@
+#ifndef COMPOSITIONCACHE_H
+#define COMPOSITIONCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The CompositionCache class is a flat open addressing hash table that memoizes values by a ShoeComposition key and a small state.
+ * Every distinct (shoe, state) pair is stored exactly once, so recursions that reach the same composition by different draw orders share one entry.
+ * Lookups are a hash and a short linear probe with no allocation, which is far cheaper than std::unordered_map for the millions of entries
+ * a cold strategy computation creates.
+ * The table grows until it has room for its capacity and is never reallocated after that. Once full, a new value replaces the entry in its probe window
+ * that was last used the longest ago, counted in generations the owner starts between queries, so old shoes age out a slot at a time
+ * instead of the whole cache being dropped and rebuilt
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/27/2025
+ */
+template <typename Value>
+class CompositionCache
+{
+public:
+    /**
+     * @brief CompositionCache Constructor that creates an empty cache
+     * @param capacity The most values to keep, rounded up to a power of two. Past it, old values are replaced
+     */
+    explicit CompositionCache(std::size_t capacity = std::size_t(1) << 21) : table(initialCapacity), count(0), generation(1), maxSlots(initialCapacity)
+    {
+        while (maxSlots < capacity)
+            maxSlots *= 2;
+    }
+
+    /**
+     * @brief find Looks up a memoized value and marks it as used in the current generation
+     * @param shoe The ShoeComposition key
+     * @param state The state the value was computed for
+     * @return A pointer to the value, or nullptr if it isn't cached. Only valid until the next insert
+     */
+    const Value *find(uint64_t shoe, uint32_t state)
+    {
+        std::size_t mask = table.size() - 1;
+        std::size_t i = hash(shoe, state) & mask;
+        for (std::size_t probe = 0; probe < probeLimit; probe++, i = (i + 1) & mask)
+        {
+            Slot &slot = table[i];
+            if (slot.used == 0)
+                return nullptr;
+            if (slot.shoe == shoe && slot.state == state)
+            {
+                slot.used = generation;
+                return &slot.value;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief insert Memoizes a value, the pair must not already be cached
+     * @param shoe The ShoeComposition key
+     * @param state The state the value was computed for
+     * @param value The value to store
+     */
+    void insert(uint64_t shoe, uint32_t state, const Value &value)
+    {
+        // Keep the load under a half so probes stay short, until the table is as big as it may get
+        if ((count + 1) * 2 > table.size() && table.size() < maxSlots)
+            grow();
+
+        place(shoe, state, generation, value);
+    }
+
+    /**
+     * @brief nextGeneration Starts a new generation. Values used in it are replaced after every value last used in an earlier one
+     */
+    void nextGeneration()
+    {
+        generation++;
+
+        // Slots still marked with the far past read as recently used after the wrap, so age them all once
+        if (generation == 0)
+        {
+            for (Slot &slot : table)
+                slot.used = slot.used == 0 ? 0 : 1;
+            generation = 2;
+        }
+    }
+
+    /**
+     * @brief size Gets the number of cached values
+     */
+    std::size_t size() const { return count; }
+
+    /**
+     * @brief clear Removes every cached value, keeping the table to refill
+     */
+    void clear()
+    {
+        for (Slot &slot : table)
+            slot.used = 0;
+        count = 0;
+    }
+
+private:
+    /**
+     * @brief The Slot struct is one entry of the table
+     */
+    struct Slot
+    {
+        uint64_t shoe = 0;
+        uint32_t state = 0;
+
+        /**
+         * @brief used The generation the value was last used in, 0 for an empty slot
+         */
+        uint32_t used = 0;
+        Value value{};
+    };
+
+    /**
+     * @brief initialCapacity The number of slots in a new table, a power of two
+     */
+    static constexpr std::size_t initialCapacity = 1024;
+
+    /**
+     * @brief probeLimit The most slots a key may be stored away from its hash, which bounds every lookup once the table is full
+     */
+    static constexpr std::size_t probeLimit = 8;
+
+    /**
+     * @brief table The slots, its size is always a power of two. Not named slots, which Qt defines as a macro
+     */
+    std::vector<Slot> table;
+
+    /**
+     * @brief count The number of used slots
+     */
+    std::size_t count;
+
+    /**
+     * @brief generation The current generation, never 0 so it can't be mistaken for an empty slot
+     */
+    uint32_t generation;
+
+    /**
+     * @brief maxSlots The size the table stops growing at
+     */
+    std::size_t maxSlots;
+
+    /**
+     * @brief hash Mixes a key into a slot index
+     */
+    static std::size_t hash(uint64_t shoe, uint32_t state)
+    {
+        uint64_t hash = (shoe ^ (uint64_t(state) << 57 | state)) * 0x9e3779b97f4a7c15;
+        return static_cast<std::size_t>(hash ^ (hash >> 31));
+    }
+
+    /**
+     * @brief place Stores a value in the first free slot of its probe window, or over the least recently used value in it if there is none
+     */
+    void place(uint64_t shoe, uint32_t state, uint32_t used, const Value &value)
+    {
+        std::size_t mask = table.size() - 1;
+        std::size_t i = hash(shoe, state) & mask;
+        std::size_t victim = i;
+        for (std::size_t probe = 0; probe < probeLimit; probe++, i = (i + 1) & mask)
+        {
+            if (table[i].used == 0)
+            {
+                victim = i;
+                count++;
+                break;
+            }
+            if (table[i].used < table[victim].used)
+                victim = i;
+        }
+
+        table[victim].shoe = shoe;
+        table[victim].state = state;
+        table[victim].used = used;
+        table[victim].value = value;
+    }
+
+    /**
+     * @brief grow Doubles the table and rehashes every value
+     */
+    void grow()
+    {
+        std::vector<Slot> old(table.size() * 2);
+        old.swap(table);
+        count = 0;
+
+        for (const Slot &slot : old)
+        {
+            if (slot.used != 0)
+                place(slot.shoe, slot.state, slot.used, slot.value);
+        }
+    }
+};
+
+#endif // COMPOSITIONCACHE_H
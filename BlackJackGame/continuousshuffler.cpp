@@ -0,0 +1,34 @@
+/**
+ * @brief Implementation of The ContinuousShuffler class. It models a continuous shuffling machine that draws uniformly from the cards it holds
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/6/2025
+ */
+
+#include "continuousshuffler.h"
+#include "shufflekernel.h"
+#include <utility>
+
+ContinuousShuffler::ContinuousShuffler(int deckCount)
+{
+    cards.reserve(deckCount * Card::count);
+    for (int deck = 0; deck < deckCount; deck++)
+        for (unsigned int code = 0; code < Card::count; code++)
+            cards.push_back(Card::fromCode(static_cast<uint8_t>(code)));
+    remaining = static_cast<int>(cards.size());
+}
+
+Card ContinuousShuffler::draw(Rng &rng)
+{
+    // Move a random card from the machine to the front of the drawn cards
+    int index = static_cast<int>(ShuffleKernel::bounded(rng, remaining));
+    remaining--;
+    std::swap(cards[index], cards[remaining]);
+    return cards[remaining];
+}
+
+void ContinuousShuffler::returnDiscards()
+{
+    // Where the drawn cards land in the machine doesn't matter, every draw is uniform over the whole machine
+    remaining = static_cast<int>(cards.size());
+}
@@ -0,0 +1,67 @@
+#ifndef CONTINUOUSSHUFFLER_H
+#define CONTINUOUSSHUFFLER_H
+
+#include "card.h"
+#include "rng.h"
+#include <vector>
+
+/**
+ * @brief The ContinuousShuffler class models a continuous shuffling machine. Each draw picks one of the cards in the machine uniformly at random,
+ * and discards are returned in bulk at the end of a round.
+ * The cards sit in one array with the ones still in the machine first. A draw swaps a random card from that part to its end, like one step of
+ * a Fisher-Yates shuffle, so it costs one bounded random number. The drawn cards pile up behind the machine's cards in the same array,
+ * so returning them all just moves the boundary back
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/6/2025
+ */
+class ContinuousShuffler
+{
+public:
+    /**
+     * @brief ContinuousShuffler Constructor that loads the machine with whole decks
+     * @param deckCount The number of decks in the machine
+     */
+    explicit ContinuousShuffler(int deckCount = 1);
+
+    /**
+     * @brief draw Takes a random card out of the machine. The machine must not be empty
+     * @param rng The generator
+     * @return The card drawn
+     */
+    Card draw(Rng &rng);
+
+    /**
+     * @brief returnDiscards Puts every card drawn since the last return back into the machine
+     */
+    void returnDiscards();
+
+    /**
+     * @brief getRemaining Gets the number of cards in the machine
+     */
+    int getRemaining() const { return remaining; }
+
+    /**
+     * @brief getDiscardCount Gets the number of cards drawn since the last return
+     */
+    int getDiscardCount() const { return static_cast<int>(cards.size()) - remaining; }
+
+    /**
+     * @brief getDiscard Gets a card drawn since the last return
+     * @param index The index of the card, from 0 to getDiscardCount - 1, the most recent card last
+     */
+    Card getDiscard(int index) const { return cards[cards.size() - 1 - index]; }
+
+private:
+    /**
+     * @brief cards The cards in the machine, then the cards drawn from it with the most recent first
+     */
+    std::vector<Card> cards;
+
+    /**
+     * @brief remaining The number of cards in the machine, the rest of the array has been drawn
+     */
+    int remaining;
+};
+
+#endif // CONTINUOUSSHUFFLER_H
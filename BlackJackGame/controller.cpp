@@ -7,18 +7,29 @@
  */
 
 #include "controller.h"
+#include "bettingpolicy.h"
 #include "statistics.h"
-#include <QTimer>
+#include <stdexcept>
+
+/**
+ * @brief botBetting How the bots bet, a tenth of their money. The simulator's --bankroll mode measures how often it goes bankrupt
+ */
+static const BettingPolicy botBetting = BettingPolicy::proportional(10);
 
 Controller::Controller(QObject *parent) : QObject{parent}
 {
     botStrategy = new BotStrategy();
     timer = new TimerManager();
+    timerScope = timer->createScope();
 }
 
 Controller::~Controller()
 {
+    // The model writes to the history until it's gone
     delete model;
+    delete history;
+    delete replayer;
+    delete replayReader;
     delete botStrategy;
     delete timer;
 }
@@ -33,53 +44,66 @@ void Controller::checkTurnEnd(const Player &player)
         return;
     }
 
-    if (!player.isUser)
+    if (replayer)
+        replayMove();
+    else if (!player.isUser)
         botMove();
 }
 
 void Controller::onHit()
 {
-    model->hit(currentPlayerIndex);
+    model->apply(GameCommand{GAMECOMMAND::HIT, currentPlayerIndex});
     checkTurnEnd(model->getPlayer(currentPlayerIndex));
 }
 
 void Controller::onStand()
 {
-    model->stand(currentPlayerIndex);
+    model->apply(GameCommand{GAMECOMMAND::STAND, currentPlayerIndex});
     checkTurnEnd(model->getPlayer(currentPlayerIndex));
 }
 
 void Controller::onDoubleDown()
 {
-    const Player &player = model->getPlayer(currentPlayerIndex);
-    // Check if the player has enough money  and only 2 cards to double down
-    if (model->getOriginalPlayer(currentPlayerIndex).money < player.hand.getBet() || player.hand.getCards().size() != 2)
+    // Check if the rules, the player's money and the hand allow a double down
+    if (!model->canDouble(currentPlayerIndex))
     {
         return;
     }
-    model->doubleDown(currentPlayerIndex);
-    checkTurnEnd(player);
+    model->apply(GameCommand{GAMECOMMAND::DOUBLE_DOWN, currentPlayerIndex});
+    checkTurnEnd(model->getPlayer(currentPlayerIndex));
 }
 
 void Controller::onSplit()
 {
-    const Player &player = model->getPlayer(currentPlayerIndex);
-    // Check if the player has enough money to split
-    if (model->getOriginalPlayer(currentPlayerIndex).money < player.hand.getBet() || !botStrategy->isPair(player.hand))
+    // Check if the rules, the player's money and the hand allow a split
+    if (!model->canSplit(currentPlayerIndex))
     {
         return;
     }
-    model->split(currentPlayerIndex);
+    model->apply(GameCommand{GAMECOMMAND::SPLIT, currentPlayerIndex});
 
     // Update card positions and hand count
     emit splitPlayers(currentPlayerIndex, model->getPlayer(currentPlayerIndex), model->getPlayer(currentPlayerIndex + 1));
-    emit splitPlayerUpdateInfo(currentPlayerIndex, model->getPlayer(currentPlayerIndex), model->getOriginalPlayer(currentPlayerIndex).money);
     checkTurnEnd(model->getPlayer(currentPlayerIndex));
 }
 
+void Controller::onSurrender()
+{
+    if (!model->canSurrender(currentPlayerIndex))
+    {
+        return;
+    }
+    model->apply(GameCommand{GAMECOMMAND::SURRENDER, currentPlayerIndex});
+
+    // A surrendered hand is settled, so the turn moves on straight away
+    const Player &player = model->getPlayer(currentPlayerIndex);
+    emit playerUpdated(currentPlayerIndex, player, model->getOriginalPlayer(currentPlayerIndex).money, player.hand.getTotal());
+    advanceToNextPlayer();
+}
+
 void Controller::onBet(int bet)
 {
-    model->setPlayerBet(currentPlayerIndex, bet);
+    model->apply(GameCommand{GAMECOMMAND::BET, currentPlayerIndex, bet});
     advanceToNextBet();
 }
 
@@ -96,7 +120,7 @@ void Controller::advanceToNextPlayer()
     if (currentPlayerIndex >= model->getPlayerCount() || model->getDealerHand().getTotal() == 21)
     {
         if (onePlayerStillAlive())
-            model->dealerPlay();
+            model->apply(GameCommand{GAMECOMMAND::DEALER_PLAY});
         emit showDealerCard(true);
         emit dealerUpdated(model->getDealerHand(), model->getDealerHand().getTotal());
         return;
@@ -105,17 +129,19 @@ void Controller::advanceToNextPlayer()
     // Switch to next player
     const Player &player = model->getPlayer(currentPlayerIndex);
     emit currentPlayerTurn(currentPlayerIndex, model->getOriginalPlayer(currentPlayerIndex).money, player.hand.getBet(), player.hand.getTotal());
-    model->setPlayerActive(currentPlayerIndex);
+    model->apply(GameCommand{GAMECOMMAND::ACTIVATE, currentPlayerIndex});
 
-    if (!player.isUser)
+    if (replayer)
+        replayMove();
+    else if (!player.isUser)
         botMove();
 }
 
 bool Controller::onePlayerStillAlive()
 {
-    for (const Player &player : model->getAllPlayers())
+    for (PlayerView player : model->getPlayers())
     {
-        if (player.status == PLAYERSTATUS::STAND)
+        if (player.status() == PLAYERSTATUS::STAND)
             return true;
     }
     return false;
@@ -123,13 +149,13 @@ bool Controller::onePlayerStillAlive()
 
 void Controller::onDealerDonePlaying()
 {
-    model->endRound();
-    emit endRound(model->getAllPlayers());
+    model->apply(GameCommand{GAMECOMMAND::SETTLE});
+    emit endRound(model->getSnapshot());
 
     // If at least one user is not bankrupt, the game continues
-    for (int i = 0; i < model->getPlayerCount(); i++)
+    for (PlayerView player : model->getPlayers())
     {
-        if (model->getPlayer(i).isUser && model->getPlayer(i).status != PLAYERSTATUS::BANKRUPT)
+        if (player.isUser() && player.status() != PLAYERSTATUS::BANKRUPT)
             return;
     }
     emit gameOver();
@@ -137,10 +163,20 @@ void Controller::onDealerDonePlaying()
 
 void Controller::startBetting()
 {
+    // The replay ends with the history
+    if (replayer && !replayRoundReady && !replayer->nextRound(replayRound))
+    {
+        emit gameMessage("The hand history has no more rounds");
+        emit gameOver();
+        return;
+    }
+    replayRoundReady = false;
+    replayAction = 0;
+
     currentPlayerIndex = -1;
     emit showDealerCard(false);
     // Clear all hands and update view
-    model->clearHands();
+    model->apply(GameCommand{GAMECOMMAND::CLEAR});
     for (int i = 0; i < model->getPlayerCount(); i++)
     {
         const Player &player = model->getPlayer(i);
@@ -179,16 +215,20 @@ void Controller::advanceToNextBet()
     const Player &player = model->getPlayer(currentPlayerIndex);
     emit currentPlayerTurn(currentPlayerIndex, model->getOriginalPlayer(currentPlayerIndex).money, player.hand.getBet(), player.hand.getTotal());
 
-    if (!player.isUser)
+    if (replayer)
+        replayBet();
+    else if (!player.isUser)
         botBet();
 }
 
 void Controller::dealCards()
 {
     currentPlayerIndex = -1;
-    model->dealInitialCards();
+    if (replayer)
+        model->stackCards(replayRound.cards);
+    model->apply(GameCommand{GAMECOMMAND::DEAL});
 
-    emit updateAllPlayers(model->getAllPlayers());
+    emit updateAllPlayers(model->getSnapshot());
     emit showDealerCard(false);
     emit dealerUpdated(model->getDealerHand(), model->getDealerHand().getTotal());
 }
@@ -200,55 +240,186 @@ void Controller::onDealingAnimationComplete()
 
 void Controller::botMove()
 {
-    // Get the correct MOVE
+    // Get the correct MOVE for the table's rules and what the hand may do
     const Player &player = model->getPlayer(currentPlayerIndex);
-    MOVE move = botStrategy->getNextMove(player.hand, model->getDealerHand().getCards()[1]);
+    HandOptions options = model->getOptions(currentPlayerIndex);
+    MOVE move = botStrategy->getNextMove(player.hand, model->getDealerHand().getCards()[1], model->getRules(), options);
 
     unsigned int waitTime = 1000;
 
-    // Call the correct MOVE
-    if (move == MOVE::HIT)
-        QTimer::singleShot(waitTime, this, [=]()
-                           { onHit(); });
-    else if (move == MOVE::DOUBLE)
+    // Call the correct MOVE, hitting instead of one the hand can't make so the turn always moves on
+    if (move == MOVE::STAND)
+        timer->scheduleSingleShot(waitTime, [=]()
+                                  { onStand(); }, timerScope);
+    else if (move == MOVE::SURRENDER && options.canSurrender)
+        timer->scheduleSingleShot(waitTime, [=]()
+                                  { onSurrender(); }, timerScope);
+    else if (move == MOVE::DOUBLE && options.canDouble)
+        timer->scheduleSingleShot(waitTime, [=]()
+                                  { onDoubleDown(); }, timerScope);
+    else if (move == MOVE::SPLIT && options.canSplit)
+        timer->scheduleSingleShot(waitTime, [=]()
+                                  { onSplit(); }, timerScope);
+    else
+        timer->scheduleSingleShot(waitTime, [=]()
+                                  { onHit(); }, timerScope);
+}
+
+void Controller::botBet()
+{
+    const Player &player = model->getPlayer(currentPlayerIndex);
+    int bet = botBetting.getBet(player.money);
+    timer->scheduleSingleShot(500, [=]()
+                              { onBet(bet); }, timerScope);
+}
+
+void Controller::replayMove()
+{
+    if (replayAction >= replayRound.actions.size() || replayRound.actions[replayAction].hand != currentPlayerIndex)
     {
-        // If not enough money or too many cards to double down, hit instead
-        if (player.money < player.hand.getBet() || player.hand.getCards().size() != 2)
-        {
-            timer->scheduleSingleShot(waitTime, [=]()
-                                      { onHit(); });
-        }
-        else
-            timer->scheduleSingleShot(waitTime, [=]()
-                                      { onDoubleDown(); });
+        emit gameMessage("The replay has gone out of step with the hand history");
+        timer->scheduleSingleShot(1000, [=]()
+                                  { onStand(); }, timerScope);
+        return;
     }
+
+    MOVE move = replayRound.actions[replayAction++].move;
+    unsigned int waitTime = 1000;
+    if (move == MOVE::HIT)
+        timer->scheduleSingleShot(waitTime, [=]()
+                                  { onHit(); }, timerScope);
+    else if (move == MOVE::DOUBLE)
+        timer->scheduleSingleShot(waitTime, [=]()
+                                  { onDoubleDown(); }, timerScope);
     else if (move == MOVE::SPLIT)
-    {
         timer->scheduleSingleShot(waitTime, [=]()
-                                  { onSplit(); });
-    }
+                                  { onSplit(); }, timerScope);
+    else if (move == MOVE::SURRENDER)
+        timer->scheduleSingleShot(waitTime, [=]()
+                                  { onSurrender(); }, timerScope);
     else
         timer->scheduleSingleShot(waitTime, [=]()
-                                  { onStand(); });
+                                  { onStand(); }, timerScope);
 }
 
-void Controller::botBet()
+void Controller::replayBet()
 {
-    const Player &player = model->getPlayer(currentPlayerIndex);
-    int bet = std::max(player.money / 10, 1);
+    // Seats that didn't bet in the round are left with no bet
+    int bet = 0;
+    for (const HistoryBet &recorded : replayRound.bets)
+        if (recorded.seat == currentPlayerIndex)
+            bet = recorded.amount;
     timer->scheduleSingleShot(500, [=]()
-                              { onBet(bet); });
+                              { onBet(bet); }, timerScope);
+}
+
+void Controller::setReplay(const std::string &path, long long firstRound)
+{
+    delete replayer;
+    delete replayReader;
+    replayer = nullptr;
+    replayReader = nullptr;
+    replayFirstRound = firstRound;
+    if (path.empty())
+        return;
+
+    replayReader = new HandHistoryReader(path);
+    replayer = new HistoryReplayer(*replayReader);
+}
+
+void Controller::setSeed(uint64_t seed)
+{
+    fixedSeed = seed;
+}
+
+uint64_t Controller::getSeed() const
+{
+    return seed;
+}
+
+void Controller::setTimeScale(TIMESCALE scale)
+{
+    timer->setTimeScale(scale);
+}
+
+TimerManager *Controller::getTimer()
+{
+    return timer;
 }
 
-void Controller::createNewGame(std::vector<Player> players, int decks, int deterministic)
+const GameEventLog &Controller::getEvents() const
+{
+    return events;
+}
+
+void Controller::createNewGame(std::vector<Player> players, int decks, SHOEORDER order)
 {
     if (model != nullptr)
         delete model;
-    timer->cancelAllTimers();
-    model = new GameState(players, decks, deterministic);
+    delete history;
+    history = nullptr;
+    timer->cancelScope(timerScope);
+
+    replayRoundReady = false;
+    if (replayer)
+    {
+        replayer->seek(replayFirstRound);
+        replayRoundReady = replayer->nextRound(replayRound);
+        if (replayRoundReady && replayRound.dealt.size() == players.size())
+        {
+            // The seats start with the money they had, and the history's rules and decks replace the settings
+            std::vector<Player> recorded = HistoryReplayer::getPlayers(replayRound);
+            for (std::size_t seat = 0; seat < players.size(); seat++)
+            {
+                players[seat].money = recorded[seat].money;
+                players[seat].status = recorded[seat].status;
+            }
+            decks = replayReader->getHeader().deckCount;
+            order = SHOEORDER::RANDOM;
+        }
+        else
+        {
+            qWarning("The hand history doesn't have a round %lld for %d seats, so the game is played instead", replayFirstRound, static_cast<int>(players.size()));
+            setReplay("");
+            replayRoundReady = false;
+        }
+    }
+
+    // Logged so the session can be dealt again with --seed
+    seed = fixedSeed != 0 ? fixedSeed : Rng::randomSeed();
+    qInfo("Dealing from seed %llu", static_cast<unsigned long long>(seed));
+    model = new GameState(players, decks, order, Rng(seed));
+
+    // Keeps the reshuffle at the cut card from stalling the hand that reaches it
+    model->setBackgroundShuffle(true);
+
+    // The log carries on across games, its readers start over from the new players
+    model->setEvents(&events);
+
+    if (!historyPath.empty())
+    {
+        // A history that can't be written shouldn't stop the game
+        try
+        {
+            history = new HandHistoryWriter(historyPath, static_cast<int>(players.size()), decks);
+            model->setHistory(history);
+        }
+        catch (const std::runtime_error &error)
+        {
+            qWarning("%s", error.what());
+        }
+    }
+
+    // A replay's seats start with the history's money and status rather than the settings'
+    emit newGame(model->getSnapshot());
+}
+
+void Controller::setHistoryPath(const std::string &path)
+{
+    historyPath = path;
 }
 
 void Controller::onStopEverything()
 {
-    timer->cancelAllTimers();
+    timer->cancelScope(timerScope);
 }
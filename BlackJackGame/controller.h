@@ -7,6 +7,10 @@
 #include "playerStatus.h"
 #include "botstrategy.h"
 #include "timermanager.h"
+#include "handhistoryreader.h"
+#include "handhistorywriter.h"
+#include "historyreplayer.h"
+#include <string>
 
 using PlayerStatus::PLAYERSTATUS;
 
@@ -32,6 +36,51 @@ public:
      */
     ~Controller();
 
+    /**
+     * @brief setHistoryPath Records every game started after this to a hand history file, replaced by each new game
+     * @param path The file to write, empty to stop recording
+     */
+    void setHistoryPath(const std::string &path);
+
+    /**
+     * @brief setReplay Replays a hand history in every game started after this, from the given round on. Every seat bets and plays as recorded,
+     * with the recorded cards dealt, so the table shows the rounds as they were played. The game's seats have to match the history's.
+     * Throws std::runtime_error if the history can't be read
+     * @param path The hand history, empty to stop replaying
+     * @param firstRound The first round to show, counted from the start of the history
+     */
+    void setReplay(const std::string &path, long long firstRound = 0);
+
+    /**
+     * @brief setSeed Deals every game started after this from the given seed, so a session is dealt the same cards when it is played again
+     * @param seed The seed, 0 to draw a new one from std::random_device for each game
+     */
+    void setSeed(uint64_t seed);
+
+    /**
+     * @brief getSeed Gets the seed the current game's shoe was dealt from
+     * @return The seed, 0 before the first game
+     */
+    uint64_t getSeed() const;
+
+    /**
+     * @brief setTimeScale Changes how fast the table plays. Bots and the screens wait on the same clock, so they keep in step at any speed
+     * @param scale The time scale
+     */
+    void setTimeScale(TIMESCALE scale);
+
+    /**
+     * @brief getTimer Gets the timer the table runs on, shared with the screens so every wait is on one clock
+     * @return The timer
+     */
+    TimerManager *getTimer();
+
+    /**
+     * @brief getEvents Gets the log every change the model makes to the table is published to, for views to follow at their own pace
+     * @return The log
+     */
+    const GameEventLog &getEvents() const;
+
 public slots:
     /**
      * @brief onHit The current player chooses to hit
@@ -53,6 +102,11 @@ public slots:
      */
     void onSplit();
 
+    /**
+     * @brief onSurrender The current player chooses to surrender
+     */
+    void onSurrender();
+
     /**
      * @brief startRound The next round of betting starts
      */
@@ -88,9 +142,9 @@ public slots:
      * @brief createNewGame Create a new gamestate and initalizes blackjack with the set players with the given amount of money
      * @param players The number of players in the game
      * @param decks The number of decks to play with
-     * @param deterministic 0 = random shuffle, 1 = shuffle for single player, 2 = shuffle for 3 players
+     * @param order How the deck orders its cards, the tutorial deals a set order
      */
-    void createNewGame(std::vector<Player> players, int decks, int deterministic = 0);
+    void createNewGame(std::vector<Player> players, int decks, SHOEORDER order = SHOEORDER::RANDOM);
 signals:
     /**
      * @brief playerUpdated Signal that a player in the game has updated with their updated info
@@ -126,9 +180,9 @@ signals:
 
     /**
      * @brief endRound Signal that the round has ended
-     * @param players A vector of the players after the round has ended
+     * @param players A shared snapshot of the players after the round has ended
      */
-    void endRound(const std::vector<Player> &players);
+    void endRound(const RoundSnapshot &players);
 
     /**
      * @brief gameMessage Signal to send a game message (ex. player 0 has busted)
@@ -146,11 +200,17 @@ signals:
      */
     void endBetting();
 
+    /**
+     * @brief newGame Signal that a new game has been made, with its players as the model has them
+     * @param players A shared snapshot of the players before the first round
+     */
+    void newGame(const RoundSnapshot &players);
+
     /**
      * @brief updateAllPlayers Signal to update all of the players in the game
-     * @param players The vector of players to update in the view
+     * @param players A shared snapshot of the players to update in the view
      */
-    void updateAllPlayers(const std::vector<Player> &players);
+    void updateAllPlayers(const RoundSnapshot &players);
 
     /**
      * @brief splitPlayers Signal to split the player at the given index with the updated players
@@ -160,30 +220,82 @@ signals:
      */
     void splitPlayers(int originalIndex, const Player &originalPlayer, const Player &newPlayer);
 
-    /**
-     * @brief splitPlayerUpdateInfo Signal to playerinfoview to update player information
-     * @param originalIndex The index of the player to update
-     * @param originalPlayer The original player
-     * @param money Money of the first hand
-     */
-    void splitPlayerUpdateInfo(int originalIndex, const Player &originalPlayer, int money);
-
 private:
     /**
      * @brief model The Gamestate model that handles the players playing blackjack
      */
     GameState *model = nullptr;
 
+    /**
+     * @brief history The hand history of the current game, null when games aren't recorded
+     */
+    HandHistoryWriter *history = nullptr;
+
+    /**
+     * @brief historyPath The file games are recorded to, empty for none
+     */
+    std::string historyPath;
+
+    /**
+     * @brief fixedSeed The seed every new game is dealt from, 0 for a new one each game
+     */
+    uint64_t fixedSeed = 0;
+
+    /**
+     * @brief seed The seed the current game is dealt from
+     */
+    uint64_t seed = 0;
+
+    /**
+     * @brief replayReader The hand history being replayed, null when not replaying
+     */
+    HandHistoryReader *replayReader = nullptr;
+
+    /**
+     * @brief replayer Reads the rounds being replayed, null when not replaying
+     */
+    HistoryReplayer *replayer = nullptr;
+
+    /**
+     * @brief replayFirstRound The round each new game's replay starts from
+     */
+    long long replayFirstRound = 0;
+
+    /**
+     * @brief replayRound The round being replayed
+     */
+    HistoryRound replayRound;
+
+    /**
+     * @brief replayRoundReady True if replayRound has been read but not played yet
+     */
+    bool replayRoundReady = false;
+
+    /**
+     * @brief replayAction The index of the next recorded move of the round to play
+     */
+    std::size_t replayAction = 0;
+
     /**
      * @brief botPlayer The BotStrategy that determines the bot's move
      */
     BotStrategy *botStrategy;
 
     /**
-     * @brief timer The timer class to schedule all single shot calls
+     * @brief timer The timer class to schedule all single shot calls, shared with the screens
      */
     TimerManager *timer;
 
+    /**
+     * @brief timerScope The scope of the controller's own timers, so stopping them leaves the screens' alone
+     */
+    int timerScope;
+
+    /**
+     * @brief events The log the model publishes its changes to, kept from game to game
+     */
+    GameEventLog events;
+
     /**
      * @brief currentPlayerIndex The index of the current player in the round
      */
@@ -220,6 +332,16 @@ private:
      */
     void botBet();
 
+    /**
+     * @brief replayMove Performs the next recorded move of the round being replayed
+     */
+    void replayMove();
+
+    /**
+     * @brief replayBet Places the recorded bet of the current seat in the round being replayed
+     */
+    void replayBet();
+
     /**
      * @brief getPlayerMoney Returns the amount of money a player has
      * @param playerIndex the index of the player whose money to return
@@ -0,0 +1,177 @@
+/**
+ * @brief Implementation of The DealerProbabilities class. It computes and memoizes the distribution of the dealer's final total
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/27/2025
+ */
+
+#include "dealerprobabilities.h"
+#include <algorithm>
+
+/**
+ * @brief startState Added to the up card index for the state of a dealer who hasn't drawn the hole card yet.
+ * Mid hand states are hardTotal * 2 + hasAce, which are always smaller
+ */
+static const uint32_t startState = 64;
+
+DealerProbabilities::DealerProbabilities(bool hitsSoft17, std::size_t maxCacheEntries)
+    : hitsSoft17(hitsSoft17), cache(maxCacheEntries), current{}, currentValid(0) {}
+
+DealerProbabilities::Outcomes DealerProbabilities::get(int upIndex, const ShoeComposition &shoe)
+{
+    cache.nextGeneration();
+
+    ShoeComposition working = shoe;
+    return dealerStart(working, upIndex);
+}
+
+DealerProbabilities::Outcomes DealerProbabilities::getNoBlackjack(int upIndex, const ShoeComposition &shoe)
+{
+    return withoutBlackjack(get(upIndex, shoe));
+}
+
+DealerProbabilities::Outcomes DealerProbabilities::withoutBlackjack(const Outcomes &outcomes)
+{
+    Outcomes conditioned{};
+    double remaining = 1 - outcomes[blackjack];
+
+    // Only a shoe of nothing but blackjack cards gets here, count it as standing on 17 like an empty shoe
+    if (remaining <= 0)
+    {
+        conditioned[0] = 1;
+        return conditioned;
+    }
+
+    for (int i = 0; i < blackjack; i++)
+        conditioned[i] = outcomes[i] / remaining;
+    return conditioned;
+}
+
+void DealerProbabilities::reset(const ShoeComposition &shoe)
+{
+    this->shoe = shoe;
+    currentValid = 0;
+}
+
+void DealerProbabilities::removeCard(const Card &card)
+{
+    shoe.removeCard(card);
+    currentValid = 0;
+}
+
+void DealerProbabilities::addCard(const Card &card)
+{
+    shoe.addCard(card);
+    currentValid = 0;
+}
+
+const DealerProbabilities::Outcomes &DealerProbabilities::getCurrent(int upIndex)
+{
+    if (!(currentValid & (1u << upIndex)))
+    {
+        current[upIndex] = get(upIndex, shoe);
+        currentValid |= 1u << upIndex;
+    }
+    return current[upIndex];
+}
+
+const ShoeComposition &DealerProbabilities::getShoe() const
+{
+    return shoe;
+}
+
+std::size_t DealerProbabilities::getCacheSize() const
+{
+    return cache.size();
+}
+
+void DealerProbabilities::clearCache()
+{
+    cache.clear();
+}
+
+DealerProbabilities::Outcomes DealerProbabilities::dealerStart(ShoeComposition &shoe, int upIndex)
+{
+    uint32_t state = startState + static_cast<uint32_t>(upIndex);
+    if (const Outcomes *cached = cache.find(shoe.getKey(), state))
+        return *cached;
+
+    int upValue = ShoeComposition::hardValue(upIndex);
+    bool upAce = upIndex == ShoeComposition::aceIndex;
+
+    // The hole card that would give the dealer blackjack
+    int blackjackCard = -1;
+    if (upAce)
+        blackjackCard = ShoeComposition::tenIndex;
+    else if (upIndex == ShoeComposition::tenIndex)
+        blackjackCard = ShoeComposition::aceIndex;
+
+    Outcomes outcomes{};
+    if (shoe.getTotal() == 0)
+        return dealerFrom(shoe, upValue, upAce);
+
+    for (int i = 0; i < ShoeComposition::valueCount; i++)
+    {
+        if (shoe.getCount(i) == 0)
+            continue;
+
+        double probability = static_cast<double>(shoe.getCount(i)) / shoe.getTotal();
+        if (i == blackjackCard)
+        {
+            outcomes[blackjack] += probability;
+            continue;
+        }
+
+        shoe.remove(i);
+        Outcomes next = dealerFrom(shoe, upValue + ShoeComposition::hardValue(i), upAce || i == ShoeComposition::aceIndex);
+        shoe.add(i);
+
+        for (int j = 0; j < blackjack; j++)
+            outcomes[j] += probability * next[j];
+    }
+
+    cache.insert(shoe.getKey(), state, outcomes);
+    return outcomes;
+}
+
+DealerProbabilities::Outcomes DealerProbabilities::dealerFrom(ShoeComposition &shoe, int hardTotal, bool hasAce)
+{
+    Outcomes outcomes{};
+
+    bool soft = hasAce && hardTotal <= 11;
+    int total = soft ? hardTotal + 10 : hardTotal;
+    if (total > 21)
+    {
+        outcomes[bust] = 1;
+        return outcomes;
+    }
+
+    // An empty shoe never happens with a real cut card, count it as standing
+    bool stands = total > 17 || (total == 17 && !(hitsSoft17 && soft));
+    if (stands || shoe.getTotal() == 0)
+    {
+        outcomes[std::max(total, 17) - 17] = 1;
+        return outcomes;
+    }
+
+    uint32_t state = static_cast<uint32_t>(hardTotal * 2 + hasAce);
+    if (const Outcomes *cached = cache.find(shoe.getKey(), state))
+        return *cached;
+
+    for (int i = 0; i < ShoeComposition::valueCount; i++)
+    {
+        if (shoe.getCount(i) == 0)
+            continue;
+
+        double probability = static_cast<double>(shoe.getCount(i)) / shoe.getTotal();
+        shoe.remove(i);
+        Outcomes next = dealerFrom(shoe, hardTotal + ShoeComposition::hardValue(i), hasAce || i == ShoeComposition::aceIndex);
+        shoe.add(i);
+
+        for (int j = 0; j < blackjack; j++)
+            outcomes[j] += probability * next[j];
+    }
+
+    cache.insert(shoe.getKey(), state, outcomes);
+    return outcomes;
+}
@@ -0,0 +1,154 @@
+#ifndef DEALERPROBABILITIES_H
+#define DEALERPROBABILITIES_H
+
+#include "card.h"
+#include "compositioncache.h"
+#include "shoecomposition.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief The DealerProbabilities class computes the exact distribution of the dealer's final total for an up card and a shoe.
+ * The dealer stands on 17s or hits soft 17 like GameState::dealerPlay, depending on the rules. Every result is memoized by the shoe's composition key,
+ * so once a composition has been seen its distribution is a single table lookup.
+ * It can also follow a shoe as cards are dealt: removing or returning a card updates the tracked key in O(1),
+ * and the distribution for each up card is only recomputed the first time it's asked for at a new composition
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/27/2025
+ */
+class DealerProbabilities
+{
+public:
+    /**
+     * @brief Outcomes The probability of the dealer finishing on 17, 18, 19, 20, 21, busting, or having blackjack, in that order
+     */
+    using Outcomes = std::array<double, 7>;
+
+    /**
+     * @brief bust The index of busting in Outcomes
+     */
+    static constexpr int bust = 5;
+
+    /**
+     * @brief blackjack The index of a dealer blackjack in Outcomes
+     */
+    static constexpr int blackjack = 6;
+
+    /**
+     * @brief DealerProbabilities Constructor for the engine
+     * @param hitsSoft17 True if the dealer hits soft 17, false if they stand on all 17s
+     * @param maxCacheEntries The number of memoized distributions to keep, the least recently used are replaced past it
+     */
+    explicit DealerProbabilities(bool hitsSoft17 = false, std::size_t maxCacheEntries = 1 << 21);
+
+    /**
+     * @brief get Gets the distribution of the dealer's final total, including blackjack
+     * @param upIndex The ShoeComposition index of the dealer's up card
+     * @param shoe The cards the dealer could draw, including the hole card
+     * @return The probability of each outcome
+     */
+    Outcomes get(int upIndex, const ShoeComposition &shoe);
+
+    /**
+     * @brief getNoBlackjack Gets the distribution of the dealer's final total given the dealer doesn't have blackjack.
+     * This is what players face when they get to act
+     * @param upIndex The ShoeComposition index of the dealer's up card
+     * @param shoe The cards the dealer could draw, including the hole card
+     * @return The probability of each outcome, with blackjack always 0
+     */
+    Outcomes getNoBlackjack(int upIndex, const ShoeComposition &shoe);
+
+    /**
+     * @brief withoutBlackjack Conditions a distribution on the dealer not having blackjack
+     * @param outcomes The full distribution
+     * @return The distribution rescaled without blackjack
+     */
+    static Outcomes withoutBlackjack(const Outcomes &outcomes);
+
+    /**
+     * @brief reset Starts tracking a shoe
+     * @param shoe The cards left in the shoe
+     */
+    void reset(const ShoeComposition &shoe);
+
+    /**
+     * @brief removeCard Removes a dealt card from the tracked shoe
+     * @param card The card that was dealt
+     */
+    void removeCard(const Card &card);
+
+    /**
+     * @brief addCard Returns a card to the tracked shoe
+     * @param card The card to return
+     */
+    void addCard(const Card &card);
+
+    /**
+     * @brief getCurrent Gets the distribution for the tracked shoe, constant time once computed for its composition
+     * @param upIndex The ShoeComposition index of the dealer's up card
+     * @return The probability of each outcome, including blackjack
+     */
+    const Outcomes &getCurrent(int upIndex);
+
+    /**
+     * @brief getShoe Gets the tracked shoe
+     */
+    const ShoeComposition &getShoe() const;
+
+    /**
+     * @brief getCacheSize Gets the number of memoized distributions
+     */
+    std::size_t getCacheSize() const;
+
+    /**
+     * @brief clearCache Removes every memoized distribution
+     */
+    void clearCache();
+
+private:
+    /**
+     * @brief hitsSoft17 True if the dealer hits soft 17
+     */
+    bool hitsSoft17;
+
+    /**
+     * @brief cache Distributions by shoe and dealer state, see dealerFrom and dealerStart for the states
+     */
+    CompositionCache<Outcomes> cache;
+
+    /**
+     * @brief shoe The tracked shoe
+     */
+    ShoeComposition shoe;
+
+    /**
+     * @brief current The distribution of each up card for the tracked shoe
+     */
+    std::array<Outcomes, ShoeComposition::valueCount> current;
+
+    /**
+     * @brief currentValid A bit per up card, set when current holds its distribution for the tracked shoe
+     */
+    uint32_t currentValid;
+
+    /**
+     * @brief dealerStart Computes the distribution from the up card, drawing the hole card
+     * @param shoe The cards the dealer can draw, restored before returning
+     * @param upIndex The index of the up card
+     * @return The probability of each outcome
+     */
+    Outcomes dealerStart(ShoeComposition &shoe, int upIndex);
+
+    /**
+     * @brief dealerFrom Computes the distribution from a hand state, drawing until the dealer stands
+     * @param shoe The cards the dealer can draw, restored before returning
+     * @param hardTotal The dealer's total with aces counted as 1
+     * @param hasAce True if the dealer holds an ace
+     * @return The probability of each outcome
+     */
+    Outcomes dealerFrom(ShoeComposition &shoe, int hardTotal, bool hasAce);
+};
+
+#endif // DEALERPROBABILITIES_H
@@ -9,43 +9,58 @@
 #include "deck.h"
 #include "suits.h"
 #include "rank.h"
-#include <algorithm>
 #include <random>
-#include <QRandomGenerator>
 
-Deck::Deck(int deckNumber, int deterministic) : deterministic(deterministic)
+Deck::Deck(int deckNumber, SHOEORDER order, Rng rng, double penetration)
+    : penetration(penetration), order(order), rng(rng), deckNumber(deckNumber), fullShoe(deckNumber), counter(SYSTEM::HILO, deckNumber), machine(deckNumber)
 {
     createDeck();
-
-    // Insert master deck into shuffled deck deckNumber times (creates a deck the size of deckNumber)
-    for (int i = 0; i < deckNumber; i++)
-        shuffledDeck.insert(shuffledDeck.end(), masterDeck.begin(), masterDeck.end());
-
+    fillShoe();
     shuffle();
 }
 
 void Deck::createDeck()
 {
-    masterDeck.reserve(52);
-    unsigned int i = 0;
+    masterDeck.reserve(Card::count);
 
     // Creates a deck of all 52 cards
     for (RANK rank : Rank::allRanks)
         for (SUIT suit : Suit::allSuits)
-            masterDeck.emplace_back(suit, rank, Card::getImageFromVector(i++));
+            masterDeck.emplace_back(suit, rank);
+}
+
+void Deck::fillShoe()
+{
+    // Insert master deck into shuffled deck deckNumber times (creates a deck the size of deckNumber)
+    shuffledDeck.clear();
+    for (int i = 0; i < deckNumber; i++)
+        shuffledDeck.insert(shuffledDeck.end(), masterDeck.begin(), masterDeck.end());
 }
 
 void Deck::shuffle()
 {
-    // Random shuffle
-    if (deterministic == 0)
+    // Shuffling a continuous shuffler just puts every card back in
+    if (continuous)
+    {
+        returnDiscards();
+        return;
+    }
+
+    // Random shuffle, swapped in ready made when shuffling in the background
+    if (order == SHOEORDER::RANDOM)
     {
-        std::default_random_engine rand(std::random_device{}());
-        std::shuffle(shuffledDeck.begin(), shuffledDeck.end(), rand);
+        // Every shoe gets its own seed so it can be shuffled again from the hand history
+        if (pool)
+            shoeSeed = pool->swap(shuffledDeck);
+        else
+        {
+            shoeSeed = rng();
+            ShuffleKernel::shuffleFromSeed(shuffledDeck, shoeSeed, shuffleModel);
+        }
         currentDeckIndex = 0;
     }
     // Tutorial ordered deck
-    else if (deterministic == 1)
+    else if (order == SHOEORDER::TUTORIAL)
     {
         const std::initializer_list<const char *> tutorialOrder = {
             "7C",
@@ -127,17 +142,14 @@ void Deck::shuffle()
             Rank::RANK r = charToRank(code[0]);
             Suit::SUIT s = charToSuit(code[1]);
 
-            // Find the matching card in masterDeck
-            auto it = std::find_if(masterDeck.begin(), masterDeck.end(), [&](const Card &c)
-                                   { return c.getRank() == r && c.getSuit() == s; });
-            if (it != masterDeck.end())
-                shuffledDeck.push_back(*it);
+            shuffledDeck.emplace_back(s, r);
         }
 
         // Fill the rest of shuffled deck with random cards
+        std::uniform_int_distribution<int> cardIndex(0, 51);
         for (int i = shuffledDeck.size(); i < 52 * 2; i++)
         {
-            shuffledDeck.push_back(masterDeck[QRandomGenerator::global()->bounded(52)]);
+            shuffledDeck.push_back(masterDeck[cardIndex(rng)]);
         }
     }
     // Sets the entire deck to TWO of SPADES
@@ -147,28 +159,224 @@ void Deck::shuffle()
         // All twos baby
         for (int i = 0; i < 100; i++)
         {
-            shuffledDeck.emplace_back(SUIT::SPADES, RANK::TWO, Card::getImageFromVector(0));
+            shuffledDeck.emplace_back(SUIT::SPADES, RANK::TWO);
         }
     }
+
+    // A random shuffle always starts from the whole shoe, so there is nothing to recount
+    if (order == SHOEORDER::RANDOM)
+        remaining = fullShoe;
+    else
+        resetComposition();
+    counter.reset();
+    shoeNumber++;
+    shuffleIndex = currentDeckIndex;
+    updateCut();
 }
 
-Card Deck::getNextCard()
+void Deck::updateCut()
 {
-    // Reshuffles if inside the last 20% of the deck
-    if (currentDeckIndex > (shuffledDeck.size() * 0.8))
+    cutIndex = stackedIndex < stacked.size() ? -1 : static_cast<int>(shuffledDeck.size() * penetration);
+}
+
+void Deck::stack(const std::vector<Card> &cards)
+{
+    stacked = cards;
+    stackedIndex = 0;
+    updateCut();
+}
+
+void Deck::reseed(uint64_t seed)
+{
+    // A casino shuffle works from the last shoe, so even the order of the cards goes back to how a new deck has them
+    bool background = static_cast<bool>(pool);
+    setBackgroundShuffle(false);
+    rng = Rng(seed);
+    stacked.clear();
+    stackedIndex = 0;
+
+    if (continuous)
     {
+        machine = ContinuousShuffler(deckNumber);
+        remaining = fullShoe;
+        counter.reset();
+        shoeSeed = 0;
+    }
+    else
+    {
+        fillShoe();
+        currentDeckIndex = 0;
+        shuffle();
+    }
+    setBackgroundShuffle(background);
+}
+
+SHOEORDER Deck::getOrder() const
+{
+    return order;
+}
+
+void Deck::setBackgroundShuffle(bool enabled)
+{
+    if (order != SHOEORDER::RANDOM || (enabled && continuous) || enabled == static_cast<bool>(pool))
+        return;
+
+    // The pool takes over the generator and hands it back when stopped, so no shuffle is ever repeated
+    if (enabled)
+        pool = std::make_unique<ShoePool>(shuffledDeck, rng, shuffleModel);
+    else
+    {
+        rng = pool->stop();
+        pool.reset();
+    }
+}
+
+void Deck::setContinuousShuffle(bool enabled)
+{
+    if (order != SHOEORDER::RANDOM || enabled == continuous)
+        return;
+
+    // Either way the dealing starts over from a full set of cards
+    continuous = enabled;
+    if (continuous)
+    {
+        setBackgroundShuffle(false);
+        machine = ContinuousShuffler(deckNumber);
+        remaining = fullShoe;
+        counter.reset();
+    }
+    else
         shuffle();
+}
+
+void Deck::returnDiscards()
+{
+    if (!continuous)
+        return;
+
+    machine.returnDiscards();
+    remaining = fullShoe;
+    counter.reset();
+}
+
+void Deck::setShuffleModel(const ShuffleModel &model)
+{
+    // Shoes the pool already shuffled were done the old way, so restart it
+    bool background = static_cast<bool>(pool);
+    setBackgroundShuffle(false);
+    shuffleModel = model;
+    setBackgroundShuffle(background);
+}
+
+const ShuffleModel &Deck::getShuffleModel() const
+{
+    return shuffleModel;
+}
+
+uint64_t Deck::getShoeSeed() const
+{
+    return shoeSeed;
+}
+
+long long Deck::getShoeNumber() const
+{
+    return shoeNumber;
+}
+
+long long Deck::getShuffleWaitCount() const
+{
+    return pool ? pool->getWaitCount() : 0;
+}
+
+void Deck::resetComposition()
+{
+    remaining.clear();
+    for (int i = currentDeckIndex; i < static_cast<int>(shuffledDeck.size()); i++)
+        remaining.addCard(shuffledDeck[i]);
+}
+
+Card Deck::getNextCard()
+{
+    if (continuous)
+    {
+        // Only a round bigger than the machine could empty it, so take the discards back early
+        if (machine.getRemaining() == 0)
+            returnDiscards();
+
+        Card card = machine.draw(rng);
+        remaining.removeCard(card);
+        counter.count(card);
+        return card;
+    }
+
+    // Reshuffles once the cut card is passed. Stacked cards move the cut card so only this path checks for them
+    if (currentDeckIndex > cutIndex)
+    {
+        if (stackedIndex < stacked.size())
+        {
+            Card card = stacked[stackedIndex++];
+            if (stackedIndex == stacked.size())
+                updateCut();
+            return card;
+        }
+
         currentDeckIndex = 0;
+        shuffle();
     }
 
-    return shuffledDeck[currentDeckIndex++];
+    const Card &card = shuffledDeck[currentDeckIndex++];
+    remaining.removeCard(card);
+    counter.count(card);
+    return card;
 }
 
 bool Deck::isEmpty() const
 {
+    if (continuous)
+        return machine.getRemaining() == 0;
     return currentDeckIndex >= static_cast<int>(shuffledDeck.size());
 }
 
+const ShoeComposition &Deck::getComposition() const
+{
+    return remaining;
+}
+
+void Deck::setCountingSystem(SYSTEM system)
+{
+    counter = CardCounter(system, deckNumber);
+
+    // Recount every card dealt since the last shuffle, the order doesn't matter to a count
+    if (continuous)
+    {
+        for (int i = 0; i < machine.getDiscardCount(); i++)
+            counter.count(machine.getDiscard(i));
+        return;
+    }
+    for (int i = shuffleIndex; i < currentDeckIndex; i++)
+        counter.count(shuffledDeck[i]);
+}
+
+const CardCounter &Deck::getCounter() const
+{
+    return counter;
+}
+
+int Deck::getRunningCount() const
+{
+    return counter.getRunningCount();
+}
+
+double Deck::getTrueCount() const
+{
+    return counter.getTrueCount(remaining.getTotal());
+}
+
+double Deck::getDecksRemaining() const
+{
+    return CardCounter::decksRemaining(remaining.getTotal());
+}
+
 Rank::RANK Deck::charToRank(char c)
 {
     switch (c)
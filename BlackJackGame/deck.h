@@ -2,8 +2,18 @@
 #define DECK_H
 
 #include "card.h"
+#include "cardcounter.h"
+#include "continuousshuffler.h"
+#include "rng.h"
+#include "shoecomposition.h"
+#include "shoeorder.h"
+#include "shoepool.h"
+#include "shufflekernel.h"
+#include <memory>
 #include <vector>
 
+using ShoeOrder::SHOEORDER;
+
 /**
  * @brief The Deck class represents one or more standard 52-card decks.
  * Provides a shuffle (random or determined) and card dealing functionality
@@ -17,9 +27,11 @@ public:
     /**
      * @brief Deck The constructor for the deck class
      * @param deckNumber The number of decks to use in the shuffled deck
-     * @param deterministic 0 = random shuffle, 1 = shuffle for single player, 2 = shuffle for 3 players
+     * @param order How the cards are ordered on each shuffle
+     * @param rng The random number generator used for every shuffle, seeded from std::random_device by default
+     * @param penetration The fraction of the deck dealt before it is reshuffled
      */
-    Deck(int deckNumber = 1, int deterministic = 0);
+    Deck(int deckNumber = 1, SHOEORDER order = SHOEORDER::RANDOM, Rng rng = Rng(), double penetration = 0.8);
 
     /**
      * @brief shuffle Shuffes the shuffleDeck so it is randomized
@@ -27,9 +39,75 @@ public:
     void shuffle();
 
     /**
-     * @brief deterministicShuffle Shuffles the deck in a deterministic state
+     * @brief reseed Starts the deck over from a seed and a new deck's card order. The same seed always deals the same cards from here on, whatever was dealt before
+     * and whether or not shoes are shuffled in the background, so a session can be played again card for card. Stacked cards are dropped
+     * @param seed The seed
+     */
+    void reseed(uint64_t seed);
+
+    /**
+     * @brief getOrder Gets how the cards are ordered on each shuffle
+     * @return The shoe order
+     */
+    SHOEORDER getOrder() const;
+
+    /**
+     * @brief setBackgroundShuffle Starts or stops shuffling the next shoes on a background thread, so reaching the cut card only swaps in a ready shoe.
+     * A seeded deck deals the same shoes either way. Only random shoes use it, the tutorial decks and continuous shuffling machines never do
+     * @param enabled True to shuffle in the background
      */
-    void deterministicShuffle();
+    void setBackgroundShuffle(bool enabled);
+
+    /**
+     * @brief setContinuousShuffle Switches between dealing a shoe to the cut card and dealing from a continuous shuffling machine.
+     * The machine draws every card at random from the cards it holds, and the cards dealt go back in when the discards are returned
+     * @param enabled True to deal from a continuous shuffling machine
+     */
+    void setContinuousShuffle(bool enabled);
+
+    /**
+     * @brief returnDiscards Puts the cards dealt since the last return back into the continuous shuffling machine, does nothing for a shoe
+     */
+    void returnDiscards();
+
+    /**
+     * @brief setShuffleModel Changes how random shuffles are done, from the next shuffle on
+     * @param model The uniform shuffle or a casino procedure
+     */
+    void setShuffleModel(const ShuffleModel &model);
+
+    /**
+     * @brief getShuffleModel Gets how random shuffles are done
+     * @return The shuffle model
+     */
+    const ShuffleModel &getShuffleModel() const;
+
+    /**
+     * @brief getShoeSeed Gets the seed the current shoe was shuffled with by ShuffleKernel::shuffleFromSeed.
+     * A uniform shoe can be shuffled again from the seed alone, a casino shoe also needs the last shoe. 0 for the tutorial decks and continuous shuffling machines
+     * @return The seed of the current shoe
+     */
+    uint64_t getShoeSeed() const;
+
+    /**
+     * @brief getShoeNumber Gets the number of shuffles so far, which goes up whenever a new shoe starts being dealt
+     * @return The number of the current shoe, starting at 1
+     */
+    long long getShoeNumber() const;
+
+    /**
+     * @brief getShuffleWaitCount Gets how many times the deck had to wait for the background thread to finish a shoe
+     * @return The number of waits, 0 when shuffling in place
+     */
+    long long getShuffleWaitCount() const;
+
+    /**
+     * @brief stack Deals the given cards next, in order, ahead of the shoe, which carries on where it was once they run out.
+     * Stacked cards aren't part of the shoe, so they don't change its composition or count. Used to replay a recorded round.
+     * Not used by a continuous shuffling machine
+     * @param cards The cards to deal, replacing any stacked cards not dealt yet
+     */
+    void stack(const std::vector<Card> &cards);
 
     /**
      * @brief getNextCard Gets the next card in the shuffled deck and moves the index to the next card
@@ -43,6 +121,42 @@ public:
      */
     bool isEmpty() const;
 
+    /**
+     * @brief getComposition Gets the values of the cards that have not been dealt yet
+     * @return The composition of the rest of the shuffled deck
+     */
+    const ShoeComposition &getComposition() const;
+
+    /**
+     * @brief setCountingSystem Changes the counting system and recounts the cards dealt since the last shuffle
+     * @param system The counting system to keep
+     */
+    void setCountingSystem(SYSTEM system);
+
+    /**
+     * @brief getCounter Gets the counter that is updated on every card dealt and reset on every shuffle
+     * @return The card counter of the deck
+     */
+    const CardCounter &getCounter() const;
+
+    /**
+     * @brief getRunningCount Gets the running count of the cards dealt since the last shuffle
+     * @return The running count
+     */
+    int getRunningCount() const;
+
+    /**
+     * @brief getTrueCount Gets the running count per deck remaining
+     * @return The true count
+     */
+    double getTrueCount() const;
+
+    /**
+     * @brief getDecksRemaining Gets the number of decks that have not been dealt yet
+     * @return The decks remaining, as a fraction
+     */
+    double getDecksRemaining() const;
+
 private:
     /**
      * @brief masterDeck The master deck holding all 52 cards in order
@@ -60,15 +174,110 @@ private:
     int currentDeckIndex = 0;
 
     /**
-     * @brief deterministic 0 = random shuffle, 1 = shuffle for single player, 2 = shuffle for 3 players
+     * @brief penetration The fraction of the deck dealt before it is reshuffled
+     */
+    double penetration;
+
+    /**
+     * @brief cutIndex The index of the cut card, worked out on each shuffle so dealing only compares two ints
+     */
+    int cutIndex = 0;
+
+    /**
+     * @brief shuffleIndex The index of the shuffled deck at the last shuffle, the tutorial deck keeps dealing on from where it was
+     */
+    int shuffleIndex = 0;
+
+    /**
+     * @brief order How the cards are ordered on each shuffle
+     */
+    SHOEORDER order;
+
+    /**
+     * @brief rng The random number generator for shuffling. Seeded once so shuffles are cheap and reproducible
+     */
+    Rng rng;
+
+    /**
+     * @brief remaining The composition of the cards not dealt yet, updated on every card dealt
+     */
+    ShoeComposition remaining;
+
+    /**
+     * @brief deckNumber The number of decks in the shoe
      */
-    int deterministic;
+    int deckNumber;
+
+    /**
+     * @brief fullShoe The composition of the whole shoe, what is left right after a random shuffle
+     */
+    ShoeComposition fullShoe;
+
+    /**
+     * @brief counter The count of the cards dealt since the last shuffle
+     */
+    CardCounter counter;
+
+    /**
+     * @brief shuffleModel How random shuffles are done
+     */
+    ShuffleModel shuffleModel;
+
+    /**
+     * @brief shoeSeed The seed the current shoe was shuffled with
+     */
+    uint64_t shoeSeed = 0;
+
+    /**
+     * @brief shoeNumber The number of shuffles so far
+     */
+    long long shoeNumber = 0;
+
+    /**
+     * @brief stacked The cards set to be dealt ahead of the shoe
+     */
+    std::vector<Card> stacked;
+
+    /**
+     * @brief stackedIndex The index of the next stacked card to deal
+     */
+    std::size_t stackedIndex = 0;
+
+    /**
+     * @brief continuous True if cards are dealt from the continuous shuffling machine instead of the shoe
+     */
+    bool continuous = false;
+
+    /**
+     * @brief machine The continuous shuffling machine, only used when continuous is set
+     */
+    ContinuousShuffler machine;
+
+    /**
+     * @brief pool The background shuffler, null when shuffling in place
+     */
+    std::unique_ptr<ShoePool> pool;
+
+    /**
+     * @brief updateCut Works out the cut card from the penetration, or puts it before the current card while cards are stacked so dealing takes the cut card path
+     */
+    void updateCut();
+
+    /**
+     * @brief resetComposition Recounts the remaining composition from the current index of the shuffled deck
+     */
+    void resetComposition();
 
     /**
      * @brief createDeck Creates a full 52 card deck in number order. Suit goes
      */
     void createDeck();
 
+    /**
+     * @brief fillShoe Puts every card of every deck into the shuffled deck in number order, the order every random shoe is first shuffled from
+     */
+    void fillShoe();
+
     /**
      * @brief charToRank Converts a char from 2 - 9, A, K, Q, J, T to their RANK
      * @param c The char to convert
@@ -0,0 +1,345 @@
+/**
+ * @brief Implementation of The EVEngine class. It computes composition dependent expected values for every move of a hand
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/26/2025
+ */
+
+#include "evengine.h"
+#include <algorithm>
+
+/**
+ * @brief splitLevelWeight When the split hands that took a given number of pair cards add up to fewer expected hands than this,
+ * they are valued with the shoe of the last number solved instead of solving another
+ */
+static const double splitLevelWeight = 1e-3;
+
+/**
+ * @brief The SplitDeal struct holds one split while EVEngine::dealSplitCards follows the ways it can be dealt
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/9/2025
+ */
+struct EVEngine::SplitDeal
+{
+    /**
+     * @brief pairCards The unseen cards that would resplit, before any are drawn. Fractional for tens
+     */
+    double pairCards = 0;
+
+    /**
+     * @brief shoeTotal The unseen cards before any are drawn
+     */
+    int shoeTotal = 0;
+
+    /**
+     * @brief mostHands The most hands the split may make
+     */
+    int mostHands = 2;
+
+    /**
+     * @brief canResplit True if a pair card drawn to a split hand may split again
+     */
+    bool canResplit = true;
+
+    /**
+     * @brief drawnHands The expected number of hands that drew a card they couldn't split with, by the number of pair cards the split took
+     */
+    std::array<double, 2 * SplitOutcome::mostHands> drawnHands{};
+
+    /**
+     * @brief pairHands The expected number of hands that drew a pair card they couldn't split with, by the number of pair cards the split took
+     */
+    std::array<double, 2 * SplitOutcome::mostHands> pairHands{};
+
+    /**
+     * @brief handChances The chance of the split ending with each number of hands
+     */
+    std::array<double, SplitOutcome::mostHands + 1> handChances{};
+};
+
+MOVE MoveValues::getBestMove() const
+{
+    MOVE best = MOVE::STAND;
+    double bestValue = stand;
+
+    if (hit > bestValue)
+    {
+        best = MOVE::HIT;
+        bestValue = hit;
+    }
+    if (canDouble && doubleDown > bestValue)
+    {
+        best = MOVE::DOUBLE;
+        bestValue = doubleDown;
+    }
+    if (canSplit && split > bestValue)
+    {
+        best = MOVE::SPLIT;
+        bestValue = split;
+    }
+    if (canSurrender && surrender > bestValue)
+        best = MOVE::SURRENDER;
+
+    return best;
+}
+
+EVEngine::EVEngine(const TableRules &rules, std::size_t maxCacheEntries)
+    : dealer(rules.dealerHitsSoft17, maxCacheEntries), hitCache(maxCacheEntries), splitCache(maxCacheEntries), doubleAfterSplit(rules.doubleAfterSplit), resplitAces(rules.resplitAces),
+      hitSplitAces(rules.hitSplitAces), splitHands(rules.maxSplitHands == 0 ? SplitOutcome::mostHands : std::min(rules.maxSplitHands, SplitOutcome::mostHands)) {}
+
+MoveValues EVEngine::evaluate(const Hand &hand, int upIndex, const ShoeComposition &unseen, int handCount)
+{
+    ageCache();
+
+    ShoeComposition shoe = unseen;
+    MoveValues values;
+
+    int total = hand.getTotal();
+    bool soft = hand.isSoft();
+    int hardTotal = soft ? total - 10 : total;
+
+    values.stand = standValue(shoe, upIndex, total);
+    values.hit = hitValue(shoe, upIndex, hardTotal, soft);
+
+    values.canDouble = hand.getCards().size() == 2;
+    if (values.canDouble)
+        values.doubleDown = doubleValue(shoe, upIndex, hardTotal, soft);
+
+    values.canSplit = hand.isPair();
+    if (values.canSplit)
+        values.split = getSplitOutcome(ShoeComposition::indexOf(hand.getCards()[0]), upIndex, unseen, handCount).value;
+
+    return values;
+}
+
+MOVE EVEngine::getBestMove(const Hand &hand, int upIndex, const ShoeComposition &unseen)
+{
+    return evaluate(hand, upIndex, unseen).getBestMove();
+}
+
+SplitOutcome EVEngine::getSplitOutcome(int pairIndex, int upIndex, const ShoeComposition &unseen, int handCount)
+{
+    ageCache();
+
+    // The seat's other hands count toward the limit, but a pair that may split always makes two
+    int mostHands = std::max(2, splitHands - handCount + 1);
+    uint32_t state = static_cast<uint32_t>((pairIndex * ShoeComposition::valueCount + upIndex) * 8 + mostHands);
+    if (const SplitOutcome *cached = splitCache.find(unseen.getKey(), state))
+        return *cached;
+
+    SplitDeal split;
+    split.pairCards = pairIndex == ShoeComposition::tenIndex ? unseen.getCount(pairIndex) / 4.0 : unseen.getCount(pairIndex);
+    split.shoeTotal = unseen.getTotal();
+    split.mostHands = mostHands;
+    split.canResplit = pairIndex != ShoeComposition::aceIndex || resplitAces;
+    dealSplitCards(1, 0, 0, 2, 2, 0, split);
+
+    // Every hand is valued with all the pair cards the split took gone, the other cards dealt to the split are unknown to it
+    SplitOutcome outcome;
+    outcome.value = 0;
+    ShoeComposition shoe = unseen;
+    double drawnValue = 0;
+    double pairValue = 0;
+    bool drawnSolved = false;
+    bool pairSolved = false;
+    for (int pairsDrawn = 0; pairsDrawn < static_cast<int>(split.drawnHands.size()); pairsDrawn++)
+    {
+        if (pairsDrawn > 0)
+        {
+            if (shoe.getCount(pairIndex) == 0)
+                break;
+            shoe.remove(pairIndex);
+        }
+
+        // One pair card more or less moves a hand's value by well under a hundredth, so an unlikely count keeps the values of the one before
+        bool likely = split.drawnHands[pairsDrawn] + split.pairHands[pairsDrawn] >= splitLevelWeight;
+        if (split.drawnHands[pairsDrawn] > 0)
+        {
+            if (likely || !drawnSolved)
+                drawnValue = drawnHandValue(shoe, upIndex, pairIndex, split.pairCards - pairsDrawn);
+            drawnSolved = true;
+            outcome.value += split.drawnHands[pairsDrawn] * drawnValue;
+        }
+        if (split.pairHands[pairsDrawn] > 0)
+        {
+            if (likely || !pairSolved)
+                pairValue = splitHandValue(shoe, upIndex, pairIndex, pairIndex);
+            pairSolved = true;
+            outcome.value += split.pairHands[pairsDrawn] * pairValue;
+        }
+    }
+
+    outcome.handChances = split.handChances;
+    outcome.expectedHands = 0;
+    for (int hands = 2; hands <= SplitOutcome::mostHands; hands++)
+        outcome.expectedHands += hands * split.handChances[hands];
+
+    splitCache.insert(unseen.getKey(), state, outcome);
+    return outcome;
+}
+
+EVEngine::DealerOutcomes EVEngine::getDealerOutcomes(int upIndex, const ShoeComposition &unseen)
+{
+    return dealer.getNoBlackjack(upIndex, unseen);
+}
+
+void EVEngine::clearCache()
+{
+    dealer.clearCache();
+    hitCache.clear();
+    splitCache.clear();
+}
+
+DealerProbabilities &EVEngine::getDealerProbabilities()
+{
+    return dealer;
+}
+
+void EVEngine::ageCache()
+{
+    hitCache.nextGeneration();
+    splitCache.nextGeneration();
+}
+
+int EVEngine::totalOf(int hardTotal, bool hasAce)
+{
+    return hasAce && hardTotal <= 11 ? hardTotal + 10 : hardTotal;
+}
+
+double EVEngine::standValue(ShoeComposition &shoe, int upIndex, int total)
+{
+    if (total > 21)
+        return -1;
+
+    DealerOutcomes outcomes = dealer.getNoBlackjack(upIndex, shoe);
+
+    // Win if the dealer busts or finishes lower, push on the same total
+    double value = outcomes[DealerProbabilities::bust];
+    for (int i = 0; i < DealerProbabilities::bust; i++)
+    {
+        int dealerTotal = 17 + i;
+        if (dealerTotal < total)
+            value += outcomes[i];
+        else if (dealerTotal > total)
+            value -= outcomes[i];
+    }
+    return value;
+}
+
+double EVEngine::hitValue(ShoeComposition &shoe, int upIndex, int hardTotal, bool hasAce)
+{
+    // An ace that can no longer count as 11 never will again
+    hasAce = hasAce && hardTotal <= 11;
+
+    uint32_t state = static_cast<uint32_t>((upIndex * 32 + hardTotal) * 2 + hasAce);
+    if (const double *cached = hitCache.find(shoe.getKey(), state))
+        return *cached;
+
+    double value = 0;
+    for (int i = 0; i < ShoeComposition::valueCount; i++)
+    {
+        if (shoe.getCount(i) == 0)
+            continue;
+
+        double probability = static_cast<double>(shoe.getCount(i)) / shoe.getTotal();
+        int nextHard = hardTotal + ShoeComposition::hardValue(i);
+        if (nextHard > 21)
+        {
+            value -= probability;
+            continue;
+        }
+
+        shoe.remove(i);
+        value += probability * bestAfterHit(shoe, upIndex, nextHard, hasAce || i == ShoeComposition::aceIndex);
+        shoe.add(i);
+    }
+
+    hitCache.insert(shoe.getKey(), state, value);
+    return value;
+}
+
+double EVEngine::bestAfterHit(ShoeComposition &shoe, int upIndex, int hardTotal, bool hasAce)
+{
+    int total = totalOf(hardTotal, hasAce);
+    double stand = standValue(shoe, upIndex, total);
+
+    // Hitting 21 can't do better than standing
+    if (total == 21)
+        return stand;
+
+    return std::max(stand, hitValue(shoe, upIndex, hardTotal, hasAce));
+}
+
+double EVEngine::doubleValue(ShoeComposition &shoe, int upIndex, int hardTotal, bool hasAce)
+{
+    double value = 0;
+    for (int i = 0; i < ShoeComposition::valueCount; i++)
+    {
+        if (shoe.getCount(i) == 0)
+            continue;
+
+        double probability = static_cast<double>(shoe.getCount(i)) / shoe.getTotal();
+        shoe.remove(i);
+        value += probability * standValue(shoe, upIndex, totalOf(hardTotal + ShoeComposition::hardValue(i), hasAce || i == ShoeComposition::aceIndex));
+        shoe.add(i);
+    }
+    return 2 * value;
+}
+
+double EVEngine::splitHandValue(ShoeComposition &shoe, int upIndex, int pairIndex, int second)
+{
+    int hardTotal = ShoeComposition::hardValue(pairIndex) + ShoeComposition::hardValue(second);
+    bool hasAce = pairIndex == ShoeComposition::aceIndex || second == ShoeComposition::aceIndex;
+
+    // Split aces get one card each and must stand unless the rules let them be hit
+    if (pairIndex == ShoeComposition::aceIndex && !hitSplitAces)
+        return standValue(shoe, upIndex, totalOf(hardTotal, hasAce));
+
+    double value = bestAfterHit(shoe, upIndex, hardTotal, hasAce);
+    if (doubleAfterSplit)
+        value = std::max(value, doubleValue(shoe, upIndex, hardTotal, hasAce));
+    return value;
+}
+
+double EVEngine::drawnHandValue(ShoeComposition &shoe, int upIndex, int pairIndex, double pairCards)
+{
+    // The hand drew any unseen card but one that would have resplit it
+    double others = shoe.getTotal() - pairCards;
+    double value = 0;
+    for (int i = 0; i < ShoeComposition::valueCount; i++)
+    {
+        double count = shoe.getCount(i) - (i == pairIndex ? pairCards : 0);
+        if (count <= 0)
+            continue;
+
+        shoe.remove(i);
+        value += count / others * splitHandValue(shoe, upIndex, pairIndex, i);
+        shoe.add(i);
+    }
+    return value;
+}
+
+void EVEngine::dealSplitCards(double chance, int pairsDrawn, int othersDrawn, int waiting, int hands, int pairHands, SplitDeal &split) const
+{
+    if (waiting == 0)
+    {
+        split.drawnHands[pairsDrawn] += chance * othersDrawn;
+        split.pairHands[pairsDrawn] += chance * pairHands;
+        split.handChances[hands] += chance;
+        return;
+    }
+
+    // Only whether each second card was a pair card is known, the cards hit in between are unknown so they don't change the odds
+    double pairsLeft = split.pairCards - pairsDrawn;
+    double pairChance = pairsLeft > 0 ? pairsLeft / (split.shoeTotal - pairsDrawn - othersDrawn) : 0;
+    if (pairChance > 0)
+    {
+        if (split.canResplit && hands < split.mostHands)
+            dealSplitCards(chance * pairChance, pairsDrawn + 1, othersDrawn, waiting + 1, hands + 1, pairHands, split);
+        else
+            dealSplitCards(chance * pairChance, pairsDrawn + 1, othersDrawn, waiting - 1, hands, pairHands + 1, split);
+    }
+    if (pairChance < 1)
+        dealSplitCards(chance * (1 - pairChance), pairsDrawn, othersDrawn + 1, waiting - 1, hands, pairHands, split);
+}
@@ -0,0 +1,301 @@
+#ifndef EVENGINE_H
+#define EVENGINE_H
+
+#include "compositioncache.h"
+#include "dealerprobabilities.h"
+#include "hand.h"
+#include "shoecomposition.h"
+#include "statistics.h"
+#include "tablerules.h"
+#include <array>
+#include <cstddef>
+
+/**
+ * @brief The MoveValues struct holds the expected value of every move for a hand, in units of the hand's bet
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/26/2025
+ */
+struct MoveValues
+{
+    /**
+     * @brief stand The expected value of standing
+     */
+    double stand = -1;
+
+    /**
+     * @brief hit The expected value of hitting and then playing on optimally
+     */
+    double hit = -1;
+
+    /**
+     * @brief doubleDown The expected value of doubling, counted against the original bet
+     */
+    double doubleDown = -1;
+
+    /**
+     * @brief split The expected value of splitting, counted against the original bet
+     */
+    double split = -1;
+
+    /**
+     * @brief surrender The expected value of surrendering, always half the bet lost
+     */
+    double surrender = -0.5;
+
+    /**
+     * @brief canDouble True if the hand has two cards and may double
+     */
+    bool canDouble = false;
+
+    /**
+     * @brief canSplit True if the hand is a pair and may split
+     */
+    bool canSplit = false;
+
+    /**
+     * @brief canSurrender True if the hand may surrender, only the caller knows this so it starts false
+     */
+    bool canSurrender = false;
+
+    /**
+     * @brief getBestMove Gets the legal move with the highest expected value, ties go to the simpler move
+     * @return The best MOVE
+     */
+    MOVE getBestMove() const;
+};
+
+/**
+ * @brief The SplitOutcome struct is what splitting a pair is expected to come to, in units of the bet on the hand split
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/9/2025
+ */
+struct SplitOutcome
+{
+    /**
+     * @brief mostHands The most hands a split is solved for. Past four, resplits are rare enough to leave out
+     */
+    static constexpr int mostHands = 4;
+
+    /**
+     * @brief value The expected value of splitting, counting every hand the split ends with and any doubles
+     */
+    double value = -1;
+
+    /**
+     * @brief expectedHands The expected number of hands the split ends with
+     */
+    double expectedHands = 2;
+
+    /**
+     * @brief handChances The chance the split ends with each number of hands, indexed by the number of hands
+     */
+    std::array<double, mostHands + 1> handChances{};
+};
+
+/**
+ * @brief The EVEngine class computes composition dependent expected values for every move of a hand.
+ * Given the unseen cards and the dealer's up card, it recurses over every card the player could draw, removing each card from the shoe as it is drawn,
+ * and scores each final hand against DealerProbabilities for the shoe left at that point, with the dealer's blackjack already ruled out.
+ * The dealer's soft 17 rule and doubling after splits follow the table rules.
+ * Splits are solved exactly for how many hands they end with, resplitting up to the table's limit, and for the pair cards those hands take.
+ * Each hand is then played for its own cards with those pair cards gone, the way combinatorial analyzers value splits.
+ * Counts of pair cards taken that make less than a thousandth of a hand reuse the last count's values, which moves a split by about 1e-5 and saves a third of the time.
+ * Results are memoized by (shoe composition, hand state, up card) so repeat decisions from the same shoe are cheap
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/26/2025
+ */
+class EVEngine
+{
+public:
+    /**
+     * @brief DealerOutcomes The probability of the dealer finishing on each total, see DealerProbabilities
+     */
+    using DealerOutcomes = DealerProbabilities::Outcomes;
+
+    /**
+     * @brief EVEngine Constructor for the engine
+     * @param rules The house rules to compute expected values for
+     * @param maxCacheEntries The number of memoized values to keep in each cache, the least recently used are replaced past it
+     */
+    explicit EVEngine(const TableRules &rules = TableRules(), std::size_t maxCacheEntries = 1 << 21);
+
+    /**
+     * @brief evaluate Computes the expected value of every legal move for a hand
+     * @param hand The player's hand
+     * @param upIndex The ShoeComposition index of the dealer's up card
+     * @param unseen The cards the player hasn't seen, including the dealer's hole card
+     * @param handCount The number of hands the seat is playing, which counts toward the most hands a split may make
+     * @return The expected values of the moves
+     */
+    MoveValues evaluate(const Hand &hand, int upIndex, const ShoeComposition &unseen, int handCount = 1);
+
+    /**
+     * @brief getBestMove Gets the move with the highest expected value for a hand
+     * @param hand The player's hand
+     * @param upIndex The ShoeComposition index of the dealer's up card
+     * @param unseen The cards the player hasn't seen, including the dealer's hole card
+     * @return The best MOVE
+     */
+    MOVE getBestMove(const Hand &hand, int upIndex, const ShoeComposition &unseen);
+
+    /**
+     * @brief getSplitOutcome Solves splitting a pair and resplitting any pair cards drawn to the split hands, up to the table's limit on hands
+     * or SplitOutcome::mostHands if it has none. Doubling after a split and resplitting and hitting aces follow the table rules.
+     * Only the same rank can be resplit, so a quarter of the unseen tens are taken to match a pair of tens
+     * @param pairIndex The ShoeComposition index of the paired card
+     * @param upIndex The ShoeComposition index of the dealer's up card
+     * @param unseen The cards the player hasn't seen, including the dealer's hole card
+     * @param handCount The number of hands the seat is playing, including the pair
+     * @return The split's expected value and how many hands it is likely to make
+     */
+    SplitOutcome getSplitOutcome(int pairIndex, int upIndex, const ShoeComposition &unseen, int handCount = 1);
+
+    /**
+     * @brief getDealerOutcomes Gets the dealer's final total probabilities given they don't have blackjack
+     * @param upIndex The ShoeComposition index of the dealer's up card
+     * @param unseen The cards the dealer could draw, including the hole card
+     * @return The probabilities of each final total
+     */
+    DealerOutcomes getDealerOutcomes(int upIndex, const ShoeComposition &unseen);
+
+    /**
+     * @brief clearCache Removes every memoized value
+     */
+    void clearCache();
+
+    /**
+     * @brief getDealerProbabilities Gets the dealer outcome engine, shared so other analysis can reuse its cache
+     */
+    DealerProbabilities &getDealerProbabilities();
+
+private:
+    /**
+     * @brief SplitDeal The state of one split being solved, defined with dealSplitCards
+     */
+    struct SplitDeal;
+
+    /**
+     * @brief dealer The dealer outcome distributions, memoized by shoe
+     */
+    DealerProbabilities dealer;
+
+    /**
+     * @brief hitCache Expected values of hitting by shoe, up card and player state
+     */
+    CompositionCache<double> hitCache;
+
+    /**
+     * @brief splitCache Solved splits by shoe, up card, pair and the hands left to split into
+     */
+    CompositionCache<SplitOutcome> splitCache;
+
+    /**
+     * @brief doubleAfterSplit True if split hands may double down
+     */
+    bool doubleAfterSplit;
+
+    /**
+     * @brief resplitAces True if split aces that draw another ace may split again
+     */
+    bool resplitAces;
+
+    /**
+     * @brief hitSplitAces True if split aces may be hit and doubled like any other split hand
+     */
+    bool hitSplitAces;
+
+    /**
+     * @brief splitHands The most hands a seat may split into, capped at SplitOutcome::mostHands
+     */
+    int splitHands;
+
+    /**
+     * @brief ageCache Starts a new generation in the hit and split caches, so the values the next query uses are the last to be replaced
+     */
+    void ageCache();
+
+    /**
+     * @brief totalOf Gets the blackjack total of a hand state
+     * @param hardTotal The total with aces counted as 1
+     * @param hasAce True if the hand holds an ace
+     * @return The total with one ace counted as 11 if it doesn't bust
+     */
+    static int totalOf(int hardTotal, bool hasAce);
+
+    /**
+     * @brief standValue Gets the expected value of standing on a total
+     * @param shoe The unseen cards
+     * @param upIndex The index of the dealer's up card
+     * @param total The player's total
+     * @return The expected value of standing
+     */
+    double standValue(ShoeComposition &shoe, int upIndex, int total);
+
+    /**
+     * @brief hitValue Gets the expected value of hitting a hand state and then playing on optimally
+     * @param shoe The unseen cards, restored before returning
+     * @param upIndex The index of the dealer's up card
+     * @param hardTotal The player's total with aces counted as 1
+     * @param hasAce True if the player holds an ace
+     * @return The expected value of hitting
+     */
+    double hitValue(ShoeComposition &shoe, int upIndex, int hardTotal, bool hasAce);
+
+    /**
+     * @brief bestAfterHit Gets the expected value of the best of standing and hitting
+     * @param shoe The unseen cards, restored before returning
+     * @param upIndex The index of the dealer's up card
+     * @param hardTotal The player's total with aces counted as 1
+     * @param hasAce True if the player holds an ace
+     * @return The expected value of playing the hand optimally without doubling
+     */
+    double bestAfterHit(ShoeComposition &shoe, int upIndex, int hardTotal, bool hasAce);
+
+    /**
+     * @brief doubleValue Gets the expected value of doubling, drawing exactly one card
+     * @param shoe The unseen cards, restored before returning
+     * @param upIndex The index of the dealer's up card
+     * @param hardTotal The player's total with aces counted as 1
+     * @param hasAce True if the player holds an ace
+     * @return The expected value of doubling against the original bet
+     */
+    double doubleValue(ShoeComposition &shoe, int upIndex, int hardTotal, bool hasAce);
+
+    /**
+     * @brief splitHandValue Gets the expected value of one finished split hand, a pair card and the card drawn to it, played optimally
+     * @param shoe The unseen cards without the hand's two cards, restored before returning
+     * @param upIndex The index of the dealer's up card
+     * @param pairIndex The index of the paired card
+     * @param second The index of the card drawn to it
+     * @return The expected value of the hand against its own bet
+     */
+    double splitHandValue(ShoeComposition &shoe, int upIndex, int pairIndex, int second);
+
+    /**
+     * @brief drawnHandValue Gets the expected value of a split hand that drew a card it can't split with, averaged over the cards it could have drawn
+     * @param shoe The unseen cards without the split's pair cards, restored before returning
+     * @param upIndex The index of the dealer's up card
+     * @param pairIndex The index of the paired card
+     * @param pairCards The number of unseen cards that would resplit
+     * @return The expected value of the hand against its own bet
+     */
+    double drawnHandValue(ShoeComposition &shoe, int upIndex, int pairIndex, double pairCards);
+
+    /**
+     * @brief dealSplitCards Follows every way the split hands can be dealt their second cards, adding up the chance of each way it ends.
+     * A pair card resplits the hand while there are hands left, and otherwise makes a hand of the pair that is played out
+     * @param chance The chance of getting this far
+     * @param pairsDrawn The pair cards drawn to split hands so far
+     * @param othersDrawn The other cards drawn to split hands so far
+     * @param waiting The hands still waiting for their second card
+     * @param hands The hands the split has made so far
+     * @param pairHands The hands so far that drew a pair card and couldn't resplit
+     * @param split Where the split is being solved: its shoe and limits in, the chances of each ending out
+     */
+    void dealSplitCards(double chance, int pairsDrawn, int othersDrawn, int waiting, int hands, int pairHands, SplitDeal &split) const;
+};
+
+#endif // EVENGINE_H
@@ -0,0 +1,214 @@
+#ifndef GAMEEVENT_H
+#define GAMEEVENT_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace GameEventType
+{
+
+    /**
+     * @brief The GAMEEVENT enum The changes GameState makes to the table, each one small enough that a reader following them rebuilds the table exactly.
+     * Hands are numbered in play order at the time of the event
+     *
+     * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+     * @date 5/15/2025
+     */
+    enum class GAMEEVENT : uint8_t
+    {
+        BET,         // A hand's bet is now amount
+        CARD,        // A card, as Card::getCode in value, is dealt to a hand
+        DEALER_CARD, // A card is dealt to the dealer, the first one face down until the round is settled
+        STATUS,      // A hand's status is now the PLAYERSTATUS in value
+        MONEY,       // A seat's money changes by amount, hand is the seat
+        SPLIT,       // A hand's last card moves to a new hand with the same bet, right after it in play order
+        CLEAR        // The split hands are gone, the seats' hands and the dealer's are emptied and the bets kept
+    };
+
+    /**
+     * @brief toString Converts a GAMEEVENT to a string
+     * @param event The GAMEEVENT to convert
+     * @return A string of the GAMEEVENT provided
+     */
+    inline std::string toString(GAMEEVENT event)
+    {
+        switch (event)
+        {
+        case GAMEEVENT::BET:
+            return "Bet";
+        case GAMEEVENT::CARD:
+            return "Card";
+        case GAMEEVENT::DEALER_CARD:
+            return "Dealer card";
+        case GAMEEVENT::STATUS:
+            return "Status";
+        case GAMEEVENT::MONEY:
+            return "Money";
+        case GAMEEVENT::SPLIT:
+            return "Split";
+        case GAMEEVENT::CLEAR:
+            return "Clear";
+        default:
+            return "Unknown";
+        }
+    }
+
+    /**
+     * @brief allGameEvents An array of all GAMEEVENT values for iteration
+     */
+    static constexpr std::array<GAMEEVENT, 7> allGameEvents = {GAMEEVENT::BET, GAMEEVENT::CARD, GAMEEVENT::DEALER_CARD, GAMEEVENT::STATUS,
+                                                               GAMEEVENT::MONEY, GAMEEVENT::SPLIT, GAMEEVENT::CLEAR};
+}
+
+using GameEventType::GAMEEVENT;
+
+namespace GameCommandType
+{
+
+    /**
+     * @brief The GAMECOMMAND enum What can be asked of GameState, one for each of its mutators
+     *
+     * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+     * @date 5/15/2025
+     */
+    enum class GAMECOMMAND : uint8_t
+    {
+        BET,
+        DEAL,
+        ACTIVATE,
+        HIT,
+        STAND,
+        DOUBLE_DOWN,
+        SPLIT,
+        SURRENDER,
+        DEALER_PLAY,
+        SETTLE,
+        CLEAR
+    };
+
+    /**
+     * @brief toString Converts a GAMECOMMAND to a string
+     * @param command The GAMECOMMAND to convert
+     * @return A string of the GAMECOMMAND provided
+     */
+    inline std::string toString(GAMECOMMAND command)
+    {
+        switch (command)
+        {
+        case GAMECOMMAND::BET:
+            return "Bet";
+        case GAMECOMMAND::DEAL:
+            return "Deal";
+        case GAMECOMMAND::ACTIVATE:
+            return "Activate";
+        case GAMECOMMAND::HIT:
+            return "Hit";
+        case GAMECOMMAND::STAND:
+            return "Stand";
+        case GAMECOMMAND::DOUBLE_DOWN:
+            return "Double down";
+        case GAMECOMMAND::SPLIT:
+            return "Split";
+        case GAMECOMMAND::SURRENDER:
+            return "Surrender";
+        case GAMECOMMAND::DEALER_PLAY:
+            return "Dealer play";
+        case GAMECOMMAND::SETTLE:
+            return "Settle";
+        case GAMECOMMAND::CLEAR:
+            return "Clear";
+        default:
+            return "Unknown";
+        }
+    }
+
+    /**
+     * @brief allGameCommands An array of all GAMECOMMAND values for iteration
+     */
+    static constexpr std::array<GAMECOMMAND, 11> allGameCommands = {GAMECOMMAND::BET, GAMECOMMAND::DEAL, GAMECOMMAND::ACTIVATE, GAMECOMMAND::HIT,
+                                                                    GAMECOMMAND::STAND, GAMECOMMAND::DOUBLE_DOWN, GAMECOMMAND::SPLIT, GAMECOMMAND::SURRENDER,
+                                                                    GAMECOMMAND::DEALER_PLAY, GAMECOMMAND::SETTLE, GAMECOMMAND::CLEAR};
+}
+
+using GameCommandType::GAMECOMMAND;
+
+/**
+ * @brief The GameEvent struct is one change GameState made to the table, packed into 64 bits so it can be passed around without copying any hands
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/15/2025
+ */
+struct GameEvent
+{
+    /**
+     * @brief type What changed
+     */
+    GAMEEVENT type = GAMEEVENT::CARD;
+
+    /**
+     * @brief value The card's code or the status, depending on the type
+     */
+    uint8_t value = 0;
+
+    /**
+     * @brief hand The hand in play order, or the seat for MONEY
+     */
+    uint16_t hand = 0;
+
+    /**
+     * @brief amount The bet or the change in money, depending on the type
+     */
+    int32_t amount = 0;
+
+    /**
+     * @brief pack Packs the event into one word, the type in the low byte and the amount in the high half
+     * @return The packed event
+     */
+    uint64_t pack() const
+    {
+        return static_cast<uint64_t>(type) | static_cast<uint64_t>(value) << 8 | static_cast<uint64_t>(hand) << 16 |
+               static_cast<uint64_t>(static_cast<uint32_t>(amount)) << 32;
+    }
+
+    /**
+     * @brief unpack Unpacks an event packed by pack
+     * @param bits The packed event
+     * @return The event
+     */
+    static GameEvent unpack(uint64_t bits)
+    {
+        GameEvent event;
+        event.type = static_cast<GAMEEVENT>(bits & 0xFF);
+        event.value = static_cast<uint8_t>(bits >> 8);
+        event.hand = static_cast<uint16_t>(bits >> 16);
+        event.amount = static_cast<int32_t>(static_cast<uint32_t>(bits >> 32));
+        return event;
+    }
+};
+
+/**
+ * @brief The GameCommand struct is a request for GameState to change the table, handed to GameState::apply
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/15/2025
+ */
+struct GameCommand
+{
+    /**
+     * @brief type What to do
+     */
+    GAMECOMMAND type = GAMECOMMAND::STAND;
+
+    /**
+     * @brief hand The hand in play order it is for, unused by the commands for the whole table
+     */
+    int hand = 0;
+
+    /**
+     * @brief amount The bet for BET
+     */
+    int amount = 0;
+};
+
+#endif // GAMEEVENT_H
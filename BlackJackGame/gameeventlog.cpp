@@ -0,0 +1,79 @@
+/**
+ * @brief Implementation of The GameEventLog class. It is a lock free ring of a table's events that any number of readers follow at their own pace
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/15/2025
+ */
+
+#include "gameeventlog.h"
+
+GameEventLog::GameEventLog(std::size_t capacity)
+{
+    std::size_t size = 1;
+    while (size < capacity)
+        size <<= 1;
+    mask = size - 1;
+    ring = std::make_unique<Slot[]>(size);
+}
+
+void GameEventLog::publish(const GameEvent &event)
+{
+    uint64_t number = published.load(std::memory_order_relaxed);
+    Slot &slot = ring[number & mask];
+
+    // Marked as being written first, so a reader that gets part way through the old event sees it change under it
+    slot.sequence.store(number * 2 + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.bits.store(event.pack(), std::memory_order_relaxed);
+    slot.sequence.store(number * 2 + 2, std::memory_order_release);
+    published.store(number + 1, std::memory_order_release);
+}
+
+bool GameEventLog::read(Cursor &cursor, GameEvent &event) const
+{
+    while (true)
+    {
+        uint64_t end = published.load(std::memory_order_acquire);
+        if (cursor.next >= end)
+            return false;
+
+        // Everything before the last capacity events has been written over
+        uint64_t oldest = end > mask + 1 ? end - (mask + 1) : 0;
+        if (cursor.next < oldest)
+        {
+            cursor.missed += oldest - cursor.next;
+            cursor.next = oldest;
+        }
+
+        const Slot &slot = ring[cursor.next & mask];
+        uint64_t before = slot.sequence.load(std::memory_order_acquire);
+        uint64_t bits = slot.bits.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t after = slot.sequence.load(std::memory_order_relaxed);
+
+        // The publisher lapped this slot while it was read, so it is looked at again as a missed event
+        if (before != after || before != cursor.next * 2 + 2)
+            continue;
+
+        event = GameEvent::unpack(bits);
+        cursor.next++;
+        return true;
+    }
+}
+
+GameEventLog::Cursor GameEventLog::follow() const
+{
+    Cursor cursor;
+    cursor.next = published.load(std::memory_order_acquire);
+    return cursor;
+}
+
+uint64_t GameEventLog::getPublished() const
+{
+    return published.load(std::memory_order_acquire);
+}
+
+std::size_t GameEventLog::getCapacity() const
+{
+    return mask + 1;
+}
@@ -0,0 +1,123 @@
+#ifndef GAMEEVENTLOG_H
+#define GAMEEVENTLOG_H
+
+#include "gameevent.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief The GameEventLog class is a fixed size, lock free ring of the GameEvents one table publishes, read by any number of readers at their own pace.
+ * Unlike SpscRing nothing is ever popped: each reader keeps its own cursor, so the view, a recorder and a network client can all follow one table.
+ * The publisher never waits. A reader that falls a whole ring behind skips ahead to the oldest event still held and is told how many it missed,
+ * so it can start again from a snapshot of the table. Each slot is a sequence number and the packed event, read like a seqlock,
+ * so a reader can't see an event half written over
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/15/2025
+ */
+class GameEventLog
+{
+public:
+    /**
+     * @brief The Cursor struct is where one reader is in the log. Only the reader's own thread may use it
+     */
+    struct Cursor
+    {
+        /**
+         * @brief next The number of the next event to read
+         */
+        uint64_t next = 0;
+
+        /**
+         * @brief missed The number of events skipped over because the log had moved on past them
+         */
+        uint64_t missed = 0;
+    };
+
+    /**
+     * @brief defaultCapacity Rounds of a full table several times over, so a reader only falls behind if it stops reading
+     */
+    static constexpr std::size_t defaultCapacity = 1 << 16;
+
+    /**
+     * @brief GameEventLog Constructor that creates an empty log
+     * @param capacity The number of events held, rounded up to a power of two
+     */
+    explicit GameEventLog(std::size_t capacity = defaultCapacity);
+
+    GameEventLog(const GameEventLog &) = delete;
+    GameEventLog &operator=(const GameEventLog &) = delete;
+
+    /**
+     * @brief publish Adds an event, writing over the oldest once the log is full. Only one thread may publish
+     * @param event The event
+     */
+    void publish(const GameEvent &event);
+
+    /**
+     * @brief read Reads the next event for a reader. Any thread may read with its own cursor
+     * @param cursor The reader's cursor, moved past the event
+     * @param event Set to the event if there was one
+     * @return False if the reader has read every event published
+     */
+    bool read(Cursor &cursor, GameEvent &event) const;
+
+    /**
+     * @brief follow Makes a cursor that starts after every event published so far, to pair with a snapshot of the table taken on the publisher's thread
+     * @return The cursor
+     */
+    Cursor follow() const;
+
+    /**
+     * @brief getPublished Gets the number of events ever published
+     * @return The number of events
+     */
+    uint64_t getPublished() const;
+
+    /**
+     * @brief getCapacity Gets the number of events held
+     * @return The capacity
+     */
+    std::size_t getCapacity() const;
+
+private:
+    /**
+     * @brief cacheLine The size the publisher's count is padded to
+     */
+    static constexpr std::size_t cacheLine = 64;
+
+    /**
+     * @brief The Slot struct is one event in the ring
+     */
+    struct Slot
+    {
+        /**
+         * @brief sequence Twice the number of the event held plus two once it is written, odd while it is being written
+         */
+        std::atomic<uint64_t> sequence{0};
+
+        /**
+         * @brief bits The packed event
+         */
+        std::atomic<uint64_t> bits{0};
+    };
+
+    /**
+     * @brief mask The capacity less one, to index the ring
+     */
+    std::size_t mask;
+
+    /**
+     * @brief ring The slots, indexed by the low bits of the event's number. Not named slots, which Qt defines as a macro
+     */
+    std::unique_ptr<Slot[]> ring;
+
+    /**
+     * @brief published The number of events ever published, written by the publisher
+     */
+    alignas(cacheLine) std::atomic<uint64_t> published{0};
+};
+
+#endif // GAMEEVENTLOG_H
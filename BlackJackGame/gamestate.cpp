@@ -7,129 +7,272 @@
 
 #include "gamestate.h"
 #include "playerStatus.h"
+#include <stdexcept>
 
 using PlayerStatus::PLAYERSTATUS;
 
-GameState::GameState(std::vector<Player> players, int deckCount, int deterministic) : players(players), deck(deckCount, deterministic), dealerHand(0) {}
+GameState::GameState(std::vector<Player> players, int deckCount, SHOEORDER order, Rng rng) : GameState(players, rulesWithDecks(deckCount), order, rng) {}
+
+GameState::GameState(std::vector<Player> players, const TableRules &rules, SHOEORDER order, Rng rng)
+    : players(players), rules(rules), blackjackPayout(rules.blackjackPayout()), deck(rules.deckCount, order, rng, rules.penetration), dealerHand(0), version(1)
+{
+    deck.setContinuousShuffle(rules.continuousShuffle);
+}
+
+TableRules GameState::rulesWithDecks(int deckCount)
+{
+    TableRules rules;
+    rules.deckCount = deckCount;
+    return rules;
+}
 
 void GameState::dealInitialCards()
 {
-    deck.shuffle();
+    version++;
+    // Otherwise the deck reshuffles itself at the cut card, or a continuous shuffler already took the discards back
+    if (rules.shuffleEveryRound && !rules.continuousShuffle)
+        deck.shuffle();
 
     // Deal 2 cards to each player and set their status to waiting
     for (int i = 0; i < 2; i++)
     {
-        for (Player &player : players)
+        for (int position = 0; position < players.size(); position++)
         {
-            if (player.status == PLAYERSTATUS::BANKRUPT)
+            if (players.status(position) == PLAYERSTATUS::BANKRUPT)
                 continue;
 
-            player.hand.addCard(deck.getNextCard());
-            player.status = PLAYERSTATUS::WAITING;
+            Card card = drawCard();
+            players.hand(position).addCard(card);
+            players.status(position) = PLAYERSTATUS::WAITING;
+            publish(GAMEEVENT::CARD, position, card.getCode());
         }
 
-        dealerHand.addCard(deck.getNextCard());
+        Card card = drawCard();
+        dealerHand.addCard(card);
+        publish(GAMEEVENT::DEALER_CARD, 0, card.getCode());
     }
+
+    if (events)
+        for (int position = 0; position < players.size(); position++)
+            if (players.status(position) != PLAYERSTATUS::BANKRUPT)
+                publishStatus(position);
+
+    if (history)
+        history->deal(players, dealerHand);
 }
 
 void GameState::clearHands()
 {
+    version++;
     dealerHand = Hand(0);
 
-    // Reset player hands and remove split hands
-    for (int i = players.size() - 1; i >= 0; i--)
+    // The cards on the table go back into a continuous shuffler
+    deck.returnDiscards();
+
+    // Remove split hands and reset the seats' own hands
+    players.clearSplits();
+    publish(GAMEEVENT::CLEAR, 0);
+    for (int seat = 0; seat < players.getSeatCount(); seat++)
     {
-        if (!players[i].originalHand)
-            players.erase(players.begin() + i);
-        else
-            players[i].hand = Hand(players[i].hand.getBet());
+        players.hand(seat) = Hand(players.hand(seat).getBet());
 
-        if (players[i].status != PLAYERSTATUS::BANKRUPT)
-            players[i].status = PLAYERSTATUS::WAITING;
+        if (players.status(seat) != PLAYERSTATUS::BANKRUPT)
+            players.status(seat) = PLAYERSTATUS::WAITING;
+        publishStatus(seat);
     }
 }
 
 void GameState::hit(int playerIndex)
 {
-    Player &currPlayer = players[playerIndex];
-    currPlayer.hand.addCard(deck.getNextCard());
-    if (isBust(currPlayer.hand))
+    version++;
+    Hand &hand = players.hand(playerIndex);
+    Card card = drawCard();
+    hand.addCard(card);
+    if (isBust(hand))
     {
-        currPlayer.status = PLAYERSTATUS::BUST;
+        players.status(playerIndex) = PLAYERSTATUS::BUST;
     }
+    publish(GAMEEVENT::CARD, playerIndex, card.getCode());
+    publishStatus(playerIndex);
+
+    if (history)
+        history->hit(playerIndex, card);
 }
 
 void GameState::doubleDown(int playerIndex)
 {
-    Player &currPlayer = players[playerIndex];
-    Player &originalPlayer = players[playerIndex - currPlayer.playerHandIndex];
+    version++;
+    Hand &hand = players.hand(playerIndex);
 
-    // Move the doubled money from the player's money to their current bet
-    int currentBet = currPlayer.hand.getBet();
-    originalPlayer.money -= currentBet;
-    currPlayer.hand.setBet(currentBet * 2);
+    // Move the doubled money from the seat's money to the hand's bet
+    int currentBet = hand.getBet();
+    players.money(players.seat(playerIndex)) -= currentBet;
+    hand.setBet(currentBet * 2);
 
     // Do one hit and then stand/check bust
-    currPlayer.hand.addCard(deck.getNextCard());
-    currPlayer.status = PLAYERSTATUS::STAND;
-    if (isBust(currPlayer.hand))
+    Card card = drawCard();
+    hand.addCard(card);
+    players.status(playerIndex) = PLAYERSTATUS::STAND;
+    if (isBust(hand))
     {
-        currPlayer.status = PLAYERSTATUS::BUST;
+        players.status(playerIndex) = PLAYERSTATUS::BUST;
     }
+    publish(GAMEEVENT::MONEY, players.seat(playerIndex), 0, -currentBet);
+    publish(GAMEEVENT::BET, playerIndex, 0, currentBet * 2);
+    publish(GAMEEVENT::CARD, playerIndex, card.getCode());
+    publishStatus(playerIndex);
+
+    if (history)
+        history->doubleDown(playerIndex, card);
 }
 
 void GameState::stand(int playerIndex)
 {
-    Player &currPlayer = players[playerIndex];
-    currPlayer.status = PLAYERSTATUS::STAND;
+    version++;
+    players.status(playerIndex) = PLAYERSTATUS::STAND;
+    publishStatus(playerIndex);
+
+    if (history)
+        history->stand(playerIndex);
 }
 
 void GameState::split(int playerIndex)
 {
-    Player &currPlayer = players[playerIndex];
-    Player &originalPlayer = players[playerIndex - currPlayer.playerHandIndex];
-    // Get the index of the current hand
-    int handIndex = 1;
-    for (int i = playerIndex; i >= 0; i--)
+    version++;
+    int seat = players.seat(playerIndex);
+
+    // Remove money for the new bet from the seat
+    players.money(seat) -= players.hand(playerIndex).getBet();
+    publish(GAMEEVENT::MONEY, seat, 0, -players.hand(playerIndex).getBet());
+
+    // The new hand is appended to the arena and played right after this one, nothing else moves
+    int secondIndex = players.split(playerIndex);
+
+    // Splits the hand and hits once for the original and new hand
+    Card removedCard = players.hand(playerIndex).removeLastCard();
+    players.hand(secondIndex).addCard(removedCard);
+    Card first = drawCard();
+    Card second = drawCard();
+    players.hand(playerIndex).addCard(first);
+    players.hand(secondIndex).addCard(second);
+    publish(GAMEEVENT::SPLIT, playerIndex);
+    publish(GAMEEVENT::CARD, playerIndex, first.getCode());
+    publish(GAMEEVENT::CARD, secondIndex, second.getCode());
+
+    if (history)
+        history->split(playerIndex, first, second);
+
+    players.status(playerIndex) = PLAYERSTATUS::ACTIVE;
+    players.status(secondIndex) = PLAYERSTATUS::WAITING;
+
+    // Split aces get one card each and stand, unless they drew another ace and can still resplit
+    if (removedCard.getRank() == RANK::ACE && !rules.hitSplitAces)
     {
-        if (players[i].originalHand)
+        int handCount = static_cast<int>(players.handCount(seat));
+        bool canResplit = rules.resplitAces && (rules.maxSplitHands == 0 || handCount < rules.maxSplitHands);
+        int seatStart = players.seatStart(seat);
+        for (int i = seatStart; i < seatStart + handCount; i++)
         {
-            players[i].playerHandCount++;
-            break;
+            PLAYERSTATUS status = players.status(i);
+            bool waiting = status == PLAYERSTATUS::ACTIVE || status == PLAYERSTATUS::WAITING;
+            if (waiting && players.hand(i).getCards()[0].getRank() == RANK::ACE && (!canResplit || !players.hand(i).isPair()))
+                players.status(i) = PLAYERSTATUS::STAND;
         }
-        handIndex++;
     }
 
-    Player secondHandPlayer = Player(0, currPlayer.hand.getBet(), currPlayer.isUser, 0, handIndex);
+    if (events)
+        for (int i = players.seatStart(seat); i < players.seatStart(seat) + static_cast<int>(players.handCount(seat)); i++)
+            publishStatus(i);
+}
 
-    // Remove money for new bet from current player
-    originalPlayer.money -= currPlayer.hand.getBet();
+void GameState::surrender(int playerIndex)
+{
+    version++;
+    // Half the bet comes back now and the hand is already settled as lost. The seat loses half rounded down, so an odd bet keeps its last unit
+    int bet = players.hand(playerIndex).getBet();
+    int refund = bet - bet / 2;
+    players.money(players.seat(playerIndex)) += refund;
+    players.status(playerIndex) = PLAYERSTATUS::LOST;
+    publish(GAMEEVENT::MONEY, players.seat(playerIndex), 0, refund);
+    publishStatus(playerIndex);
+
+    if (history)
+        history->surrender(playerIndex);
+}
 
-    // Splits the hand of the original player and hits once for original and new hand
-    const Card &removedCard = currPlayer.hand.removeLastCard();
-    secondHandPlayer.hand.addCard(removedCard);
-    currPlayer.hand.addCard(deck.getNextCard());
-    secondHandPlayer.hand.addCard(deck.getNextCard());
+HandOptions GameState::getOptions(int playerIndex) const
+{
+    return HandOptions{canDouble(playerIndex), canSplit(playerIndex), canSurrender(playerIndex), static_cast<int>(players.handCount(players.seat(playerIndex)))};
+}
 
-    // Set status of players
-    if (removedCard.getRank() == RANK::ACE)
-    {
-        currPlayer.status = PLAYERSTATUS::STAND;
-        secondHandPlayer.status = PLAYERSTATUS::STAND;
-    }
+bool GameState::canDouble(int playerIndex) const
+{
+    const Hand &hand = players.hand(playerIndex);
+    if (hand.getCards().size() != 2 || players.money(players.seat(playerIndex)) < hand.getBet())
+        return false;
+
+    return players.isOriginal(playerIndex) || rules.doubleAfterSplit;
+}
+
+bool GameState::canSplit(int playerIndex) const
+{
+    const Hand &hand = players.hand(playerIndex);
+    int seat = players.seat(playerIndex);
+    if (!hand.isPair() || players.money(seat) < hand.getBet())
+        return false;
+    if (rules.maxSplitHands > 0 && static_cast<int>(players.handCount(seat)) >= rules.maxSplitHands)
+        return false;
+
+    // Only the first pair of aces can be split unless resplitting is allowed
+    return players.isOriginal(playerIndex) || hand.getCards()[0].getRank() != RANK::ACE || rules.resplitAces;
+}
+
+bool GameState::canSurrender(int playerIndex) const
+{
+    return rules.surrender && players.isOriginal(playerIndex) && players.handCount(players.seat(playerIndex)) == 1 && players.hand(playerIndex).getCards().size() == 2;
+}
+
+void GameState::dealerPlay()
+{
+    version++;
+    std::size_t dealt = dealerHand.getCards().size();
+
+    // Checked once per round, not once per card
+    if (rules.dealerHitsSoft17)
+        dealerDraw<true>();
     else
+        dealerDraw<false>();
+
+    for (std::size_t i = dealt; i < dealerHand.getCards().size(); i++)
+        publish(GAMEEVENT::DEALER_CARD, 0, dealerHand.getCards()[i].getCode());
+
+    if (history)
+        history->dealerDraws(dealerHand);
+}
+
+template <bool HitsSoft17>
+void GameState::dealerDraw()
+{
+    while (dealerHand.getTotal() < 17 || (HitsSoft17 && dealerHand.getTotal() == 17 && dealerHand.isSoft()))
+        dealerHand.addCard(drawCard());
+}
+
+Card GameState::drawCard()
+{
+    Card card = deck.getNextCard();
+
+    // The deck shuffles itself at the cut card, so a new shoe is only noticed once its first card is dealt
+    if (history && deck.getShoeNumber() != recordedShoe)
     {
-        currPlayer.status = PLAYERSTATUS::ACTIVE;
-        secondHandPlayer.status = PLAYERSTATUS::WAITING;
+        recordedShoe = deck.getShoeNumber();
+        history->shoe(deck.getShoeSeed());
     }
-
-    players.insert(players.begin() + playerIndex + 1, secondHandPlayer);
+    return card;
 }
 
-void GameState::dealerPlay()
+const TableRules &GameState::getRules() const
 {
-    while (dealerHand.getTotal() < 17)
-        dealerHand.addCard(deck.getNextCard());
+    return rules;
 }
 
 bool GameState::isBust(const Hand &hand) const
@@ -139,79 +282,234 @@ bool GameState::isBust(const Hand &hand) const
 
 void GameState::endRound()
 {
+    version++;
     int dealerTotal = dealerHand.getTotal();
     bool dealerBust = isBust(dealerHand);
+    bool dealerBlackjack = dealerHand.isBlackjack();
+
+    // The seats' money is published as one change each once every hand is settled
+    std::vector<int> moneyBefore;
+    if (events)
+        for (int seat = 0; seat < players.getSeatCount(); seat++)
+            moneyBefore.push_back(players.money(seat));
 
-    for (int i = 0; i < (int)players.size(); i++)
+    for (int i = 0; i < players.size(); i++)
     {
-        Player &player = players[i];
-        Player &originalPlayer = players[i - player.playerHandIndex];
+        const Hand &hand = players.hand(i);
+        PLAYERSTATUS &status = players.status(i);
+        int &seatMoney = players.money(players.seat(i));
+
+        // Split hands have no money of their own, so a lost split hand reads as bankrupt until the splits are cleared
+        bool broke = !players.isOriginal(i) || seatMoney <= 0;
+
+        // Surrendered hands were settled when they surrendered
+        if (status == PLAYERSTATUS::LOST)
+        {
+            if (broke)
+                status = PLAYERSTATUS::BANKRUPT;
+            continue;
+        }
+
         // If player busts, they either simply lose or go bankrupt
-        if (player.status == PLAYERSTATUS::BUST)
+        if (status == PLAYERSTATUS::BUST)
         {
-            player.status = PLAYERSTATUS::LOST;
-            if (player.money <= 0)
-                player.status = PLAYERSTATUS::BANKRUPT;
+            status = broke ? PLAYERSTATUS::BANKRUPT : PLAYERSTATUS::LOST;
             continue;
         }
 
-        int playerTotal = player.hand.getTotal();
-        if (dealerBust || playerTotal > dealerTotal)
+        // A natural on a seat that didn't split beats any dealer hand but another natural, whatever the dealer drew to.
+        // A split hand's 21 is paid even money, the seat's first hand included
+        int playerTotal = hand.getTotal();
+        if (hand.isBlackjack() && players.handCount(players.seat(i)) == 1 && !dealerBlackjack)
         {
-            // If player gets blackjack, player gets 2.5 times their bet
-            if (playerTotal == 21 && player.hand.getCards().size() == 2)
-            {
-                originalPlayer.money += player.hand.getBet() * 2.5;
-
-                player.status = PLAYERSTATUS::BLACKJACK;
-            }
-            // Else, player won and doubles their bet
-            else
-            {
-                originalPlayer.money += player.hand.getBet() * 2;
-
-                player.status = PLAYERSTATUS::WON;
-            }
+            // Player gets their bet back plus the blackjack payout
+            seatMoney += hand.getBet() * (1 + blackjackPayout);
+
+            status = PLAYERSTATUS::BLACKJACK;
+        }
+        // Else, player won and doubles their bet
+        else if (dealerBust || playerTotal > dealerTotal)
+        {
+            seatMoney += hand.getBet() * 2;
+
+            status = PLAYERSTATUS::WON;
         }
         // Player gets their money back if they have the same total
         else if (playerTotal == dealerTotal)
         {
-            originalPlayer.money += player.hand.getBet();
-            player.status = PLAYERSTATUS::PUSHED;
+            seatMoney += hand.getBet();
+            status = PLAYERSTATUS::PUSHED;
         }
         // Player loses
         else
         {
-            player.status = PLAYERSTATUS::LOST;
-            if (player.money <= 0)
-                player.status = PLAYERSTATUS::BANKRUPT;
+            status = broke ? PLAYERSTATUS::BANKRUPT : PLAYERSTATUS::LOST;
         }
     }
+
+    if (events)
+    {
+        for (int i = 0; i < players.size(); i++)
+            publishStatus(i);
+        for (int seat = 0; seat < players.getSeatCount(); seat++)
+            if (players.money(seat) != moneyBefore[seat])
+                publish(GAMEEVENT::MONEY, seat, 0, players.money(seat) - moneyBefore[seat]);
+    }
+
+    if (history)
+        history->settle(players);
+}
+
+void GameState::setBackgroundShuffle(bool enabled)
+{
+    deck.setBackgroundShuffle(enabled);
+}
+
+void GameState::setShuffleModel(const ShuffleModel &model)
+{
+    deck.setShuffleModel(model);
+}
+
+void GameState::setHistory(HandHistoryWriter *history)
+{
+    // The next card dealt records the shoe it came from
+    this->history = history;
+    recordedShoe = 0;
+    if (history)
+        history->seats(players);
+}
+
+void GameState::setEvents(GameEventLog *events)
+{
+    this->events = events;
+}
+
+void GameState::apply(const GameCommand &command)
+{
+    switch (command.type)
+    {
+    case GAMECOMMAND::BET:
+        setPlayerBet(command.hand, command.amount);
+        break;
+    case GAMECOMMAND::DEAL:
+        dealInitialCards();
+        break;
+    case GAMECOMMAND::ACTIVATE:
+        setPlayerActive(command.hand);
+        break;
+    case GAMECOMMAND::HIT:
+        hit(command.hand);
+        break;
+    case GAMECOMMAND::STAND:
+        stand(command.hand);
+        break;
+    case GAMECOMMAND::DOUBLE_DOWN:
+        doubleDown(command.hand);
+        break;
+    case GAMECOMMAND::SPLIT:
+        split(command.hand);
+        break;
+    case GAMECOMMAND::SURRENDER:
+        surrender(command.hand);
+        break;
+    case GAMECOMMAND::DEALER_PLAY:
+        dealerPlay();
+        break;
+    case GAMECOMMAND::SETTLE:
+        endRound();
+        break;
+    case GAMECOMMAND::CLEAR:
+        clearHands();
+        break;
+    }
+}
+
+void GameState::reseed(uint64_t seed)
+{
+    deck.reseed(seed);
+}
+
+void GameState::setSeatMoney(int seat, int money)
+{
+    version++;
+    publish(GAMEEVENT::MONEY, seat, 0, money - players.money(seat));
+    players.money(seat) = money;
+    players.status(seat) = money > 0 ? PLAYERSTATUS::WAITING : PLAYERSTATUS::BANKRUPT;
+    publishStatus(seat);
+
+    // A replay starts the seats over from here
+    if (history)
+        history->seats(players);
+}
+
+void GameState::stackCards(const std::vector<Card> &cards)
+{
+    deck.stack(cards);
 }
 
 void GameState::setPlayerActive(int index)
 {
-    players[index].status = PLAYERSTATUS::ACTIVE;
+    version++;
+    players.status(index) = PLAYERSTATUS::ACTIVE;
+    publishStatus(index);
 }
 
 void GameState::setPlayerBet(int index, int amount)
 {
-    players[index].money -= amount;
-    players[index].hand.setBet(amount);
+    version++;
+    players.money(players.seat(index)) -= amount;
+    players.hand(index).setBet(amount);
+
+    if (history)
+        history->bet(players.seat(index), amount);
 
     // Set the status to bet submitted if not bankrupt
-    if (players[index].status != PLAYERSTATUS::BANKRUPT)
-        players[index].status = PLAYERSTATUS::BETSUBMITTED;
+    if (players.status(index) != PLAYERSTATUS::BANKRUPT)
+        players.status(index) = PLAYERSTATUS::BETSUBMITTED;
+
+    publish(GAMEEVENT::MONEY, players.seat(index), 0, -amount);
+    publish(GAMEEVENT::BET, index, 0, amount);
+    publishStatus(index);
+}
+
+Player GameState::getPlayer(int index) const
+{
+    if (index < 0 || index >= players.size())
+        throw std::out_of_range("GameState::getPlayer");
+    return players.view(index).toPlayer();
+}
+
+Player GameState::getOriginalPlayer(int index) const
+{
+    return players.view(players.seatStart(players.seat(index))).toPlayer();
+}
+
+PlayerView GameState::getPlayerView(int index) const
+{
+    return players.view(index);
+}
+
+PlayerSpan GameState::getPlayers() const
+{
+    return players.players();
 }
 
-const Player &GameState::getPlayer(int index) const
+const PlayerTable &GameState::getPlayerTable() const
 {
-    return players.at(index);
+    return players;
+}
+
+RoundSnapshot GameState::getSnapshot() const
+{
+    // Nothing has changed since the last snapshot, so share it
+    if (snapshot.getVersion() != version)
+        snapshot = RoundSnapshot(getAllPlayers(), dealerHand, version);
+    return snapshot;
 }
 
-const Player &GameState::getOriginalPlayer(int index) const
+uint64_t GameState::getVersion() const
 {
-    return players[index - players[index].playerHandIndex];
+    return version;
 }
 
 const Hand &GameState::getDealerHand() const
@@ -219,12 +517,31 @@ const Hand &GameState::getDealerHand() const
     return dealerHand;
 }
 
+const ShoeComposition &GameState::getShoeComposition() const
+{
+    return deck.getComposition();
+}
+
+const CardCounter &GameState::getCounter() const
+{
+    return deck.getCounter();
+}
+
+void GameState::setCountingSystem(SYSTEM system)
+{
+    deck.setCountingSystem(system);
+}
+
 int GameState::getPlayerCount() const
 {
-    return static_cast<int>(players.size());
+    return players.size();
 }
 
-const std::vector<Player> GameState::getAllPlayers() const
+std::vector<Player> GameState::getAllPlayers() const
 {
-    return players;
+    std::vector<Player> copies;
+    copies.reserve(players.size());
+    for (PlayerView player : players.players())
+        copies.push_back(player.toPlayer());
+    return copies;
 }
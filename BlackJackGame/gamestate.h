@@ -3,10 +3,17 @@
 
 #include <vector>
 #include "player.h"
+#include "playertable.h"
+#include "roundsnapshot.h"
 #include "deck.h"
+#include "gameeventlog.h"
+#include "handhistorywriter.h"
+#include "tablerules.h"
 
 /**
- * @brief The GameState class is the core model of the blackjack game. Handles all game logic
+ * @brief The GameState class is the core model of the blackjack game. Handles all game logic.
+ * Hands are indexed in play order: each seat's hand followed by the hands split from it.
+ * They are stored in a PlayerTable, and getPlayers and getPlayerView read them in place while getPlayer and getAllPlayers make copies
  *
  * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
  * @date 4/21/2025
@@ -18,9 +25,19 @@ public:
      * @brief Constructs the GameState with a given number of players, a certain number of decks, and an initial bet for each player
      * @param players A vector of all of the players in the game
      * @param deckCount The number of decks to use
-     * @param deterministic 0 = random shuffle, 1 = shuffle for single player, 2 = shuffle for 3 players
+     * @param order How the deck orders its cards on each shuffle
+     * @param rng The random number generator for the deck, seeded from std::random_device by default. Rng(seed) deals the same shoes for the same seed
      */
-    GameState(std::vector<Player> players, int deckCount, int deterministic);
+    GameState(std::vector<Player> players, int deckCount, SHOEORDER order, Rng rng = Rng());
+
+    /**
+     * @brief Constructs the GameState with the given players playing by the given table rules
+     * @param players A vector of all of the players in the game
+     * @param rules The house rules, including the number of decks and penetration of the shoe
+     * @param order How the deck orders its cards on each shuffle
+     * @param rng The random number generator for the deck, seeded from std::random_device by default. Rng(seed) deals the same shoes for the same seed
+     */
+    GameState(std::vector<Player> players, const TableRules &rules, SHOEORDER order = SHOEORDER::RANDOM, Rng rng = Rng());
 
     /**
      * @brief dealInitialCards Deals two cards to each player and two to the dealer
@@ -52,10 +69,50 @@ public:
     void split(int playerIndex);
 
     /**
-     * @brief dealerPlay Dealer draws cards until total >= 17 or bust
+     * @brief surrender The player gives up their hand and gets half their bet back
+     * @param playerIndex The index of the current player
+     */
+    void surrender(int playerIndex);
+
+    /**
+     * @brief canDouble Checks if the rules and the player's money allow the hand to double down
+     * @param playerIndex The index of the current player
+     * @return True if the hand may double
+     */
+    bool canDouble(int playerIndex) const;
+
+    /**
+     * @brief canSplit Checks if the rules and the player's money allow the hand to split
+     * @param playerIndex The index of the current player
+     * @return True if the hand may split
+     */
+    bool canSplit(int playerIndex) const;
+
+    /**
+     * @brief canSurrender Checks if the rules allow the hand to surrender
+     * @param playerIndex The index of the current player
+     * @return True if the hand may surrender
+     */
+    bool canSurrender(int playerIndex) const;
+
+    /**
+     * @brief getOptions Gets every optional move the rules and the player's money allow for the hand
+     * @param playerIndex The index of the current player
+     * @return What the hand may do besides hit and stand
+     */
+    HandOptions getOptions(int playerIndex) const;
+
+    /**
+     * @brief dealerPlay Dealer draws cards until total >= 17 or bust, hitting soft 17 if the rules say to
      */
     void dealerPlay();
 
+    /**
+     * @brief getRules Gets the house rules of the table
+     * @return The rules
+     */
+    const TableRules &getRules() const;
+
     /**
      * @brief endRound Compare each player's total to the dealer's total, pay winners, take bets from losers, then remove bankrupt players
      */
@@ -73,23 +130,111 @@ public:
     int getPlayerCount() const;
 
     /**
-     * @brief getPlayer Gets a player's current hand
+     * @brief getPlayer Gets a copy of a player's current hand
      * @param index The current player's index
+     * @throws std::out_of_range if there is no hand at the index
      */
-    const Player &getPlayer(int index) const;
+    Player getPlayer(int index) const;
 
     /**
-     * @brief getOriginalPlayer Returns the original player's index (not a split index)
+     * @brief getOriginalPlayer Gets a copy of the original hand of a player (not a split hand), which holds the player's money
      * @param index The index of one of the player's hands
-     * @return The index of the original hand
+     * @return The original hand
+     */
+    Player getOriginalPlayer(int index) const;
+
+    /**
+     * @brief getPlayerView Gets a view of a player's current hand without copying it
+     * @param index The current player's index
+     * @return A view that stays up to date until the hands are cleared
+     */
+    PlayerView getPlayerView(int index) const;
+
+    /**
+     * @brief getPlayers Gets a view of every hand in play order without copying them
+     * @return A span over the hands
+     */
+    PlayerSpan getPlayers() const;
+
+    /**
+     * @brief getPlayerTable Gets the seats and hands of the game
+     * @return The player table
      */
-    const Player &getOriginalPlayer(int index) const;
+    const PlayerTable &getPlayerTable() const;
 
     /**
      * @brief getDealerHand Gets the dealer's current hand
      */
     const Hand &getDealerHand() const;
 
+    /**
+     * @brief getShoeComposition Gets the values of the cards left in the shoe, the dealer's hole card is already removed
+     * @return The composition of the undealt cards
+     */
+    const ShoeComposition &getShoeComposition() const;
+
+    /**
+     * @brief getCounter Gets the count of every card dealt since the last shuffle, the dealer's hole card is already counted
+     * @return The card counter of the deck
+     */
+    const CardCounter &getCounter() const;
+
+    /**
+     * @brief setCountingSystem Changes the counting system kept by the deck
+     * @param system The counting system to keep
+     */
+    void setCountingSystem(SYSTEM system);
+
+    /**
+     * @brief setBackgroundShuffle Starts or stops shuffling the next shoes on a background thread
+     * @param enabled True to shuffle in the background
+     */
+    void setBackgroundShuffle(bool enabled);
+
+    /**
+     * @brief setShuffleModel Changes how the shoe is shuffled, from the next shuffle on
+     * @param model The uniform shuffle or a casino procedure
+     */
+    void setShuffleModel(const ShuffleModel &model);
+
+    /**
+     * @brief setHistory Records every bet, card, action and outcome from now on, or stops recording
+     * @param history The writer to record to, owned by the caller and kept until it is replaced, null to stop recording
+     */
+    void setHistory(HandHistoryWriter *history);
+
+    /**
+     * @brief setEvents Publishes every change to the table from now on as a GameEvent, or stops publishing.
+     * Readers of the log start from a snapshot taken on this thread alongside GameEventLog::follow
+     * @param events The log to publish to, owned by the caller and kept until it is replaced, null to stop publishing
+     */
+    void setEvents(GameEventLog *events);
+
+    /**
+     * @brief apply Carries out a command with the mutator it names. Commands for the whole table ignore the hand
+     * @param command The command
+     */
+    void apply(const GameCommand &command);
+
+    /**
+     * @brief reseed Starts the shoe over from a seed, so the same seed deals the same cards from here on. Used to play a session again
+     * @param seed The seed
+     */
+    void reseed(uint64_t seed);
+
+    /**
+     * @brief setSeatMoney Gives a seat new money between rounds, bringing a bankrupt seat back or making one bankrupt. Used to start a new session
+     * @param seat The seat, which must have no split hands
+     * @param money The seat's money
+     */
+    void setSeatMoney(int seat, int money);
+
+    /**
+     * @brief stackCards Deals the given cards next, in order, ahead of the shoe. Used to replay a recorded round
+     * @param cards The cards in the order they are drawn
+     */
+    void stackCards(const std::vector<Card> &cards);
+
     /**
      * @brief setPlayerActive Sets the player at given index to ACTIVE
      * @param index The player to set to ACTIVE
@@ -108,16 +253,39 @@ public:
     void clearHands();
 
     /**
-     * @brief getAllPlayers Returns a constant of all players in the model
+     * @brief getAllPlayers Copies every hand in the model out into players. Use getPlayers to read them in place or getSnapshot to share them
      * @return A vector containing all of the players in the game
      */
-    const std::vector<Player> getAllPlayers() const;
+    std::vector<Player> getAllPlayers() const;
+
+    /**
+     * @brief getSnapshot Gets an immutable copy of every hand and the dealer's hand, for passing to the view.
+     * The copy is only made if the model has changed since the last snapshot, otherwise the last one is shared
+     * @return The snapshot of the current round
+     */
+    RoundSnapshot getSnapshot() const;
+
+    /**
+     * @brief getVersion Gets a number that goes up every time a hand or status in the model changes
+     * @return The version of the model
+     */
+    uint64_t getVersion() const;
 
 private:
     /**
-     * @brief players The players in the game
+     * @brief players The seats and hands in the game
+     */
+    PlayerTable players;
+
+    /**
+     * @brief rules The house rules of the table
      */
-    std::vector<Player> players;
+    TableRules rules;
+
+    /**
+     * @brief blackjackPayout The amount a blackjack wins per unit bet, worked out once from the rules
+     */
+    double blackjackPayout;
 
     /**
      * @brief deck The deck for the game
@@ -128,6 +296,74 @@ private:
      * @brief dealerHand The dealer's hand
      */
     Hand dealerHand;
+
+    /**
+     * @brief version Goes up every time a hand or status changes, so snapshots know when they are out of date
+     */
+    uint64_t version;
+
+    /**
+     * @brief snapshot The last snapshot taken, shared until the model changes again
+     */
+    mutable RoundSnapshot snapshot;
+
+    /**
+     * @brief history Where the rounds are recorded, null when they aren't
+     */
+    HandHistoryWriter *history = nullptr;
+
+    /**
+     * @brief recordedShoe The number of the last shoe recorded in the history
+     */
+    long long recordedShoe = 0;
+
+    /**
+     * @brief events Where the changes to the table are published, null when they aren't
+     */
+    GameEventLog *events = nullptr;
+
+    /**
+     * @brief publish Publishes a change to the table if there is a log
+     * @param type What changed
+     * @param hand The hand in play order, or the seat for MONEY
+     * @param value The card's code or the status
+     * @param amount The bet or the change in money
+     */
+    void publish(GAMEEVENT type, int hand, uint8_t value = 0, int amount = 0)
+    {
+        if (events)
+            events->publish(GameEvent{type, value, static_cast<uint16_t>(hand), amount});
+    }
+
+    /**
+     * @brief publishStatus Publishes a hand's status if there is a log
+     * @param position The hand in play order
+     */
+    void publishStatus(int position)
+    {
+        if (events)
+            publish(GAMEEVENT::STATUS, position, static_cast<uint8_t>(players.status(position)));
+    }
+
+    /**
+     * @brief drawCard Deals the next card from the deck, recording a new shoe first when the deck has just been shuffled
+     * @return The card
+     */
+    Card drawCard();
+
+    /**
+     * @brief dealerDraw Draws dealer cards until they stand. The rule is a template parameter so the draw loop never checks it
+     * @tparam HitsSoft17 True if the dealer hits soft 17
+     */
+    template <bool HitsSoft17>
+    void dealerDraw();
+
+    /**
+     * @brief rulesWithDecks Gets the default rules with the given number of decks
+     * @param deckCount The number of decks
+     * @return The rules
+     */
+    static TableRules rulesWithDecks(int deckCount);
 };
 
 #endif // GAMESTATE_H
@@ -0,0 +1,337 @@
+/**
+ * @brief Implementation of The GoldenRun class. It plays a fixed set of seeded tables, saves how each ended, and checks later builds end the same way
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/8/2025
+ */
+
+#include "goldenrun.h"
+#include "handhistoryreader.h"
+#include "handhistorywriter.h"
+#include "historyreplayer.h"
+#include "gamestate.h"
+#include "simulator.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+/**
+ * @brief shoeRounds The rounds played by the scenarios with a fast strategy, enough to pass through a few hundred shoes
+ */
+static const long long shoeRounds = 20000;
+
+/**
+ * @brief compositionRounds The rounds played by the composition strategy, which works out every decision from the unseen cards
+ */
+static const long long compositionRounds = 200;
+
+/**
+ * @brief payoutMoney The money the seat of a payout round starts with
+ */
+static const int payoutMoney = 1000;
+
+/**
+ * @brief The PayoutRound struct is one round dealt from stacked cards to a single seat, and the money it has to end with
+ */
+struct PayoutRound
+{
+    /**
+     * @brief name The name the round is reported under
+     */
+    std::string name;
+
+    /**
+     * @brief bet The seat's bet
+     */
+    int bet;
+
+    /**
+     * @brief cards The cards in the order they are drawn: the seat's first, the hole card, the seat's second, the up card, then any splits and the dealer's draws
+     */
+    std::vector<Card> cards;
+
+    /**
+     * @brief move The seat's first move, SPLIT splits once and SURRENDER gives the hand up. Every hand left stands after
+     */
+    MOVE move;
+
+    /**
+     * @brief expected The seat's money once the round is settled
+     */
+    int expected;
+};
+
+/**
+ * @brief playPayoutRound Plays a payout round on a table of the game's rules
+ * @param round The round
+ * @return The seat's money once the round is settled
+ */
+static int playPayoutRound(const PayoutRound &round)
+{
+    std::vector<Player> players;
+    players.emplace_back(payoutMoney, 0, false, 1, 0);
+    players[0].originalHand = true;
+    GameState model(players, TableRules::fromPreset(PRESET::GAME));
+
+    model.setPlayerBet(0, round.bet);
+    model.stackCards(round.cards);
+    model.dealInitialCards();
+
+    // The dealer's 21 ends the round before the seat plays, the same as Simulator::playRound
+    if (model.getDealerHand().getTotal() != 21)
+    {
+        model.setPlayerActive(0);
+        if (round.move == MOVE::SURRENDER)
+            model.surrender(0);
+        else
+        {
+            if (round.move == MOVE::SPLIT)
+                model.split(0);
+            for (int i = 0; i < model.getPlayerCount(); i++)
+                model.stand(i);
+            model.dealerPlay();
+        }
+    }
+    model.endRound();
+    return model.getPlayerTable().money(0);
+}
+
+std::vector<GoldenScenario> GoldenRun::scenarios()
+{
+    std::vector<GoldenScenario> scenarios;
+
+    GoldenScenario game;
+    game.name = "game";
+    game.rules = TableRules::fromPreset(PRESET::GAME);
+    game.players = 3;
+    game.rounds = shoeRounds;
+    scenarios.push_back(game);
+
+    GoldenScenario shoe;
+    shoe.name = "vegas-shoe";
+    shoe.rules = TableRules::fromPreset(PRESET::VEGAS_STRIP);
+    shoe.players = 5;
+    shoe.rounds = shoeRounds;
+    scenarios.push_back(shoe);
+
+    // Has to end the same as the shoe above, the background thread only changes when shoes are shuffled
+    GoldenScenario background = shoe;
+    background.name = "vegas-background";
+    background.backgroundShuffle = true;
+    scenarios.push_back(background);
+
+    GoldenScenario casino;
+    casino.name = "downtown-casino";
+    casino.rules = TableRules::fromPreset(PRESET::DOWNTOWN);
+    casino.players = 3;
+    casino.shuffleModel = ShuffleModel::casino(0.2);
+    casino.rounds = shoeRounds;
+    scenarios.push_back(casino);
+
+    GoldenScenario machine;
+    machine.name = "atlantic-csm";
+    machine.rules = TableRules::fromPreset(PRESET::ATLANTIC_CITY);
+    machine.rules.continuousShuffle = true;
+    machine.players = 2;
+    machine.rounds = shoeRounds;
+    scenarios.push_back(machine);
+
+    GoldenScenario sixFive;
+    sixFive.name = "six-five";
+    sixFive.rules = TableRules::fromPreset(PRESET::SIX_FIVE);
+    sixFive.players = 7;
+    sixFive.rounds = shoeRounds;
+    scenarios.push_back(sixFive);
+
+    GoldenScenario counting;
+    counting.name = "double-deck-counting";
+    counting.rules = TableRules::fromPreset(PRESET::DOUBLE_DECK);
+    counting.backend = BACKEND::COUNTING;
+    counting.rounds = shoeRounds;
+    scenarios.push_back(counting);
+
+    GoldenScenario composition;
+    composition.name = "single-deck-composition";
+    composition.rules = TableRules::fromPreset(PRESET::SINGLE_DECK);
+    composition.backend = BACKEND::COMPOSITION;
+    composition.rounds = compositionRounds;
+    scenarios.push_back(composition);
+
+    return scenarios;
+}
+
+GoldenResult GoldenRun::play(const GoldenScenario &scenario, uint64_t seed, long long rounds, const std::string &historyPath)
+{
+    GoldenResult result;
+    result.name = scenario.name;
+    result.seed = seed;
+    result.rounds = rounds;
+
+    Simulator simulator(scenario.players, scenario.rules, 10, Rng(seed), scenario.backend);
+    simulator.setShuffleModel(scenario.shuffleModel);
+    simulator.setBackgroundShuffle(scenario.backgroundShuffle);
+    {
+        HandHistoryWriter history(historyPath, scenario.players, scenario.rules.deckCount);
+        simulator.setHistory(&history);
+        simulator.run(rounds);
+        simulator.setHistory(nullptr);
+        history.close();
+    }
+
+    const PlayerTable &table = simulator.getPlayerTable();
+    for (int seat = 0; seat < table.getSeatCount(); seat++)
+        result.bankrolls.push_back(table.money(seat));
+
+    // The replayer checks every round ends with the recorded money, so it throws before it could end anywhere else
+    long long replayed;
+    try
+    {
+        HandHistoryReader reader(historyPath);
+        HistoryReplayer replayer(reader);
+        replayed = replayer.replay(0, rounds, scenario.rules, nullptr);
+    }
+    catch (...)
+    {
+        std::remove(historyPath.c_str());
+        throw;
+    }
+    std::remove(historyPath.c_str());
+
+    if (replayed != rounds)
+        throw std::runtime_error("GoldenRun: " + scenario.name + " replayed " + std::to_string(replayed) + " of " + std::to_string(rounds) + " rounds");
+    return result;
+}
+
+void GoldenRun::write(const std::string &path, uint64_t seed, std::ostream &report)
+{
+    std::ofstream out(path);
+    if (!out)
+        throw std::runtime_error("GoldenRun: can't write " + path);
+
+    out << "# scenario seed rounds, then each seat's money after the last round\n";
+    for (const GoldenScenario &scenario : scenarios())
+    {
+        GoldenResult result = play(scenario, seed, scenario.rounds, path + ".bjh");
+        out << result.name << ' ' << result.seed << ' ' << result.rounds;
+        for (long long bankroll : result.bankrolls)
+            out << ' ' << bankroll;
+        out << '\n';
+        report << scenario.name << ": saved\n";
+    }
+
+    if (!out)
+        throw std::runtime_error("GoldenRun: can't write " + path);
+}
+
+int GoldenRun::check(const std::string &path, std::ostream &report)
+{
+    std::ifstream in(path);
+    if (!in)
+        throw std::runtime_error("GoldenRun: can't read " + path);
+
+    std::vector<GoldenScenario> known = scenarios();
+    std::vector<bool> checked(known.size(), false);
+    int failures = checkPayouts(report);
+
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        GoldenResult saved;
+        std::istringstream fields(line);
+        fields >> saved.name >> saved.seed >> saved.rounds;
+        long long bankroll;
+        while (fields >> bankroll)
+            saved.bankrolls.push_back(bankroll);
+
+        std::size_t index = 0;
+        while (index < known.size() && known[index].name != saved.name)
+            index++;
+        if (index == known.size())
+        {
+            report << saved.name << ": no longer a scenario\n";
+            failures++;
+            continue;
+        }
+        checked[index] = true;
+
+        GoldenResult result;
+        try
+        {
+            result = play(known[index], saved.seed, saved.rounds, path + ".bjh");
+        }
+        catch (const std::runtime_error &error)
+        {
+            report << saved.name << ": " << error.what() << "\n";
+            failures++;
+            continue;
+        }
+
+        if (result.bankrolls == saved.bankrolls)
+        {
+            report << saved.name << ": ok\n";
+            continue;
+        }
+
+        failures++;
+        report << saved.name << ": differs";
+        for (std::size_t seat = 0; seat < result.bankrolls.size() || seat < saved.bankrolls.size(); seat++)
+        {
+            long long expected = seat < saved.bankrolls.size() ? saved.bankrolls[seat] : 0;
+            long long actual = seat < result.bankrolls.size() ? result.bankrolls[seat] : 0;
+            if (expected != actual)
+                report << ", seat " << seat << " saved " << expected << " now " << actual;
+        }
+        report << "\n";
+    }
+
+    for (std::size_t i = 0; i < known.size(); i++)
+    {
+        if (!checked[i])
+        {
+            report << known[i].name << ": not saved, write the golden runs again\n";
+            failures++;
+        }
+    }
+    return failures;
+}
+
+int GoldenRun::checkPayouts(std::ostream &report)
+{
+    const Card ace(SUIT::SPADES, RANK::ACE);
+    const Card seven(SUIT::SPADES, RANK::SEVEN);
+    const Card ten(SUIT::SPADES, RANK::TEN);
+    const Card queen(SUIT::HEARTS, RANK::QUEEN);
+    const Card king(SUIT::CLUBS, RANK::KING);
+
+    std::vector<PayoutRound> rounds;
+
+    // Each split ace makes 21 with a ten, paid even money against the dealer's 17
+    rounds.push_back({"split-aces-draw-tens", 10, {ace, ten, ace, seven, king, queen}, MOVE::SPLIT, payoutMoney + 20});
+
+    // A natural is paid 3:2 even when the dealer draws to 21, and pushes against the dealer's natural
+    const Card five(SUIT::SPADES, RANK::FIVE);
+    const Card six(SUIT::SPADES, RANK::SIX);
+    rounds.push_back({"natural-beats-drawn-21", 10, {ace, six, king, five, ten}, MOVE::STAND, payoutMoney + 15});
+    rounds.push_back({"natural-pushes-natural", 10, {ace, ace, king, queen}, MOVE::STAND, payoutMoney});
+
+    // Surrendering an odd bet loses half of it rounded down
+    rounds.push_back({"surrender-odd-bet", 15, {ten, ten, six, seven}, MOVE::SURRENDER, payoutMoney - 7});
+
+    int failures = 0;
+    for (const PayoutRound &round : rounds)
+    {
+        int money = playPayoutRound(round);
+        if (money == round.expected)
+        {
+            report << round.name << ": ok\n";
+            continue;
+        }
+        failures++;
+        report << round.name << ": differs, should end with " << round.expected << " but ends with " << money << "\n";
+    }
+    return failures;
+}
@@ -0,0 +1,137 @@
+#ifndef GOLDENRUN_H
+#define GOLDENRUN_H
+
+#include "botstrategy.h"
+#include "shufflekernel.h"
+#include "tablerules.h"
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The GoldenScenario struct is one table the golden runs play: its rules, seats, strategy and shuffling
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/8/2025
+ */
+struct GoldenScenario
+{
+    /**
+     * @brief name The name the scenario is saved under
+     */
+    std::string name;
+
+    /**
+     * @brief rules The table rules
+     */
+    TableRules rules;
+
+    /**
+     * @brief players The number of bot seats
+     */
+    int players = 1;
+
+    /**
+     * @brief backend The strategy every seat plays
+     */
+    BACKEND backend = BACKEND::BASIC;
+
+    /**
+     * @brief shuffleModel How the shoe is shuffled
+     */
+    ShuffleModel shuffleModel;
+
+    /**
+     * @brief backgroundShuffle True to shuffle the next shoes on a background thread
+     */
+    bool backgroundShuffle = false;
+
+    /**
+     * @brief rounds The number of rounds to play, fewer for the slow strategies
+     */
+    long long rounds = 0;
+};
+
+/**
+ * @brief The GoldenResult struct is what a golden run ended with
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/8/2025
+ */
+struct GoldenResult
+{
+    /**
+     * @brief name The scenario played
+     */
+    std::string name;
+
+    /**
+     * @brief seed The seed the shoe was dealt from
+     */
+    uint64_t seed = 0;
+
+    /**
+     * @brief rounds The number of rounds played
+     */
+    long long rounds = 0;
+
+    /**
+     * @brief bankrolls Each seat's money after the last round
+     */
+    std::vector<long long> bankrolls;
+};
+
+/**
+ * @brief The GoldenRun class plays a fixed set of seeded tables and saves each seat's bankroll at the end, so a later build can play them again
+ * and check it ends with the same money. Any change to the rules, strategies, shuffling or dealing that changes a single card or decision shows up,
+ * and a change that should leave play alone can be checked to do so. Every run is also recorded to a hand history and replayed, which checks the replay
+ * ends every round with the recorded money
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/8/2025
+ */
+class GoldenRun
+{
+public:
+    /**
+     * @brief scenarios Gets the tables the golden runs play, covering every strategy, a shoe, the background and casino shuffles and a continuous shuffler
+     * @return The scenarios
+     */
+    static std::vector<GoldenScenario> scenarios();
+
+    /**
+     * @brief play Plays a scenario on one thread from a seed. Throws std::runtime_error if the history can't be written or doesn't replay to the same money
+     * @param scenario The scenario
+     * @param seed The seed the shoe is dealt from
+     * @param rounds The number of rounds to play
+     * @param historyPath Where the run's hand history is recorded to replay it, removed afterwards
+     * @return What the run ended with
+     */
+    static GoldenResult play(const GoldenScenario &scenario, uint64_t seed, long long rounds, const std::string &historyPath);
+
+    /**
+     * @brief write Plays every scenario and saves the results. Throws std::runtime_error if the file can't be written or a replay fails
+     * @param path The file to save to, one line per scenario
+     * @param seed The seed every scenario is dealt from
+     * @param report Told about each scenario as it finishes
+     */
+    static void write(const std::string &path, uint64_t seed, std::ostream &report);
+
+    /**
+     * @brief check Plays every saved scenario again with its seed and rounds and compares the bankrolls. Throws std::runtime_error if the file can't be read
+     * @param path The file saved by write
+     * @param report Told whether each scenario matches, and how it differs if it doesn't
+     * @return The number of scenarios that don't match, couldn't be replayed, or are no longer known
+     */
+    static int check(const std::string &path, std::ostream &report);
+
+    /**
+     * @brief checkPayouts Settles rounds dealt from stacked cards whose payouts are known, such as a split ace drawing a ten. Run by check
+     * @param report Told whether each round paid what it should
+     * @return The number of rounds that paid something else
+     */
+    static int checkPayouts(std::ostream &report);
+};
+
+#endif // GOLDENRUN_H
@@ -1,5 +1,6 @@
 /**
- * @brief Implementation of The Hand class. It reprsents a single blackjack hand. It holds the cards, bet, and supporting functions
+ * @brief Implementation of The Hand class. It reprsents a single blackjack hand. It holds the cards, bet, and supporting functions.
+ * Cards are stored inline so dealing, copying and splitting a hand never allocate
  *
  * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
  * @date 4/22/2025
@@ -7,101 +8,84 @@
 
 #include "hand.h"
 #include "rank.h"
-#include <utility>
 
 Hand::Hand() : Hand(0) {};
 
-Hand::Hand(int bet) : bet(bet) {}
+Hand::Hand(int bet) : cardCount(0), hardTotal(0), aceCount(0), bet(bet) {}
 
-Hand::Hand(const Hand &hand)
+void Hand::addCard(const Card &card)
 {
-    this->bet = hand.getBet();
+    // A hand can't hold more than maxCards without already being bust, so extra cards are ignored
+    if (cardCount >= maxCards)
+        return;
 
-    // Copy all of the cards in the given hand
-    for (const Card &card : hand.getCards())
-    {
-        cards.emplace_back(card.getSuit(), card.getRank(), card.getImagePath());
-    }
+    cards[cardCount++] = card;
+    hardTotal += hardValue(card);
+    aceCount += card.getRank() == RANK::ACE;
 }
 
-Hand &Hand::operator=(const Hand hand)
+int Hand::getBet() const
 {
-    this->bet = hand.getBet();
-
-    cards.clear();
-
-    // Copy all of the cards in the given hand
-    for (const Card &card : hand.getCards())
-    {
-        cards.emplace_back(card.getSuit(), card.getRank(), card.getImagePath());
-    }
-    return *this;
+    return bet;
 }
 
-void Hand::addCard(const Card &card)
+void Hand::setBet(int amount)
 {
-    cards.push_back(card);
+    bet = amount;
 }
 
-int Hand::getBet() const
+CardView Hand::getCards() const
 {
-    return bet;
+    return CardView{cards, static_cast<std::size_t>(cardCount)};
 }
 
-void Hand::setBet(int amount)
+int Hand::getTotal() const
 {
-    bet = amount;
+    // At most one ace can count as 11 without busting
+    return isSoft() ? hardTotal + 10 : hardTotal;
 }
 
-void Hand::setCardImagePath(int index, QString imagePath)
+Card Hand::removeLastCard()
 {
-    cards[index].setImagePath(imagePath);
+    Card card = cards[--cardCount];
+    hardTotal -= hardValue(card);
+    aceCount -= card.getRank() == RANK::ACE;
+    return card;
 }
 
-const std::vector<Card> &Hand::getCards() const
+bool Hand::isSoft() const
 {
-    return cards;
+    // The hand is considered soft if an Ace can still be counted as 11.
+    return aceCount > 0 && hardTotal <= 11;
 }
 
-int Hand::getTotal() const
+bool Hand::isPair() const
 {
-    return calculateTotalAndSoft().first;
+    return cardCount == 2 && cards[0].getRank() == cards[1].getRank();
 }
 
-const Card &Hand::removeLastCard()
+int Hand::getStateId() const
 {
-    const Card &card = cards[cards.size() - 1];
-    cards.pop_back();
-    return card;
+    // Value index by rank like ShoeComposition::indexOf
+    static const int valueIndices[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 8, 8, 9};
+
+    int soft = (aceCount > 0) & (hardTotal <= 11);
+    int pair = (cardCount == 2) & (cards[0].getRank() == cards[1].getRank());
+    int single = hardTotal + soft * (10 + softStateBase);
+    int paired = pairStateBase + valueIndices[static_cast<int>(cards[0].getRank())];
+
+    // Select between the two with a mask rather than a branch
+    return single ^ ((single ^ paired) & -pair);
 }
 
-bool Hand::isSoft() const
+bool Hand::isBlackjack() const
 {
-    return calculateTotalAndSoft().second;
+    return cardCount == 2 && aceCount == 1 && hardTotal == 11;
 }
 
-std::pair<int, bool> Hand::calculateTotalAndSoft() const
+int Hand::hardValue(const Card &card)
 {
-    int total = 0;
-    int softAces = 0;
-
-    // Count total value and number of Aces counted as 11.
-    for (const Card &card : cards)
-    {
-        int value = Rank::blackjackValue(card.getRank());
-        if (value == 11)
-            softAces++;
-        total += value;
-    }
-
-    // Adjust Aces from 11 to 1 if the total exceeds 21.
-    while (total > 21 && softAces > 0)
-    {
-        total -= 10;
-        softAces--;
-    }
-
-    // The hand is considered soft if at least one Ace is still counted as 11.
-    bool soft = (softAces > 0);
-    return std::make_pair(total, soft);
+    // Lookup by rank instead of Rank::blackjackValue's switch, aces are 1
+    static const int values[] = {2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 10, 10, 1};
+    return values[static_cast<int>(card.getRank())];
 }
@@ -1,11 +1,66 @@
 #ifndef HAND_H
 #define HAND_H
 
-#include <vector>
+#include <cstddef>
+#include <stdexcept>
 #include "card.h"
 
 /**
- * @brief The Hand class reprsents a single blackjack hand. It holds the cards, bet, and supporting functions
+ * @brief The CardView struct is a read only view of the cards in a hand. It can be used like a const std::vector<Card>
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/22/2025
+ */
+struct CardView
+{
+    /**
+     * @brief first The first card in the view
+     */
+    const Card *first;
+
+    /**
+     * @brief count The number of cards in the view
+     */
+    std::size_t count;
+
+    /**
+     * @brief begin Gets the first card to iterate from
+     */
+    const Card *begin() const { return first; }
+
+    /**
+     * @brief end Gets one past the last card
+     */
+    const Card *end() const { return first + count; }
+
+    /**
+     * @brief size Gets the number of cards in the view
+     */
+    std::size_t size() const { return count; }
+
+    /**
+     * @brief operator [] Gets the card at the given index without bounds checking
+     * @param index The index of the card
+     */
+    const Card &operator[](std::size_t index) const { return first[index]; }
+
+    /**
+     * @brief at Gets the card at the given index
+     * @param index The index of the card
+     * @throws std::out_of_range if the index is past the end of the view
+     */
+    const Card &at(std::size_t index) const
+    {
+        if (index >= count)
+            throw std::out_of_range("CardView::at");
+        return first[index];
+    }
+};
+
+/**
+ * @brief The Hand class reprsents a single blackjack hand. It holds the cards, bet, and supporting functions.
+ * Cards are stored inline so dealing, copying and splitting a hand never allocate, and the total is kept up to date as cards are added
+ * and removed so every query is O(1)
  *
  * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
  * @date 4/22/2025
@@ -14,28 +69,35 @@ class Hand
 {
 public:
     /**
-     * @brief Hand Constructor that creates a new empty hand with a bet of 0
+     * @brief maxCards The most cards a hand can hold. Twenty one aces is the longest hand that can still take a card, plus the card that busts it
      */
-    Hand();
+    static constexpr int maxCards = 22;
 
     /**
-     * @brief Hand Constructor that creates a new empty hand with the initial bet
-     * @param bet The initial bet for the hand
+     * @brief softStateBase Added to the total of a soft hand for its state id
      */
-    Hand(int bet);
+    static constexpr int softStateBase = 32;
 
     /**
-     * @brief Hand Constructor that copies another hand
-     * @param other The hand to copy
+     * @brief pairStateBase Added to the value index of a pair for its state id, see ShoeComposition for the indices
      */
-    Hand(const Hand &other);
+    static constexpr int pairStateBase = 64;
 
     /**
-     * @brief operator = Assignment operator to set the current hand to the other hand
-     * @param other The hand to copy
-     * @return A reference to the new hand
+     * @brief stateCount The number of state ids, every id is below this
      */
-    Hand &operator=(const Hand other);
+    static constexpr int stateCount = pairStateBase + 10;
+
+    /**
+     * @brief Hand Constructor that creates a new empty hand with a bet of 0
+     */
+    Hand();
+
+    /**
+     * @brief Hand Constructor that creates a new empty hand with the initial bet
+     * @param bet The initial bet for the hand
+     */
+    Hand(int bet);
 
     /**
      * @brief addCard Adds a card to the hand
@@ -55,6 +117,25 @@ public:
      */
     bool isSoft() const;
 
+    /**
+     * @brief isPair Checks if the hand is exactly two cards of the same rank
+     * @return True if the hand is a pair
+     */
+    bool isPair() const;
+
+    /**
+     * @brief getStateId Gets a small id for the decision the hand is in, worked out without branches.
+     * Hard hands are their total, soft hands are softStateBase plus their total and pairs are pairStateBase plus their value index
+     * @return The state id, less than stateCount
+     */
+    int getStateId() const;
+
+    /**
+     * @brief isBlackjack Checks if the hand is a natural, 21 with the first two cards
+     * @return True if the hand is a blackjack
+     */
+    bool isBlackjack() const;
+
     /**
      * @brief getBet Gets the current ammount bet
      * @return Returns an int of the bet
@@ -67,30 +148,38 @@ public:
      */
     void setBet(int amount);
 
-    /**
-     * @brief setCardImagePath Sets the card at the current index to the new card
-     * @param index The index to change in cards
-     * @param imagePath The new image path
-     */
-    void setCardImagePath(int index, QString imagePath);
-
     /**
      * @brief getCards Gets the cards in the hand
-     * @return A vector of the cards in the hand
+     * @return A view of the cards in the hand
      */
-    const std::vector<Card> &getCards() const;
+    CardView getCards() const;
 
     /**
      * @brief removeLastCard Removes the last card in the hand
      * @return Returns the removed card from the hands
      */
-    const Card &removeLastCard();
+    Card removeLastCard();
 
 private:
     /**
-     * @brief cards The cards in the hand
+     * @brief cards The cards in the hand, only the first cardCount are dealt
+     */
+    Card cards[maxCards];
+
+    /**
+     * @brief cardCount The number of cards in the hand
+     */
+    int cardCount;
+
+    /**
+     * @brief hardTotal The running total of the hand with every ace counted as 1
+     */
+    int hardTotal;
+
+    /**
+     * @brief aceCount The running number of aces in the hand
      */
-    std::vector<Card> cards;
+    int aceCount;
 
     /**
      * @brief bet The amount bet on this hand
@@ -98,10 +187,11 @@ private:
     int bet;
 
     /**
-     * @brief calculateTotalAndSoft Calculates the hand's total and determines if it is soft.
-     * @return A pair where the first element is the total value of the hand and the second element is a bool indicating if the hand is soft (true if soft, false if hard).
+     * @brief hardValue Gets the value of a card with aces counted as 1
+     * @param card The card to get the value of
+     * @return The value of the card from 1 to 10
      */
-    std::pair<int, bool> calculateTotalAndSoft() const;
+    static int hardValue(const Card &card);
 };
 
 #endif // HAND_H
@@ -0,0 +1,316 @@
+#ifndef HANDHISTORY_H
+#define HANDHISTORY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace HistoryRecord
+{
+
+    /**
+     * @brief The RECORD enum The kinds of record in a hand history, written as the first byte of each record.
+     * The fields that follow are varints unless noted, cards are one byte each as Card::getCode:
+     *   SHOE       seed as 8 bytes little endian. Comes before the record holding the first card of the shoe
+     *   BET        seat, amount
+     *   DEAL       seats dealt, then each seat, then the two cards of each seat in the same order, then the dealer's hole card and up card
+     *   HIT        hand, card
+     *   DOUBLE     hand, card
+     *   STAND      hand
+     *   SPLIT      hand, the card to the split hand, the card to the new hand right after it
+     *   SURRENDER  hand
+     *   DEALER     cards drawn, then the cards
+     *   SETTLE     hands, then status byte and bet for each, then seats and the zigzagged change in each seat's money since the last SEATS or SETTLE.
+     *              Ends the round
+     *   SEATS      seats, then the money of each. Starts every block with the money before its first round, so any block can be read on its own
+     *
+     * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+     * @date 5/6/2025
+     */
+    enum class RECORD : uint8_t
+    {
+        SHOE,
+        BET,
+        DEAL,
+        HIT,
+        DOUBLE,
+        STAND,
+        SPLIT,
+        SURRENDER,
+        DEALER,
+        SETTLE,
+        SEATS
+    };
+
+    /**
+     * @brief toString Converts a RECORD to a string
+     * @param record The RECORD to convert
+     * @return A string of the RECORD provided
+     */
+    inline std::string toString(RECORD record)
+    {
+        switch (record)
+        {
+        case RECORD::SHOE:
+            return "Shoe";
+        case RECORD::BET:
+            return "Bet";
+        case RECORD::DEAL:
+            return "Deal";
+        case RECORD::HIT:
+            return "Hit";
+        case RECORD::DOUBLE:
+            return "Double";
+        case RECORD::STAND:
+            return "Stand";
+        case RECORD::SPLIT:
+            return "Split";
+        case RECORD::SURRENDER:
+            return "Surrender";
+        case RECORD::DEALER:
+            return "Dealer";
+        case RECORD::SETTLE:
+            return "Settle";
+        case RECORD::SEATS:
+            return "Seats";
+        }
+
+        return "Unknown record";
+    }
+
+    /**
+     * @brief allRecords An array of all RECORD values for iteration
+     */
+    inline constexpr RECORD allRecords[] = {
+        RECORD::SHOE,
+        RECORD::BET,
+        RECORD::DEAL,
+        RECORD::HIT,
+        RECORD::DOUBLE,
+        RECORD::STAND,
+        RECORD::SPLIT,
+        RECORD::SURRENDER,
+        RECORD::DEALER,
+        RECORD::SETTLE,
+        RECORD::SEATS};
+}
+
+using HistoryRecord::RECORD;
+
+namespace Varint
+{
+
+    /**
+     * @brief maxBytes The most bytes a 64 bit varint takes
+     */
+    inline constexpr std::size_t maxBytes = 10;
+
+    /**
+     * @brief write Writes a number 7 bits at a time, low bits first, with the top bit of each byte set if more follow
+     * @param out Where to write, with room for maxBytes
+     * @param value The number
+     * @return The byte after the last one written
+     */
+    inline uint8_t *write(uint8_t *out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            *out++ = static_cast<uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+        *out++ = static_cast<uint8_t>(value);
+        return out;
+    }
+
+    /**
+     * @brief zigzag Maps a signed number to an unsigned one with small magnitudes staying small: 0, -1, 1, -2 become 0, 1, 2, 3
+     * @param value The signed number
+     * @return The number to write
+     */
+    inline uint64_t zigzag(int64_t value)
+    {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    /**
+     * @brief unzigzag Undoes zigzag
+     * @param value The number read
+     * @return The signed number
+     */
+    inline int64_t unzigzag(uint64_t value)
+    {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    /**
+     * @brief read Reads a number written by write. Throws std::runtime_error if it runs off the end
+     * @param in The first byte, moved past the number
+     * @param end The end of the bytes
+     * @return The number
+     */
+    inline uint64_t read(const uint8_t *&in, const uint8_t *end)
+    {
+        // Seats, hands and most changes in money fit in one byte
+        if (in != end && *in < 0x80)
+            return *in++;
+
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            if (in == end)
+                throw std::runtime_error("Varint: truncated number");
+            uint8_t byte = *in++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (byte < 0x80)
+                return value;
+        }
+        throw std::runtime_error("Varint: number is too long");
+    }
+}
+
+/**
+ * @brief The HistoryFileHeader struct starts a hand history file: the magic "BJHH", the format version, the number of decks and the number of seats
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/6/2025
+ */
+struct HistoryFileHeader
+{
+    /**
+     * @brief size The number of bytes of the header
+     */
+    static constexpr std::size_t size = 8;
+
+    /**
+     * @brief currentVersion The version of the format written
+     */
+    static constexpr uint8_t currentVersion = 2;
+
+    /**
+     * @brief version The version of the format
+     */
+    uint8_t version = currentVersion;
+
+    /**
+     * @brief deckCount The number of decks in the shoe
+     */
+    uint8_t deckCount = 0;
+
+    /**
+     * @brief seatCount The number of seats at the table
+     */
+    uint16_t seatCount = 0;
+
+    /**
+     * @brief write Writes the header
+     * @param out Where to write, with room for size bytes
+     */
+    void write(uint8_t *out) const
+    {
+        out[0] = 'B';
+        out[1] = 'J';
+        out[2] = 'H';
+        out[3] = 'H';
+        out[4] = version;
+        out[5] = deckCount;
+        out[6] = static_cast<uint8_t>(seatCount);
+        out[7] = static_cast<uint8_t>(seatCount >> 8);
+    }
+
+    /**
+     * @brief read Reads a header. Throws std::runtime_error if it is not a hand history this version can read
+     * @param in The size bytes of the header
+     * @return The header
+     */
+    static HistoryFileHeader read(const uint8_t *in)
+    {
+        if (in[0] != 'B' || in[1] != 'J' || in[2] != 'H' || in[3] != 'H')
+            throw std::runtime_error("HistoryFileHeader: not a hand history");
+
+        HistoryFileHeader header;
+        header.version = in[4];
+        if (header.version != currentVersion)
+            throw std::runtime_error("HistoryFileHeader: unknown version " + std::to_string(header.version));
+        header.deckCount = in[5];
+        header.seatCount = static_cast<uint16_t>(in[6] | (in[7] << 8));
+        return header;
+    }
+};
+
+/**
+ * @brief The HistoryBlockHeader struct comes before each block of records. Blocks only break between rounds,
+ * and their headers are fixed size so a reader can hop from block to block without decompressing any
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/6/2025
+ */
+struct HistoryBlockHeader
+{
+    /**
+     * @brief size The number of bytes of the header
+     */
+    static constexpr std::size_t size = 20;
+
+    /**
+     * @brief rawSize The number of bytes of records in the block
+     */
+    uint32_t rawSize = 0;
+
+    /**
+     * @brief storedSize The number of bytes after the header, equal to rawSize if the records didn't compress and were stored as they are
+     */
+    uint32_t storedSize = 0;
+
+    /**
+     * @brief roundCount The number of rounds settled in the block
+     */
+    uint32_t roundCount = 0;
+
+    /**
+     * @brief firstRound The number of rounds settled before the block
+     */
+    uint64_t firstRound = 0;
+
+    /**
+     * @brief isCompressed Checks if the records were compressed
+     */
+    bool isCompressed() const { return storedSize != rawSize; }
+
+    /**
+     * @brief write Writes the header, little endian
+     * @param out Where to write, with room for size bytes
+     */
+    void write(uint8_t *out) const
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            out[i] = static_cast<uint8_t>(rawSize >> (8 * i));
+            out[4 + i] = static_cast<uint8_t>(storedSize >> (8 * i));
+            out[8 + i] = static_cast<uint8_t>(roundCount >> (8 * i));
+        }
+        for (int i = 0; i < 8; i++)
+            out[12 + i] = static_cast<uint8_t>(firstRound >> (8 * i));
+    }
+
+    /**
+     * @brief read Reads a header
+     * @param in The size bytes of the header
+     * @return The header
+     */
+    static HistoryBlockHeader read(const uint8_t *in)
+    {
+        HistoryBlockHeader header;
+        for (int i = 0; i < 4; i++)
+        {
+            header.rawSize |= static_cast<uint32_t>(in[i]) << (8 * i);
+            header.storedSize |= static_cast<uint32_t>(in[4 + i]) << (8 * i);
+            header.roundCount |= static_cast<uint32_t>(in[8 + i]) << (8 * i);
+        }
+        for (int i = 0; i < 8; i++)
+            header.firstRound |= static_cast<uint64_t>(in[12 + i]) << (8 * i);
+        return header;
+    }
+};
+
+#endif // HANDHISTORY_H
@@ -0,0 +1,362 @@
+/**
+ * @brief Implementation of The HandHistoryReader class. It maps a hand history file into memory, indexes its blocks and reads them in place,
+ * and of The HistoryCursor class which steps through the records of a block
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/7/2025
+ */
+
+#include "handhistoryreader.h"
+#include "blockcodec.h"
+#include <algorithm>
+#include <climits>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+HistoryCursor::HistoryCursor(const uint8_t *begin, const uint8_t *end, long long firstRound) : in(begin), end(end), round(firstRound) {}
+
+bool HistoryCursor::next()
+{
+    if (in == end)
+        return false;
+
+    // A SETTLE ends its round, so whatever follows is part of the next one
+    if (settled)
+    {
+        round++;
+        settled = false;
+    }
+
+    uint8_t type = *in++;
+    if (type > static_cast<uint8_t>(RECORD::SEATS))
+        throw std::runtime_error("HistoryCursor: unknown record " + std::to_string(type));
+    record = static_cast<RECORD>(type);
+    cardCount = 0;
+
+    switch (record)
+    {
+    case RECORD::SHOE:
+        if (end - in < 8)
+            throw std::runtime_error("HistoryCursor: truncated shoe");
+        seed = 0;
+        for (int i = 0; i < 8; i++)
+            seed |= static_cast<uint64_t>(in[i]) << (8 * i);
+        in += 8;
+        break;
+    case RECORD::BET:
+        index = readInt();
+        amount = readInt();
+        break;
+    case RECORD::DEAL:
+    {
+        // Each seat takes at least a byte of seat and two cards
+        int dealt = readCount(3);
+        seats.resize(dealt);
+        for (int &seat : seats)
+            seat = readInt();
+        readCards(2 * dealt + 2);
+        break;
+    }
+    case RECORD::HIT:
+    case RECORD::DOUBLE:
+        index = readInt();
+        readCards(1);
+        break;
+    case RECORD::STAND:
+    case RECORD::SURRENDER:
+        index = readInt();
+        break;
+    case RECORD::SPLIT:
+        index = readInt();
+        readCards(2);
+        break;
+    case RECORD::DEALER:
+        readCards(readCount(1));
+        break;
+    case RECORD::SETTLE:
+    {
+        int hands = readCount(2);
+        statuses.resize(hands);
+        bets.resize(hands);
+        for (int hand = 0; hand < hands; hand++)
+        {
+            if (in == end || *in > static_cast<uint8_t>(PLAYERSTATUS::LOST))
+                throw std::runtime_error("HistoryCursor: bad status");
+            statuses[hand] = static_cast<PLAYERSTATUS>(*in++);
+            bets[hand] = readInt();
+        }
+
+        // Seats with no SEATS record before them count up from 0, the same as the writer
+        int seatCount = readCount(1);
+        money.resize(seatCount, 0);
+        for (int seat = 0; seat < seatCount; seat++)
+            money[seat] += Varint::unzigzag(Varint::read(in, end));
+        settled = true;
+        break;
+    }
+    case RECORD::SEATS:
+    {
+        int seatCount = readCount(1);
+        money.resize(seatCount);
+        for (long long &seatMoney : money)
+            seatMoney = Varint::unzigzag(Varint::read(in, end));
+        break;
+    }
+    }
+    return true;
+}
+
+int HistoryCursor::readCount(std::size_t bytesEach)
+{
+    uint64_t count = Varint::read(in, end);
+    if (count > static_cast<uint64_t>(end - in) / bytesEach)
+        throw std::runtime_error("HistoryCursor: count overruns the block");
+    return static_cast<int>(count);
+}
+
+int HistoryCursor::readInt()
+{
+    uint64_t value = Varint::read(in, end);
+    if (value > INT_MAX)
+        throw std::runtime_error("HistoryCursor: number out of range");
+    return static_cast<int>(value);
+}
+
+void HistoryCursor::readCards(int count)
+{
+    if (count > end - in)
+        throw std::runtime_error("HistoryCursor: truncated cards");
+    for (int i = 0; i < count; i++)
+        if (in[i] >= Card::count)
+            throw std::runtime_error("HistoryCursor: bad card");
+    cards = in;
+    cardCount = count;
+    in += count;
+}
+
+HandHistoryReader::HandHistoryReader(const std::string &path)
+{
+    map(path);
+    try
+    {
+        buildIndex();
+    }
+    catch (...)
+    {
+        // The destructor doesn't run when a constructor throws
+        unmap();
+        throw;
+    }
+}
+
+HandHistoryReader::~HandHistoryReader()
+{
+    unmap();
+}
+
+#ifdef _WIN32
+void HandHistoryReader::map(const std::string &path)
+{
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("HandHistoryReader: can't open " + path);
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        throw std::runtime_error("HandHistoryReader: can't map " + path);
+    }
+
+    // The view keeps the mapping open, and the mapping keeps the file open
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+        throw std::runtime_error("HandHistoryReader: can't map " + path);
+    data = static_cast<const uint8_t *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (data == nullptr)
+    {
+        CloseHandle(mapping);
+        mapping = nullptr;
+        throw std::runtime_error("HandHistoryReader: can't map " + path);
+    }
+    size = static_cast<std::size_t>(fileSize.QuadPart);
+}
+
+void HandHistoryReader::unmap()
+{
+    if (data != nullptr)
+        UnmapViewOfFile(data);
+    if (mapping != nullptr)
+        CloseHandle(mapping);
+    data = nullptr;
+    mapping = nullptr;
+}
+#else
+void HandHistoryReader::map(const std::string &path)
+{
+    int file = ::open(path.c_str(), O_RDONLY);
+    if (file == -1)
+        throw std::runtime_error("HandHistoryReader: can't open " + path);
+
+    struct stat status;
+    if (::fstat(file, &status) != 0 || status.st_size == 0)
+    {
+        ::close(file);
+        throw std::runtime_error("HandHistoryReader: can't map " + path);
+    }
+
+    // The mapping keeps the file open
+    void *view = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_SHARED, file, 0);
+    ::close(file);
+    if (view == MAP_FAILED)
+        throw std::runtime_error("HandHistoryReader: can't map " + path);
+
+    data = static_cast<const uint8_t *>(view);
+    size = static_cast<std::size_t>(status.st_size);
+}
+
+void HandHistoryReader::unmap()
+{
+    if (data != nullptr)
+        ::munmap(const_cast<uint8_t *>(data), size);
+    data = nullptr;
+}
+#endif
+
+void HandHistoryReader::buildIndex()
+{
+    if (size < HistoryFileHeader::size)
+        throw std::runtime_error("HandHistoryReader: not a hand history");
+    header = HistoryFileHeader::read(data);
+
+    // Only block headers are touched, so indexing costs a page per block however big the file is
+    std::size_t position = HistoryFileHeader::size;
+    uint64_t nextRound = 0;
+    while (size - position >= HistoryBlockHeader::size)
+    {
+        HistoryBlock block;
+        block.offset = position + HistoryBlockHeader::size;
+        block.header = HistoryBlockHeader::read(data + position);
+
+        // The last block may still be being written
+        if (block.header.storedSize > size - block.offset)
+            break;
+        if (block.header.storedSize > block.header.rawSize || block.header.firstRound != nextRound)
+            throw std::runtime_error("HandHistoryReader: corrupt block header at byte " + std::to_string(position));
+
+        blocks.push_back(block);
+        nextRound += block.header.roundCount;
+        position = block.offset + block.header.storedSize;
+    }
+}
+
+long long HandHistoryReader::getRoundCount() const
+{
+    if (blocks.empty())
+        return 0;
+    return static_cast<long long>(blocks.back().header.firstRound + blocks.back().header.roundCount);
+}
+
+std::size_t HandHistoryReader::findBlock(long long round) const
+{
+    // The first block that ends after the round
+    auto found = std::upper_bound(blocks.begin(), blocks.end(), round, [](long long target, const HistoryBlock &block)
+                                  { return target < static_cast<long long>(block.header.firstRound + block.header.roundCount); });
+    return static_cast<std::size_t>(found - blocks.begin());
+}
+
+HistoryCursor HandHistoryReader::readBlock(std::size_t index, std::vector<uint8_t> &scratch) const
+{
+    const HistoryBlock &block = blocks[index];
+    const uint8_t *stored = data + block.offset;
+    long long firstRound = static_cast<long long>(block.header.firstRound);
+    if (!block.header.isCompressed())
+        return HistoryCursor(stored, stored + block.header.rawSize, firstRound);
+
+    BlockCodec::decompress(stored, block.header.storedSize, scratch, block.header.rawSize);
+    return HistoryCursor(scratch.data(), scratch.data() + scratch.size(), firstRound);
+}
+
+std::vector<HistoryPartition> HandHistoryReader::partition(unsigned int count) const
+{
+    std::vector<HistoryPartition> partitions;
+    if (blocks.empty() || count == 0)
+        return partitions;
+    count = static_cast<unsigned int>(std::min<std::size_t>(count, blocks.size()));
+
+    // Cut wherever the bytes so far pass the next share, blocks hold about the same number of rounds so bytes are a fair measure of work
+    std::size_t total = size - HistoryFileHeader::size;
+    std::size_t bytes = 0;
+    HistoryPartition current;
+    for (std::size_t i = 0; i < blocks.size(); i++)
+    {
+        bytes += HistoryBlockHeader::size + blocks[i].header.storedSize;
+        std::size_t left = blocks.size() - i - 1;
+        std::size_t partitionsLeft = count - partitions.size() - 1;
+        bool pastShare = bytes >= total / count * (partitions.size() + 1);
+        if ((pastShare && partitionsLeft > 0) || left < partitionsLeft || left == 0)
+        {
+            current.endBlock = i + 1;
+            partitions.push_back(current);
+            current.firstBlock = i + 1;
+        }
+    }
+    return partitions;
+}
+
+unsigned int HandHistoryReader::scan(unsigned int threadCount, const std::function<void(unsigned int thread, HistoryCursor &cursor)> &visit) const
+{
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<HistoryPartition> partitions = partition(threadCount);
+
+    std::vector<std::thread> workers;
+    workers.reserve(partitions.size());
+    std::vector<std::exception_ptr> failures(partitions.size());
+    for (unsigned int i = 0; i < partitions.size(); i++)
+    {
+        workers.emplace_back([this, i, &partitions, &failures, &visit]()
+                             {
+            const HistoryPartition &part = partitions[i];
+#ifndef _WIN32
+            // Each thread reads its run front to back, so let the kernel read ahead of it
+            std::size_t first = blocks[part.firstBlock].offset - HistoryBlockHeader::size;
+            std::size_t last = blocks[part.endBlock - 1].offset + blocks[part.endBlock - 1].header.storedSize;
+            std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+            std::size_t start = first / page * page;
+            ::madvise(const_cast<uint8_t *>(data) + start, last - start, MADV_SEQUENTIAL);
+#endif
+            std::vector<uint8_t> scratch;
+            try
+            {
+                for (std::size_t block = part.firstBlock; block < part.endBlock; block++)
+                {
+                    HistoryCursor cursor = readBlock(block, scratch);
+                    visit(i, cursor);
+                }
+            }
+            catch (...)
+            {
+                failures[i] = std::current_exception();
+            } });
+    }
+
+    for (std::thread &worker : workers)
+        worker.join();
+    for (const std::exception_ptr &failure : failures)
+        if (failure)
+            std::rethrow_exception(failure);
+    return static_cast<unsigned int>(partitions.size());
+}
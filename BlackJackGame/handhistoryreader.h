@@ -0,0 +1,356 @@
+#ifndef HANDHISTORYREADER_H
+#define HANDHISTORYREADER_H
+
+#include "card.h"
+#include "handhistory.h"
+#include "playerStatus.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+using PlayerStatus::PLAYERSTATUS;
+
+/**
+ * @brief The HistoryCursor class steps through the records of one block of a hand history. The fields of each record are read in place from the block,
+ * cards are left as the bytes they were written as, and the lists in DEAL, SETTLE and SEATS records are read into vectors the cursor reuses,
+ * so walking a block never allocates once the cursor has warmed up. Each getter is only meaningful for the records the RECORD enum lists it in
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/7/2025
+ */
+class HistoryCursor
+{
+public:
+    /**
+     * @brief HistoryCursor Constructor for a cursor before the first record of a block
+     * @param begin The first byte of the block's records
+     * @param end The end of the block's records
+     * @param firstRound The number of rounds settled before the block
+     */
+    HistoryCursor(const uint8_t *begin, const uint8_t *end, long long firstRound);
+
+    /**
+     * @brief next Moves to the next record. Throws std::runtime_error if the record is corrupt
+     * @return False once every record has been read
+     */
+    bool next();
+
+    /**
+     * @brief getRecord Gets the kind of the current record
+     */
+    RECORD getRecord() const { return record; }
+
+    /**
+     * @brief getRound Gets the round the current record is part of, counted from the start of the history
+     */
+    long long getRound() const { return round; }
+
+    /**
+     * @brief getSeed Gets the seed of a SHOE record
+     */
+    uint64_t getSeed() const { return seed; }
+
+    /**
+     * @brief getIndex Gets the seat of a BET record, or the hand of a HIT, DOUBLE, STAND, SPLIT or SURRENDER record
+     */
+    int getIndex() const { return index; }
+
+    /**
+     * @brief getAmount Gets the bet of a BET record
+     */
+    int getAmount() const { return amount; }
+
+    /**
+     * @brief getCardCount Gets the number of cards in a HIT, DOUBLE, SPLIT, DEAL or DEALER record
+     */
+    int getCardCount() const { return cardCount; }
+
+    /**
+     * @brief getCard Gets a card of the current record. A DEAL has each seat's two cards in seat order, then the dealer's hole card and up card
+     * @param i The index of the card, less than getCardCount
+     */
+    Card getCard(int i) const { return Card::fromCode(cards[i]); }
+
+    /**
+     * @brief getCardCodes Gets the cards of the current record as the codes in the block, without decoding them
+     */
+    const uint8_t *getCardCodes() const { return cards; }
+
+    /**
+     * @brief getSeats Gets the seats dealt in a DEAL record, in the order their cards are
+     */
+    const std::vector<int> &getSeats() const { return seats; }
+
+    /**
+     * @brief getStatuses Gets how each hand ended in a SETTLE record, in play order
+     */
+    const std::vector<PLAYERSTATUS> &getStatuses() const { return statuses; }
+
+    /**
+     * @brief getBets Gets each hand's final bet in a SETTLE record, in play order
+     */
+    const std::vector<int> &getBets() const { return bets; }
+
+    /**
+     * @brief getMoney Gets each seat's money after a SEATS or SETTLE record, the changes in SETTLE records already added up
+     */
+    const std::vector<long long> &getMoney() const { return money; }
+
+private:
+    /**
+     * @brief in The next byte to read
+     */
+    const uint8_t *in;
+
+    /**
+     * @brief end The end of the block's records
+     */
+    const uint8_t *end;
+
+    /**
+     * @brief record The kind of the current record
+     */
+    RECORD record = RECORD::SHOE;
+
+    /**
+     * @brief round The round of the current record
+     */
+    long long round;
+
+    /**
+     * @brief settled True if the last record ended a round, so the next one starts another
+     */
+    bool settled = false;
+
+    /**
+     * @brief seed The seed of a SHOE record
+     */
+    uint64_t seed = 0;
+
+    /**
+     * @brief index The seat or hand of the record
+     */
+    int index = 0;
+
+    /**
+     * @brief amount The bet of a BET record
+     */
+    int amount = 0;
+
+    /**
+     * @brief cards The card codes of the record, in the block
+     */
+    const uint8_t *cards = nullptr;
+
+    /**
+     * @brief cardCount The number of cards of the record
+     */
+    int cardCount = 0;
+
+    /**
+     * @brief seats The seats dealt in a DEAL record
+     */
+    std::vector<int> seats;
+
+    /**
+     * @brief statuses How each hand ended in a SETTLE record
+     */
+    std::vector<PLAYERSTATUS> statuses;
+
+    /**
+     * @brief bets Each hand's final bet in a SETTLE record
+     */
+    std::vector<int> bets;
+
+    /**
+     * @brief money Each seat's money, kept from record to record so the changes in SETTLE records can be added up
+     */
+    std::vector<long long> money;
+
+    /**
+     * @brief readCount Reads a varint that counts something, checked against the bytes left so a corrupt count can't run away
+     * @param bytesEach The fewest bytes each counted item takes
+     * @return The count
+     */
+    int readCount(std::size_t bytesEach);
+
+    /**
+     * @brief readInt Reads a varint that fits in an int
+     */
+    int readInt();
+
+    /**
+     * @brief readCards Takes a number of card codes from the block, checking each is a card
+     * @param count The number of cards
+     */
+    void readCards(int count);
+};
+
+/**
+ * @brief The HistoryBlock struct is one entry of a reader's block index: where a block's records are and its header
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/7/2025
+ */
+struct HistoryBlock
+{
+    /**
+     * @brief offset The offset in the file of the block's records, just past its header
+     */
+    std::size_t offset = 0;
+
+    /**
+     * @brief header The block's header
+     */
+    HistoryBlockHeader header;
+};
+
+/**
+ * @brief The HistoryPartition struct is a run of whole blocks for one thread to read
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/7/2025
+ */
+struct HistoryPartition
+{
+    /**
+     * @brief firstBlock The first block of the partition
+     */
+    std::size_t firstBlock = 0;
+
+    /**
+     * @brief endBlock One past the last block of the partition
+     */
+    std::size_t endBlock = 0;
+};
+
+/**
+ * @brief The HandHistoryReader class maps a hand history file written by HandHistoryWriter into memory and reads it in place.
+ * Opening it hops from block header to block header to build a sparse index of one entry per block, without decompressing anything,
+ * so any round can be found with a binary search and read by decompressing a single block. Blocks stored uncompressed are read straight from the mapping.
+ * Reading is const and keeps no state, so one reader can be shared by any number of threads, each reading its own partition of the blocks.
+ * A file cut short, by a crash or while it is still being written, is read up to its last whole block
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/7/2025
+ */
+class HandHistoryReader
+{
+public:
+    /**
+     * @brief HandHistoryReader Constructor that maps the file and indexes its blocks. Throws std::runtime_error if it can't be read or isn't a hand history
+     * @param path The file to read
+     */
+    explicit HandHistoryReader(const std::string &path);
+
+    /**
+     * @brief ~HandHistoryReader Destructor that unmaps the file
+     */
+    ~HandHistoryReader();
+
+    HandHistoryReader(const HandHistoryReader &) = delete;
+    HandHistoryReader &operator=(const HandHistoryReader &) = delete;
+
+    /**
+     * @brief getHeader Gets the header of the file
+     */
+    const HistoryFileHeader &getHeader() const { return header; }
+
+    /**
+     * @brief getBlockCount Gets the number of whole blocks in the file
+     */
+    std::size_t getBlockCount() const { return blocks.size(); }
+
+    /**
+     * @brief getBlock Gets a block's index entry
+     * @param index The index of the block
+     */
+    const HistoryBlock &getBlock(std::size_t index) const { return blocks[index]; }
+
+    /**
+     * @brief getRoundCount Gets the number of rounds settled in the file
+     */
+    long long getRoundCount() const;
+
+    /**
+     * @brief getFileBytes Gets the size of the file
+     */
+    std::size_t getFileBytes() const { return size; }
+
+    /**
+     * @brief findBlock Finds the block a round is in
+     * @param round The round, counted from the start of the history
+     * @return The index of the block, getBlockCount if the round is past the last one settled
+     */
+    std::size_t findBlock(long long round) const;
+
+    /**
+     * @brief readBlock Gets a cursor over a block's records. Throws std::runtime_error if the block is corrupt
+     * @param index The index of the block
+     * @param scratch Where a compressed block is decompressed to, reused from block to block by the caller. Untouched for blocks stored as they are
+     * @return A cursor before the block's first record, valid as long as the reader and the scratch
+     */
+    HistoryCursor readBlock(std::size_t index, std::vector<uint8_t> &scratch) const;
+
+    /**
+     * @brief partition Splits the blocks into runs of about the same number of bytes
+     * @param count The number of partitions, fewer are returned if there are fewer blocks
+     * @return The partitions in file order
+     */
+    std::vector<HistoryPartition> partition(unsigned int count) const;
+
+    /**
+     * @brief scan Reads every block across several threads, each with its own partition, and waits for them. Throws again whatever a thread threw
+     * @param threadCount The number of threads, 0 uses every hardware thread
+     * @param visit Called with the thread's index and a cursor for each block, in file order within a partition. Calls from different threads overlap,
+     * so anything shared has to be kept per thread index
+     * @return The number of threads used
+     */
+    unsigned int scan(unsigned int threadCount, const std::function<void(unsigned int thread, HistoryCursor &cursor)> &visit) const;
+
+private:
+    /**
+     * @brief data The mapped file
+     */
+    const uint8_t *data = nullptr;
+
+    /**
+     * @brief size The number of bytes mapped
+     */
+    std::size_t size = 0;
+
+    /**
+     * @brief mapping The handle of the mapping on Windows, unused elsewhere
+     */
+    void *mapping = nullptr;
+
+    /**
+     * @brief header The header of the file
+     */
+    HistoryFileHeader header;
+
+    /**
+     * @brief blocks The index of every whole block
+     */
+    std::vector<HistoryBlock> blocks;
+
+    /**
+     * @brief map Maps the file into memory
+     * @param path The file
+     */
+    void map(const std::string &path);
+
+    /**
+     * @brief unmap Unmaps the file
+     */
+    void unmap();
+
+    /**
+     * @brief buildIndex Reads the file header and every block header
+     */
+    void buildIndex();
+};
+
+#endif // HANDHISTORYREADER_H
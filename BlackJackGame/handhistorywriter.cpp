@@ -0,0 +1,317 @@
+/**
+ * @brief Implementation of The HandHistoryWriter class. It streams every round played at a table to a compact binary file in compressed blocks
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/6/2025
+ */
+
+#include "handhistorywriter.h"
+#include "playerStatus.h"
+#include <stdexcept>
+#include <utility>
+
+HandHistoryWriter::HandHistoryWriter(const std::string &path, int seatCount, int deckCount, std::size_t blockSize, bool background)
+    : file(std::fopen(path.c_str(), "wb")), blockSize(blockSize), buffer(blockSize + blockSize / 4), used(0), seatsBytes(0), rounds(0), blockFirstRound(0), rawBytes(0), fileBytes(0), stopping(false)
+{
+    if (file == nullptr)
+        throw std::runtime_error("HandHistoryWriter: can't create " + path);
+
+    HistoryFileHeader header;
+    header.deckCount = static_cast<uint8_t>(deckCount);
+    header.seatCount = static_cast<uint16_t>(seatCount);
+    uint8_t bytes[HistoryFileHeader::size];
+    header.write(bytes);
+    writeBytes(bytes, sizeof(bytes));
+
+    if (background)
+        worker = std::thread(&HandHistoryWriter::run, this);
+}
+
+HandHistoryWriter::~HandHistoryWriter()
+{
+    // A destructor can't throw, so a failed last write is lost
+    try
+    {
+        close();
+    }
+    catch (const std::runtime_error &)
+    {
+    }
+}
+
+void HandHistoryWriter::seats(const PlayerTable &players)
+{
+    settledMoney.resize(players.getSeatCount());
+    for (int seat = 0; seat < players.getSeatCount(); seat++)
+        settledMoney[seat] = players.money(seat);
+    seatsRecord();
+}
+
+void HandHistoryWriter::shoe(uint64_t seed)
+{
+    uint8_t *out = reserve(1 + 8);
+    *out++ = static_cast<uint8_t>(RECORD::SHOE);
+    for (int i = 0; i < 8; i++)
+        *out++ = static_cast<uint8_t>(seed >> (8 * i));
+    commit(out);
+}
+
+void HandHistoryWriter::bet(int seat, int amount)
+{
+    uint8_t *out = reserve(1 + 2 * Varint::maxBytes);
+    *out++ = static_cast<uint8_t>(RECORD::BET);
+    out = Varint::write(out, static_cast<uint64_t>(seat));
+    out = Varint::write(out, static_cast<uint64_t>(amount));
+    commit(out);
+}
+
+void HandHistoryWriter::deal(const PlayerTable &players, const Hand &dealerHand)
+{
+    int dealt = 0;
+    for (int position = 0; position < players.size(); position++)
+        if (players.hand(position).getCards().size() == 2)
+            dealt++;
+
+    uint8_t *out = reserve(1 + Varint::maxBytes + dealt * (Varint::maxBytes + 2) + 2);
+    *out++ = static_cast<uint8_t>(RECORD::DEAL);
+    out = Varint::write(out, static_cast<uint64_t>(dealt));
+
+    // Bankrupt seats are skipped by the deal, so they have no cards. The cards follow the seats so a reader can take them all at once
+    for (int position = 0; position < players.size(); position++)
+        if (players.hand(position).getCards().size() == 2)
+            out = Varint::write(out, static_cast<uint64_t>(players.seat(position)));
+    for (int position = 0; position < players.size(); position++)
+    {
+        CardView cards = players.hand(position).getCards();
+        if (cards.size() != 2)
+            continue;
+        *out++ = cards[0].getCode();
+        *out++ = cards[1].getCode();
+    }
+
+    *out++ = dealerHand.getCards()[0].getCode();
+    *out++ = dealerHand.getCards()[1].getCode();
+    commit(out);
+}
+
+void HandHistoryWriter::hit(int hand, Card card)
+{
+    handRecord(RECORD::HIT, hand, 1, card);
+}
+
+void HandHistoryWriter::doubleDown(int hand, Card card)
+{
+    handRecord(RECORD::DOUBLE, hand, 1, card);
+}
+
+void HandHistoryWriter::stand(int hand)
+{
+    handRecord(RECORD::STAND, hand, 0, Card());
+}
+
+void HandHistoryWriter::split(int hand, Card first, Card second)
+{
+    uint8_t *out = reserve(1 + Varint::maxBytes + 2);
+    *out++ = static_cast<uint8_t>(RECORD::SPLIT);
+    out = Varint::write(out, static_cast<uint64_t>(hand));
+    *out++ = first.getCode();
+    *out++ = second.getCode();
+    commit(out);
+}
+
+void HandHistoryWriter::surrender(int hand)
+{
+    handRecord(RECORD::SURRENDER, hand, 0, Card());
+}
+
+void HandHistoryWriter::dealerDraws(const Hand &dealerHand)
+{
+    // The first two cards were recorded with the deal
+    CardView cards = dealerHand.getCards();
+    std::size_t drawn = cards.size() - 2;
+
+    uint8_t *out = reserve(1 + Varint::maxBytes + drawn);
+    *out++ = static_cast<uint8_t>(RECORD::DEALER);
+    out = Varint::write(out, drawn);
+    for (std::size_t i = 2; i < cards.size(); i++)
+        *out++ = cards[i].getCode();
+    commit(out);
+}
+
+void HandHistoryWriter::settle(const PlayerTable &players)
+{
+    int hands = players.size();
+    int seats = players.getSeatCount();
+
+    uint8_t *out = reserve(1 + Varint::maxBytes * (2 + hands * 2 + seats));
+    *out++ = static_cast<uint8_t>(RECORD::SETTLE);
+    out = Varint::write(out, static_cast<uint64_t>(hands));
+    for (int position = 0; position < hands; position++)
+    {
+        *out++ = static_cast<uint8_t>(players.status(position));
+        out = Varint::write(out, static_cast<uint64_t>(players.hand(position).getBet()));
+    }
+    // Each seat's money is only written in full by SEATS, then as the change over each round, which is usually a byte
+    out = Varint::write(out, static_cast<uint64_t>(seats));
+    settledMoney.resize(seats);
+    for (int seat = 0; seat < seats; seat++)
+    {
+        int64_t change = static_cast<int64_t>(players.money(seat)) - settledMoney[seat];
+        out = Varint::write(out, Varint::zigzag(change));
+        settledMoney[seat] = players.money(seat);
+    }
+    commit(out);
+
+    // Blocks only break between rounds, so a reader can start at any block
+    rounds++;
+    if (used >= blockSize)
+    {
+        endBlock();
+        seatsRecord();
+    }
+}
+
+void HandHistoryWriter::close()
+{
+    if (file == nullptr)
+        return;
+
+    // A block holding only its SEATS record has nothing new to write
+    if (used > seatsBytes)
+        endBlock();
+    if (worker.joinable())
+    {
+        stopping.store(true);
+        notify();
+        worker.join();
+    }
+    std::fclose(file);
+    file = nullptr;
+
+    if (failure)
+        std::rethrow_exception(std::exchange(failure, nullptr));
+}
+
+void HandHistoryWriter::handRecord(RECORD record, int hand, int cards, Card card)
+{
+    uint8_t *out = reserve(1 + Varint::maxBytes + 1);
+    *out++ = static_cast<uint8_t>(record);
+    out = Varint::write(out, static_cast<uint64_t>(hand));
+    if (cards > 0)
+        *out++ = card.getCode();
+    commit(out);
+}
+
+void HandHistoryWriter::seatsRecord()
+{
+    bool startsBlock = used == 0;
+    uint8_t *out = reserve(1 + Varint::maxBytes * (1 + settledMoney.size()));
+    *out++ = static_cast<uint8_t>(RECORD::SEATS);
+    out = Varint::write(out, settledMoney.size());
+    for (int money : settledMoney)
+        out = Varint::write(out, Varint::zigzag(money));
+    commit(out);
+    if (startsBlock)
+        seatsBytes = used;
+}
+
+void HandHistoryWriter::endBlock()
+{
+    PendingBlock block;
+    block.used = used;
+    block.header.rawSize = static_cast<uint32_t>(used);
+    block.header.roundCount = static_cast<uint32_t>(rounds - blockFirstRound);
+    block.header.firstRound = static_cast<uint64_t>(blockFirstRound);
+    rawBytes += static_cast<long long>(used);
+    blockFirstRound = rounds;
+    used = 0;
+    seatsBytes = 0;
+
+    if (!worker.joinable())
+    {
+        block.records.swap(buffer);
+        writeBlock(block);
+        buffer.swap(block.records);
+        return;
+    }
+
+    // Carry on in a written block's memory, or new memory if none has come back yet
+    std::vector<uint8_t> next;
+    if (!empty.tryPop(next))
+        next.resize(blockSize + blockSize / 4);
+    block.records.swap(buffer);
+    buffer.swap(next);
+
+    // Only waits if the disk has fallen a whole ring of blocks behind
+    if (!full.tryPush(block))
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        wake.wait(guard, [this, &block]()
+                  { return full.tryPush(block); });
+    }
+    notify();
+}
+
+void HandHistoryWriter::writeBlock(PendingBlock &block)
+{
+    codec.compress(block.records.data(), block.used, compressed);
+
+    // Records that didn't shrink are stored as they are
+    bool stored = compressed.size() >= block.used;
+    block.header.storedSize = static_cast<uint32_t>(stored ? block.used : compressed.size());
+
+    uint8_t bytes[HistoryBlockHeader::size];
+    block.header.write(bytes);
+    writeBytes(bytes, sizeof(bytes));
+    writeBytes(stored ? block.records.data() : compressed.data(), block.header.storedSize);
+}
+
+void HandHistoryWriter::run()
+{
+    PendingBlock block;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            wake.wait(guard, [this]()
+                      { return stopping.load() || !full.empty(); });
+        }
+
+        // Blocks still queued when closing are written before stopping
+        bool last = stopping.load();
+        while (full.tryPop(block))
+        {
+            // After a failed write the file is broken, so the rest are dropped and close reports the first error
+            if (!failure)
+            {
+                try
+                {
+                    writeBlock(block);
+                }
+                catch (const std::runtime_error &)
+                {
+                    failure = std::current_exception();
+                }
+            }
+            empty.tryPush(block.records);
+            notify();
+        }
+        if (last)
+            return;
+    }
+}
+
+void HandHistoryWriter::notify()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+    }
+    wake.notify_all();
+}
+
+void HandHistoryWriter::writeBytes(const uint8_t *bytes, std::size_t count)
+{
+    if (std::fwrite(bytes, 1, count, file) != count)
+        throw std::runtime_error("HandHistoryWriter: write failed");
+    fileBytes += static_cast<long long>(count);
+}
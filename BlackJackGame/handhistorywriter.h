@@ -0,0 +1,336 @@
+#ifndef HANDHISTORYWRITER_H
+#define HANDHISTORYWRITER_H
+
+#include "blockcodec.h"
+#include "card.h"
+#include "hand.h"
+#include "handhistory.h"
+#include "playertable.h"
+#include "spscring.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief The PendingBlock struct is a block of records on its way from the table to the thread that compresses and writes it
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/6/2025
+ */
+struct PendingBlock
+{
+    /**
+     * @brief records The records, only the first used bytes are part of the block
+     */
+    std::vector<uint8_t> records;
+
+    /**
+     * @brief used The number of bytes of records
+     */
+    std::size_t used = 0;
+
+    /**
+     * @brief header The block's header, without its sizes until it is compressed
+     */
+    HistoryBlockHeader header;
+};
+
+/**
+ * @brief The HandHistoryWriter class streams every round played at a table to a compact binary file. GameState calls it from each action,
+ * and each call appends one record of varints and card bytes to an in memory block. Once a round settles with the block past its size,
+ * the block is compressed with BlockCodec and written in one go. By default a background thread does the compressing and writing,
+ * with full blocks handed over through one SpscRing and their memory handed back through another the same way ShoePool hands over shoes,
+ * so the table only pays for encoding its records.
+ * The records are listed with the RECORD enum, and the file layout with HistoryFileHeader and HistoryBlockHeader
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/6/2025
+ */
+class HandHistoryWriter
+{
+public:
+    /**
+     * @brief HandHistoryWriter Constructor that creates the file and writes its header. Throws std::runtime_error if the file can't be created
+     * @param path The file to write, replaced if it exists
+     * @param seatCount The number of seats at the table
+     * @param deckCount The number of decks in the shoe
+     * @param blockSize The number of bytes of records gathered before a block is compressed and written
+     * @param background True to compress and write blocks on a background thread, false to do it on the table's thread
+     */
+    HandHistoryWriter(const std::string &path, int seatCount, int deckCount, std::size_t blockSize = defaultBlockSize, bool background = true);
+
+    /**
+     * @brief ~HandHistoryWriter Destructor that writes what is left and closes the file
+     */
+    ~HandHistoryWriter();
+
+    HandHistoryWriter(const HandHistoryWriter &) = delete;
+    HandHistoryWriter &operator=(const HandHistoryWriter &) = delete;
+
+    /**
+     * @brief defaultBlockSize Big enough to compress well, small enough to stay in cache
+     */
+    static constexpr std::size_t defaultBlockSize = 1 << 16;
+
+    /**
+     * @brief seats Records each seat's money. Called when recording starts, later blocks start with the money on their own
+     * @param players The seats
+     */
+    void seats(const PlayerTable &players);
+
+    /**
+     * @brief shoe Records that a new shoe is being dealt
+     * @param seed The seed the shoe was shuffled with
+     */
+    void shoe(uint64_t seed);
+
+    /**
+     * @brief bet Records a seat's bet for the round
+     * @param seat The seat
+     * @param amount The bet
+     */
+    void bet(int seat, int amount);
+
+    /**
+     * @brief deal Records the first two cards of every hand dealt and the dealer
+     * @param players The hands just dealt
+     * @param dealerHand The dealer's hand, hole card first
+     */
+    void deal(const PlayerTable &players, const Hand &dealerHand);
+
+    /**
+     * @brief hit Records a hit
+     * @param hand The index of the hand
+     * @param card The card drawn
+     */
+    void hit(int hand, Card card);
+
+    /**
+     * @brief doubleDown Records a double down
+     * @param hand The index of the hand
+     * @param card The card drawn
+     */
+    void doubleDown(int hand, Card card);
+
+    /**
+     * @brief stand Records a stand
+     * @param hand The index of the hand
+     */
+    void stand(int hand);
+
+    /**
+     * @brief split Records a split
+     * @param hand The index of the hand split
+     * @param first The card drawn to the split hand
+     * @param second The card drawn to the new hand right after it
+     */
+    void split(int hand, Card first, Card second);
+
+    /**
+     * @brief surrender Records a surrender
+     * @param hand The index of the hand
+     */
+    void surrender(int hand);
+
+    /**
+     * @brief dealerDraws Records the cards the dealer drew after the deal
+     * @param dealerHand The dealer's finished hand
+     */
+    void dealerDraws(const Hand &dealerHand);
+
+    /**
+     * @brief settle Records how every hand ended and the seats' money, which ends the round
+     * @param players The settled hands
+     */
+    void settle(const PlayerTable &players);
+
+    /**
+     * @brief close Writes what is left and closes the file. Rounds that haven't settled are written too and read back as unfinished.
+     * Throws std::runtime_error if a block couldn't be written, including one the background thread wrote earlier
+     */
+    void close();
+
+    /**
+     * @brief getRoundCount Gets the number of rounds settled
+     */
+    long long getRoundCount() const { return rounds; }
+
+    /**
+     * @brief getRawBytes Gets the number of bytes of records so far, before compression
+     */
+    long long getRawBytes() const { return rawBytes + static_cast<long long>(used); }
+
+    /**
+     * @brief getFileBytes Gets the number of bytes written to the file so far
+     */
+    long long getFileBytes() const { return fileBytes.load(); }
+
+private:
+    /**
+     * @brief file The file written, null once closed
+     */
+    std::FILE *file;
+
+    /**
+     * @brief blockSize The number of bytes of records gathered before a block is written
+     */
+    std::size_t blockSize;
+
+    /**
+     * @brief buffer The records of the current block, sized ahead so appending never reallocates within a round
+     */
+    std::vector<uint8_t> buffer;
+
+    /**
+     * @brief depth The number of blocks that can wait for the background thread
+     */
+    static constexpr std::size_t depth = 4;
+
+    /**
+     * @brief full Blocks waiting to be compressed and written, from the table to the background thread
+     */
+    SpscRing<PendingBlock, depth> full;
+
+    /**
+     * @brief empty Written blocks' memory to reuse, from the background thread to the table
+     */
+    SpscRing<std::vector<uint8_t>, depth> empty;
+
+    /**
+     * @brief used The number of bytes of the buffer holding records
+     */
+    std::size_t used;
+
+    /**
+     * @brief compressed The compressed block, kept to reuse its memory. Only touched by the thread writing blocks
+     */
+    std::vector<uint8_t> compressed;
+
+    /**
+     * @brief codec The block compressor. Only touched by the thread writing blocks
+     */
+    BlockCodec codec;
+
+    /**
+     * @brief settledMoney Each seat's money at the last SEATS or SETTLE record, which the next SETTLE records the change from
+     */
+    std::vector<int> settledMoney;
+
+    /**
+     * @brief seatsBytes The number of bytes of the SEATS record that starts the current block
+     */
+    std::size_t seatsBytes;
+
+    /**
+     * @brief rounds The number of rounds settled
+     */
+    long long rounds;
+
+    /**
+     * @brief blockFirstRound The number of rounds settled before the current block
+     */
+    long long blockFirstRound;
+
+    /**
+     * @brief rawBytes The number of bytes of records in the blocks already written
+     */
+    long long rawBytes;
+
+    /**
+     * @brief fileBytes The number of bytes written to the file
+     */
+    std::atomic<long long> fileBytes;
+
+    /**
+     * @brief stopping Set to tell the background thread to finish the blocks it has and stop
+     */
+    std::atomic<bool> stopping;
+
+    /**
+     * @brief failure The error the background thread hit writing a block, thrown again by close
+     */
+    std::exception_ptr failure;
+
+    /**
+     * @brief lock Only held to sleep and wake, never while encoding or compressing
+     */
+    std::mutex lock;
+
+    /**
+     * @brief wake Signalled when a block is full, when one has been written, or when the writer is closing
+     */
+    std::condition_variable wake;
+
+    /**
+     * @brief worker The background thread, not started when blocks are written on the table's thread
+     */
+    std::thread worker;
+
+    /**
+     * @brief reserve Makes room for more bytes of records
+     * @param bytes The most bytes about to be appended
+     * @return Where to write them
+     */
+    uint8_t *reserve(std::size_t bytes)
+    {
+        if (used + bytes > buffer.size())
+            buffer.resize(std::max(buffer.size() * 2, used + bytes));
+        return buffer.data() + used;
+    }
+
+    /**
+     * @brief commit Marks the bytes up to a point as written
+     * @param end The byte after the last one written
+     */
+    void commit(uint8_t *end) { used = static_cast<std::size_t>(end - buffer.data()); }
+
+    /**
+     * @brief handRecord Appends a record of a hand index and an optional card
+     * @param record The kind of record
+     * @param hand The index of the hand
+     * @param cards The number of cards, 0 or 1
+     * @param card The card
+     */
+    void handRecord(RECORD record, int hand, int cards, Card card);
+
+    /**
+     * @brief seatsRecord Appends a SEATS record of the settled money
+     */
+    void seatsRecord();
+
+    /**
+     * @brief endBlock Hands the current block to the background thread, or writes it straight away without one
+     */
+    void endBlock();
+
+    /**
+     * @brief writeBlock Compresses and writes a block
+     * @param block The block
+     */
+    void writeBlock(PendingBlock &block);
+
+    /**
+     * @brief run The background thread's loop, writes full blocks until the writer closes
+     */
+    void run();
+
+    /**
+     * @brief notify Wakes the other thread. The lock is taken first so a thread that just found a ring full or empty can't miss the wake up
+     */
+    void notify();
+
+    /**
+     * @brief writeBytes Writes bytes to the file. Throws std::runtime_error if the write fails
+     * @param bytes The first byte
+     * @param count The number of bytes
+     */
+    void writeBytes(const uint8_t *bytes, std::size_t count);
+};
+
+#endif // HANDHISTORYWRITER_H
@@ -0,0 +1,217 @@
+/**
+ * @brief Implementation of The HistoryReplayer class. It reads a hand history round by round and plays the rounds back through a GameState
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/7/2025
+ */
+
+#include "historyreplayer.h"
+#include <stdexcept>
+#include <string>
+
+HistoryReplayer::HistoryReplayer(const HandHistoryReader &reader) : reader(reader), block(0), cursor(nullptr, nullptr, 0)
+{
+    openBlock(0);
+}
+
+void HistoryReplayer::openBlock(std::size_t index)
+{
+    block = index;
+    money.clear();
+    if (block < reader.getBlockCount())
+        cursor = reader.readBlock(block, scratch);
+    else
+        cursor = HistoryCursor(nullptr, nullptr, reader.getRoundCount());
+}
+
+void HistoryReplayer::seek(long long round)
+{
+    openBlock(reader.findBlock(round));
+
+    // Blocks start on a round, so only the rounds before it in its own block are read through
+    HistoryRound skipped;
+    long long first = block < reader.getBlockCount() ? static_cast<long long>(reader.getBlock(block).header.firstRound) : round;
+    for (long long i = first; i < round; i++)
+        nextRound(skipped);
+}
+
+bool HistoryReplayer::nextRound(HistoryRound &round)
+{
+    int seatCount = reader.getHeader().seatCount;
+    auto startRound = [this, &round, seatCount]()
+    {
+        round.startMoney = money;
+        round.bets.clear();
+        round.dealt.assign(seatCount, false);
+        round.cards.clear();
+        round.actions.clear();
+        round.dealerPlayed = false;
+    };
+    startRound();
+
+    while (true)
+    {
+        if (!cursor.next())
+        {
+            // A round never spans blocks, so anything read of one at the end of the history is unfinished
+            if (block + 1 >= reader.getBlockCount())
+            {
+                openBlock(reader.getBlockCount());
+                return false;
+            }
+            openBlock(block + 1);
+            startRound();
+            continue;
+        }
+
+        switch (cursor.getRecord())
+        {
+        case RECORD::SHOE:
+            break;
+        case RECORD::SEATS:
+            money = cursor.getMoney();
+            round.startMoney = money;
+            break;
+        case RECORD::BET:
+            if (cursor.getIndex() >= seatCount)
+                throw std::runtime_error("HistoryReplayer: bet from a seat the history doesn't have");
+            round.bets.push_back(HistoryBet{cursor.getIndex(), cursor.getAmount()});
+            break;
+        case RECORD::DEAL:
+        {
+            // Recorded seat by seat, drawn a card to each seat then the dealer, twice over
+            const std::vector<int> &seats = cursor.getSeats();
+            int dealtCount = static_cast<int>(seats.size());
+            for (int seat : seats)
+            {
+                if (seat >= seatCount)
+                    throw std::runtime_error("HistoryReplayer: deal to a seat the history doesn't have");
+                round.dealt[seat] = true;
+            }
+            for (int i = 0; i < 2; i++)
+            {
+                for (int seat = 0; seat < dealtCount; seat++)
+                    round.cards.push_back(cursor.getCard(2 * seat + i));
+                round.cards.push_back(cursor.getCard(2 * dealtCount + i));
+            }
+            break;
+        }
+        case RECORD::HIT:
+            round.actions.push_back(HistoryAction{cursor.getIndex(), MOVE::HIT});
+            round.cards.push_back(cursor.getCard(0));
+            break;
+        case RECORD::DOUBLE:
+            round.actions.push_back(HistoryAction{cursor.getIndex(), MOVE::DOUBLE});
+            round.cards.push_back(cursor.getCard(0));
+            break;
+        case RECORD::STAND:
+            round.actions.push_back(HistoryAction{cursor.getIndex(), MOVE::STAND});
+            break;
+        case RECORD::SPLIT:
+            round.actions.push_back(HistoryAction{cursor.getIndex(), MOVE::SPLIT});
+            round.cards.push_back(cursor.getCard(0));
+            round.cards.push_back(cursor.getCard(1));
+            break;
+        case RECORD::SURRENDER:
+            round.actions.push_back(HistoryAction{cursor.getIndex(), MOVE::SURRENDER});
+            break;
+        case RECORD::DEALER:
+            round.dealerPlayed = true;
+            for (int i = 0; i < cursor.getCardCount(); i++)
+                round.cards.push_back(cursor.getCard(i));
+            break;
+        case RECORD::SETTLE:
+            money = cursor.getMoney();
+            round.money = money;
+            round.number = cursor.getRound();
+            return true;
+        }
+    }
+}
+
+std::vector<Player> HistoryReplayer::getPlayers(const HistoryRound &round)
+{
+    std::vector<Player> players;
+    int seatCount = static_cast<int>(round.dealt.size());
+    players.reserve(seatCount);
+    for (int seat = 0; seat < seatCount; seat++)
+    {
+        int seatMoney = seat < static_cast<int>(round.startMoney.size()) ? static_cast<int>(round.startMoney[seat]) : 0;
+        players.emplace_back(seatMoney, 0, false, 1, 0);
+        if (!round.dealt[seat])
+            players.back().status = PLAYERSTATUS::BANKRUPT;
+    }
+    return players;
+}
+
+TableRules HistoryReplayer::getRules(const TableRules &rules) const
+{
+    TableRules replayRules = rules;
+    replayRules.deckCount = reader.getHeader().deckCount;
+    replayRules.continuousShuffle = false;
+    return replayRules;
+}
+
+void HistoryReplayer::play(GameState &game, const HistoryRound &round)
+{
+    game.clearHands();
+    for (const HistoryBet &bet : round.bets)
+        game.setPlayerBet(bet.seat, bet.amount);
+
+    game.stackCards(round.cards);
+    game.dealInitialCards();
+
+    for (const HistoryAction &action : round.actions)
+    {
+        // Splits add hands as the round goes, so a move can only be checked against the hands there are when it is made
+        if (action.hand >= game.getPlayerCount())
+            throw std::runtime_error("HistoryReplayer: round " + std::to_string(round.number) + " moves a hand that isn't in play");
+        switch (action.move)
+        {
+        case MOVE::HIT:
+            game.hit(action.hand);
+            break;
+        case MOVE::DOUBLE:
+            game.doubleDown(action.hand);
+            break;
+        case MOVE::SPLIT:
+            game.split(action.hand);
+            break;
+        case MOVE::STAND:
+            game.stand(action.hand);
+            break;
+        case MOVE::SURRENDER:
+            game.surrender(action.hand);
+            break;
+        }
+    }
+
+    if (round.dealerPlayed)
+        game.dealerPlay();
+    game.endRound();
+
+    const PlayerTable &table = game.getPlayerTable();
+    for (int seat = 0; seat < table.getSeatCount() && seat < static_cast<int>(round.money.size()); seat++)
+        if (table.money(seat) != round.money[seat])
+            throw std::runtime_error("HistoryReplayer: round " + std::to_string(round.number) + " doesn't replay to its recorded money, check the rules match");
+}
+
+long long HistoryReplayer::replay(long long firstRound, long long count, const TableRules &rules, const std::function<void(const GameState &game, const HistoryRound &round)> &afterRound)
+{
+    seek(firstRound);
+    HistoryRound round;
+    if (count <= 0 || !nextRound(round))
+        return 0;
+
+    // The shoe is never dealt from, so the seed doesn't matter
+    GameState game(getPlayers(round), getRules(rules), SHOEORDER::RANDOM, Rng(0));
+    long long played = 0;
+    do
+    {
+        play(game, round);
+        played++;
+        if (afterRound)
+            afterRound(game, round);
+    } while (played < count && nextRound(round));
+    return played;
+}
@@ -0,0 +1,196 @@
+#ifndef HISTORYREPLAYER_H
+#define HISTORYREPLAYER_H
+
+#include "card.h"
+#include "gamestate.h"
+#include "handhistoryreader.h"
+#include "player.h"
+#include "statistics.h"
+#include "tablerules.h"
+#include <functional>
+#include <vector>
+
+/**
+ * @brief The HistoryBet struct is one seat's bet in a recorded round
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/7/2025
+ */
+struct HistoryBet
+{
+    /**
+     * @brief seat The seat that bet
+     */
+    int seat = 0;
+
+    /**
+     * @brief amount The bet
+     */
+    int amount = 0;
+};
+
+/**
+ * @brief The HistoryAction struct is one move made on a hand in a recorded round
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/7/2025
+ */
+struct HistoryAction
+{
+    /**
+     * @brief hand The index of the hand in play order
+     */
+    int hand = 0;
+
+    /**
+     * @brief move The move
+     */
+    MOVE move = MOVE::STAND;
+};
+
+/**
+ * @brief The HistoryRound struct is a whole recorded round, laid out the way GameState plays it: the bets, every card in the order it is drawn,
+ * the moves in the order they were made, and each seat's money before and after
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/7/2025
+ */
+struct HistoryRound
+{
+    /**
+     * @brief number The round, counted from the start of the history
+     */
+    long long number = 0;
+
+    /**
+     * @brief startMoney Each seat's money before betting
+     */
+    std::vector<long long> startMoney;
+
+    /**
+     * @brief bets The bets in the order they were placed
+     */
+    std::vector<HistoryBet> bets;
+
+    /**
+     * @brief dealt True for each seat dealt in, bankrupt seats are skipped
+     */
+    std::vector<bool> dealt;
+
+    /**
+     * @brief cards Every card of the round in the order it is drawn
+     */
+    std::vector<Card> cards;
+
+    /**
+     * @brief actions The moves in the order they were made
+     */
+    std::vector<HistoryAction> actions;
+
+    /**
+     * @brief dealerPlayed True if the dealer played out their hand, false if no hand was left standing
+     */
+    bool dealerPlayed = false;
+
+    /**
+     * @brief money Each seat's money after settling
+     */
+    std::vector<long long> money;
+};
+
+/**
+ * @brief The HistoryReplayer class reads a hand history round by round from any round on, and plays the rounds back through a GameState.
+ * The recorded cards are stacked on the deck and the recorded bets and moves made in order, so the game ends each round the same way it was recorded,
+ * as long as it is played by the same rules. Each replayer reads on its own, so threads replaying partitions of one reader each use their own
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/7/2025
+ */
+class HistoryReplayer
+{
+public:
+    /**
+     * @brief HistoryReplayer Constructor for a replayer at the first round
+     * @param reader The history to read, kept for the life of the replayer
+     */
+    explicit HistoryReplayer(const HandHistoryReader &reader);
+
+    /**
+     * @brief seek Moves to a round, reading only the block it is in. Throws std::runtime_error if the block is corrupt
+     * @param round The round nextRound reads next, counted from the start of the history
+     */
+    void seek(long long round);
+
+    /**
+     * @brief nextRound Reads the next round. Throws std::runtime_error if the history is corrupt
+     * @param round Set to the round
+     * @return False at the end of the history, a round left unfinished there is skipped
+     */
+    bool nextRound(HistoryRound &round);
+
+    /**
+     * @brief getPlayers Gets the seats as they were before a round, to start a GameState from there
+     * @param round The round
+     * @return A player per seat with the seat's money, bankrupt if the seat wasn't dealt in
+     */
+    static std::vector<Player> getPlayers(const HistoryRound &round);
+
+    /**
+     * @brief getRules Gets the rules to replay by, the given ones with the history's decks. Replayed cards are stacked, so never from a continuous shuffler
+     * @param rules The rules the history was recorded by
+     * @return The rules
+     */
+    TableRules getRules(const TableRules &rules) const;
+
+    /**
+     * @brief play Plays a round through a game that is where the round started. Throws std::runtime_error if the seats don't end with the recorded money,
+     * which means the game isn't played by the rules the round was recorded by
+     * @param game The game
+     * @param round The round
+     */
+    static void play(GameState &game, const HistoryRound &round);
+
+    /**
+     * @brief replay Plays a run of rounds through a new game. Throws std::runtime_error the same as play
+     * @param firstRound The first round, counted from the start of the history
+     * @param count The most rounds to play
+     * @param rules The rules the history was recorded by
+     * @param afterRound Called after each round with the game and the round, may be empty
+     * @return The number of rounds played, fewer than count if the history ends
+     */
+    long long replay(long long firstRound, long long count, const TableRules &rules, const std::function<void(const GameState &game, const HistoryRound &round)> &afterRound);
+
+private:
+    /**
+     * @brief reader The history
+     */
+    const HandHistoryReader &reader;
+
+    /**
+     * @brief scratch Where compressed blocks are decompressed to
+     */
+    std::vector<uint8_t> scratch;
+
+    /**
+     * @brief block The index of the block the cursor is in
+     */
+    std::size_t block;
+
+    /**
+     * @brief cursor The next record of the block
+     */
+    HistoryCursor cursor;
+
+    /**
+     * @brief money Each seat's money at the last SEATS or SETTLE record
+     */
+    std::vector<long long> money;
+
+    /**
+     * @brief openBlock Moves the cursor to the start of a block, or to nothing past the last block
+     * @param index The index of the block
+     */
+    void openBlock(std::size_t index);
+};
+
+#endif // HISTORYREPLAYER_H
@@ -0,0 +1,247 @@
+/**
+ * @brief Implementation of The LoadGenerator class. It connects thousands of bot players to a SocketServer and measures how long it takes to answer them
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/12/2025
+ */
+
+#include "loadgenerator.h"
+#include "bettingpolicy.h"
+#include "botstrategy.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+/**
+ * @brief readSize How many bytes are read from a socket at a time
+ */
+static constexpr std::size_t readSize = 4096;
+
+/**
+ * @brief epollBatch The most sockets handled for each epoll_wait
+ */
+static constexpr int epollBatch = 256;
+
+/**
+ * @brief betting How the players bet, a tenth of their money like the game's bots
+ */
+static const BettingPolicy betting = BettingPolicy::proportional(10);
+
+/**
+ * @brief now Gets the steady clock in nanoseconds
+ * @return The time
+ */
+static int64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void LoadResult::merge(const LoadResult &other)
+{
+    connected += other.connected;
+    dropped += other.dropped;
+    actions += other.actions;
+    rounds += other.rounds;
+    rejected += other.rejected;
+    latency.merge(other.latency);
+}
+
+double LoadResult::actionsPerSecond() const
+{
+    return seconds > 0 ? actions / seconds : 0;
+}
+
+LoadGenerator::LoadGenerator(const SocketEndpoint &endpoint, const TableRules &rules, int clientCount, unsigned int threadCount)
+    : endpoint(endpoint), rules(rules), clientCount(clientCount), threadCount(threadCount)
+{
+    if (this->threadCount == 0)
+        this->threadCount = std::max(1u, std::thread::hardware_concurrency());
+}
+
+LoadResult LoadGenerator::run(double seconds)
+{
+    // Every player connects before any plays, so the server's tables are all open while the latency is measured
+    std::vector<std::vector<Client>> shares(threadCount);
+    int dropped = 0;
+    for (int i = 0; i < clientCount; i++)
+    {
+        Client client;
+        client.descriptor = connect();
+        if (client.descriptor < 0)
+            dropped++;
+        else
+            shares[i % threadCount].push_back(std::move(client));
+    }
+
+    std::vector<LoadResult> results(threadCount);
+    std::vector<std::thread> threads;
+    int64_t start = now();
+    int64_t deadline = start + static_cast<int64_t>(seconds * 1e9);
+    for (unsigned int i = 0; i < threadCount; i++)
+        threads.emplace_back([this, &shares, &results, deadline, i]()
+                             { play(shares[i], deadline, results[i]); });
+    for (std::thread &thread : threads)
+        thread.join();
+
+    LoadResult merged;
+    merged.dropped = dropped;
+    for (const LoadResult &result : results)
+        merged.merge(result);
+    merged.seconds = (now() - start) / 1e9;
+
+    for (std::vector<Client> &share : shares)
+        for (Client &client : share)
+            if (client.descriptor >= 0)
+                close(client.descriptor);
+    return merged;
+}
+
+int LoadGenerator::connect() const
+{
+    bool isUnix = !endpoint.unixPath.empty();
+    int descriptor = socket(isUnix ? AF_UNIX : AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (descriptor < 0)
+        return -1;
+
+    int connected;
+    if (isUnix)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, endpoint.unixPath.c_str(), sizeof(address.sun_path) - 1);
+        connected = ::connect(descriptor, reinterpret_cast<sockaddr *>(&address), sizeof(address));
+    }
+    else
+    {
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(endpoint.port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        connected = ::connect(descriptor, reinterpret_cast<sockaddr *>(&address), sizeof(address));
+        int noDelay = 1;
+        setsockopt(descriptor, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    }
+
+    if (connected < 0)
+    {
+        close(descriptor);
+        return -1;
+    }
+    fcntl(descriptor, F_SETFL, fcntl(descriptor, F_GETFL) | O_NONBLOCK);
+    return descriptor;
+}
+
+void LoadGenerator::play(std::vector<Client> &clients, int64_t deadline, LoadResult &result) const
+{
+    int epoll = epoll_create1(EPOLL_CLOEXEC);
+    for (std::size_t i = 0; i < clients.size(); i++)
+    {
+        epoll_event watch{};
+        watch.events = EPOLLIN;
+        watch.data.u64 = i;
+        epoll_ctl(epoll, EPOLL_CTL_ADD, clients[i].descriptor, &watch);
+    }
+    result.connected = static_cast<int>(clients.size());
+
+    epoll_event ready[epollBatch];
+    uint8_t buffer[readSize];
+    while (true)
+    {
+        int64_t left = deadline - now();
+        if (left <= 0)
+            break;
+        int count = epoll_wait(epoll, ready, epollBatch, static_cast<int>(std::min<int64_t>(left / 1000000 + 1, 1000)));
+        int64_t readAt = now();
+
+        for (int i = 0; i < count; i++)
+        {
+            Client &client = clients[ready[i].data.u64];
+            bool open = client.descriptor >= 0;
+            while (open)
+            {
+                ssize_t read = recv(client.descriptor, buffer, sizeof(buffer), 0);
+                if (read < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                    break;
+                if (read <= 0)
+                    open = false;
+                else
+                    client.input.insert(client.input.end(), buffer, buffer + read);
+            }
+            open = open && answer(client, readAt, result);
+
+            // Everything a player has to say to this batch goes out in one write. A player only has one action in flight,
+            // so the socket is only ever full if the server has stopped reading, and then there is nothing else to do but retry
+            int64_t sentAt = now();
+            while (open && !client.output.empty())
+            {
+                ssize_t sent = send(client.descriptor, client.output.data(), client.output.size(), MSG_NOSIGNAL);
+                if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                    continue;
+                if (sent < 0)
+                    open = false;
+                else
+                    client.output.erase(client.output.begin(), client.output.begin() + sent);
+                client.sentAt = sentAt;
+            }
+
+            if (!open && client.descriptor >= 0)
+            {
+                close(client.descriptor);
+                client.descriptor = -1;
+                result.dropped++;
+            }
+        }
+    }
+    close(epoll);
+}
+
+bool LoadGenerator::answer(Client &client, int64_t now, LoadResult &result) const
+{
+    const uint8_t *in = client.input.data();
+    const uint8_t *end = in + client.input.size();
+    try
+    {
+        TableEvent event;
+        while (TableProtocol::readEvent(in, end, event))
+        {
+            if (client.sentAt != 0)
+            {
+                result.latency.add((now - client.sentAt) / 1000);
+                client.sentAt = 0;
+            }
+
+            TableAction action;
+            if (event.type == TABLEEVENT::BET)
+                action = TableAction::placeBet(0, betting.getBet(event.money));
+            else if (event.type == TABLEEVENT::TURN)
+                action = TableAction::play(0, event.hand, BotStrategy::getNextMove(event.cards, event.upCard, rules, event.options));
+            else
+            {
+                result.rounds += event.type == TABLEEVENT::ROUND_OVER ? 1 : 0;
+                result.rejected += event.type == TABLEEVENT::REJECTED ? 1 : 0;
+                continue;
+            }
+
+            uint8_t frame[TableProtocol::maxFrameBytes];
+            client.output.insert(client.output.end(), frame, TableProtocol::writeAction(frame, action));
+            result.actions++;
+        }
+    }
+    catch (const std::runtime_error &)
+    {
+        return false;
+    }
+
+    client.input.erase(client.input.begin(), client.input.begin() + (in - client.input.data()));
+    return true;
+}
@@ -0,0 +1,163 @@
+#ifndef LOADGENERATOR_H
+#define LOADGENERATOR_H
+
+#include "quantilesketch.h"
+#include "tableprotocol.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The LoadResult struct is what a LoadGenerator's players did and how long the server took to answer them
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/12/2025
+ */
+struct LoadResult
+{
+    /**
+     * @brief connected The players that connected
+     */
+    int connected = 0;
+
+    /**
+     * @brief dropped The players the server hung up on or that couldn't connect
+     */
+    int dropped = 0;
+
+    /**
+     * @brief actions The bets and moves sent
+     */
+    long long actions = 0;
+
+    /**
+     * @brief rounds The rounds finished
+     */
+    long long rounds = 0;
+
+    /**
+     * @brief rejected The actions the server rejected
+     */
+    long long rejected = 0;
+
+    /**
+     * @brief seconds The seconds spent playing, after every player connected
+     */
+    double seconds = 0;
+
+    /**
+     * @brief latency The microseconds from sending an action to the first frame back
+     */
+    QuantileSketch latency;
+
+    /**
+     * @brief merge Adds another thread's counts to this one
+     * @param other The other result
+     */
+    void merge(const LoadResult &other);
+
+    /**
+     * @brief actionsPerSecond Gets the actions sent per second
+     * @return The throughput
+     */
+    double actionsPerSecond() const;
+};
+
+/**
+ * @brief The LoadGenerator class connects thousands of bot players to a SocketServer and plays them as fast as the server answers.
+ * Bets are a tenth of the money like the game's bots and turns are played by basic strategy. The players are split between
+ * a few threads, each running its share from its own epoll loop. Linux only
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/12/2025
+ */
+class LoadGenerator
+{
+public:
+    /**
+     * @brief LoadGenerator Constructor
+     * @param endpoint Where the server listens
+     * @param rules The house rules of the server's tables, for basic strategy
+     * @param clientCount The number of players
+     * @param threadCount The number of threads playing them, 0 uses every hardware thread
+     */
+    LoadGenerator(const SocketEndpoint &endpoint, const TableRules &rules, int clientCount, unsigned int threadCount);
+
+    /**
+     * @brief run Connects every player, plays for a time, then hangs up
+     * @param seconds How long to play for once every player is connected
+     * @return What the players did
+     */
+    LoadResult run(double seconds);
+
+private:
+    /**
+     * @brief The Client struct is one player's socket
+     */
+    struct Client
+    {
+        /**
+         * @brief descriptor The socket, -1 once it is closed
+         */
+        int descriptor = -1;
+
+        /**
+         * @brief input Bytes read that don't make up a whole frame yet
+         */
+        std::vector<uint8_t> input;
+
+        /**
+         * @brief output Bytes waiting to be written
+         */
+        std::vector<uint8_t> output;
+
+        /**
+         * @brief sentAt When the last action went out in steady clock nanoseconds, 0 once it has been answered
+         */
+        int64_t sentAt = 0;
+    };
+
+    /**
+     * @brief endpoint Where the server listens
+     */
+    SocketEndpoint endpoint;
+
+    /**
+     * @brief rules The house rules of the server's tables
+     */
+    TableRules rules;
+
+    /**
+     * @brief clientCount The number of players
+     */
+    int clientCount;
+
+    /**
+     * @brief threadCount The number of threads
+     */
+    unsigned int threadCount;
+
+    /**
+     * @brief connect Opens a blocking connection to the server
+     * @return The socket, or -1 if it couldn't connect
+     */
+    int connect() const;
+
+    /**
+     * @brief play Plays some of the players until a deadline
+     * @param clients The players, already connected
+     * @param deadline When to stop in steady clock nanoseconds
+     * @param result Counts what the players did
+     */
+    void play(std::vector<Client> &clients, int64_t deadline, LoadResult &result) const;
+
+    /**
+     * @brief answer Reads every whole frame a player has been sent and queues the actions they ask for
+     * @param client The player
+     * @param now The time the frames were read
+     * @param result Counts what the player did
+     * @return False if the server sent something that isn't a frame
+     */
+    bool answer(Client &client, int64_t now, LoadResult &result) const;
+};
+
+#endif // LOADGENERATOR_H
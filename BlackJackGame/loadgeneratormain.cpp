@@ -0,0 +1,94 @@
+/**
+ * @brief Main for the load generator. Connects thousands of bot players to a running blackjackserver and reports the latency of their actions
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/12/2025
+ */
+
+#include "loadgenerator.h"
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+/**
+ * @brief printUsage Prints the command line options of the load generator
+ * @param program The name the program was run as
+ */
+static void printUsage(const char *program)
+{
+    std::cout << "Usage: " << program << " [--clients N] [--threads N] [--seconds N] [--decks N] [--port N | --unix PATH]\n"
+              << "  --clients   Number of players to connect (default 2000)\n"
+              << "  --threads   Number of threads playing them, 0 for every hardware thread (default 2)\n"
+              << "  --seconds   How long to play for once every player is connected (default 10)\n"
+              << "  --decks     Number of decks the server deals from, for basic strategy (default 6)\n"
+              << "  --port      The server's loopback TCP port (default 7777)\n"
+              << "  --unix      The server's Unix domain socket\n";
+}
+
+/**
+ * @brief main Runs the load generator
+ * @param argc Number of args
+ * @param argv Char array of args
+ * @return int An int for the success or failues of the program
+ */
+int main(int argc, char *argv[])
+{
+    int clientCount = 2000;
+    unsigned int threads = 2;
+    double seconds = 10;
+    SocketEndpoint endpoint;
+
+    TableRules rules;
+    rules.deckCount = 6;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--clients") == 0 && hasValue)
+            clientCount = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--threads") == 0 && hasValue)
+            threads = std::strtoul(argv[++i], nullptr, 10);
+        else if (std::strcmp(argv[i], "--seconds") == 0 && hasValue)
+            seconds = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--decks") == 0 && hasValue)
+            rules.deckCount = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--port") == 0 && hasValue)
+            endpoint.port = static_cast<uint16_t>(std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--unix") == 0 && hasValue)
+            endpoint.unixPath = argv[++i];
+        else
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (clientCount < 1 || seconds <= 0 || rules.deckCount < 1)
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    long long fileLimit = SocketEndpoint::raiseFileLimit();
+    if (fileLimit >= 0 && clientCount + 16 > fileLimit)
+        std::cout << "Warning: only " << fileLimit << " descriptors are allowed, some players won't connect\n";
+
+    LoadGenerator generator(endpoint, rules, clientCount, threads);
+    LoadResult result = generator.run(seconds);
+    if (result.connected == 0)
+    {
+        std::cerr << "Couldn't connect to " << endpoint.describe() << "\n";
+        return 1;
+    }
+
+    std::cout << std::fixed << std::setprecision(0)
+              << "Server:       " << endpoint.describe() << "\n"
+              << "Players:      " << result.connected << " connected, " << result.dropped << " dropped\n"
+              << "Rounds:       " << result.rounds << " (" << result.rounds / result.seconds << " rounds/sec)\n"
+              << "Actions:      " << result.actions << " (" << result.actionsPerSecond() << " actions/sec), " << result.rejected << " rejected\n"
+              << "Latency (us): p50 " << result.latency.quantile(0.5) << "  p90 " << result.latency.quantile(0.9) << "  p99 " << result.latency.quantile(0.99)
+              << "  p99.9 " << result.latency.quantile(0.999) << "  max " << result.latency.quantile(1.0) << "\n"
+              << std::defaultfloat;
+    return 0;
+}
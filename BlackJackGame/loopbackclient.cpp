@@ -0,0 +1,87 @@
+/**
+ * @brief Implementation of The LoopbackClient class. It plays user seats of a TableServer in the same process
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/11/2025
+ */
+
+#include "loopbackclient.h"
+#include "bettingpolicy.h"
+#include "botstrategy.h"
+
+LoopbackClient::LoopbackClient(const TableRules &rules) : rules(rules), server(nullptr), stopping(false)
+{
+    thread = std::thread([this]()
+                         { work(); });
+}
+
+LoopbackClient::~LoopbackClient()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_one();
+    thread.join();
+}
+
+void LoopbackClient::connect(TableServer &server)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    this->server = &server;
+}
+
+void LoopbackClient::deliver(const TableEvent &event)
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        inbox.push_back(event);
+    }
+    wake.notify_one();
+}
+
+long long LoopbackClient::getAnswered() const
+{
+    return answered.load(std::memory_order_relaxed);
+}
+
+long long LoopbackClient::getRefused() const
+{
+    return refused.load(std::memory_order_relaxed);
+}
+
+void LoopbackClient::work()
+{
+    // Events are taken a batch at a time so the workers queuing them rarely wait on the lock
+    std::deque<TableEvent> batch;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            wake.wait(guard, [this]()
+                      { return stopping || !inbox.empty(); });
+            if (stopping)
+                return;
+            batch.swap(inbox);
+        }
+
+        for (const TableEvent &event : batch)
+            answer(event);
+        batch.clear();
+    }
+}
+
+void LoopbackClient::answer(const TableEvent &event)
+{
+    TableAction action;
+    if (event.type == TABLEEVENT::BET)
+        action = TableAction::placeBet(event.seat, BettingPolicy::proportional(10).getBet(event.money));
+    else if (event.type == TABLEEVENT::TURN)
+        action = TableAction::play(event.seat, event.hand, BotStrategy::getNextMove(event.cards, event.upCard, rules, event.options));
+    else
+        return;
+
+    answered.fetch_add(1, std::memory_order_relaxed);
+    if (!server->submit(event.table, action))
+        refused.fetch_add(1, std::memory_order_relaxed);
+}
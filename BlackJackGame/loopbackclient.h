@@ -0,0 +1,118 @@
+#ifndef LOOPBACKCLIENT_H
+#define LOOPBACKCLIENT_H
+
+#include "tableserver.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief The LoopbackClient class plays user seats of a TableServer in the same process, standing in for remote players to load the server.
+ * Events are queued by the server's workers and answered on the client's own thread: bets are a tenth of the money like the game's bots,
+ * and turns are played by basic strategy
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/11/2025
+ */
+class LoopbackClient
+{
+public:
+    /**
+     * @brief LoopbackClient Constructor that starts the client's thread
+     * @param rules The house rules of the tables, for basic strategy
+     */
+    explicit LoopbackClient(const TableRules &rules);
+
+    /**
+     * @brief ~LoopbackClient Destructor that stops the client's thread. The server must already be stopped so it sends nothing more
+     */
+    ~LoopbackClient();
+
+    LoopbackClient(const LoopbackClient &) = delete;
+    LoopbackClient &operator=(const LoopbackClient &) = delete;
+
+    /**
+     * @brief connect Sets the server the client answers, before any of its tables are opened
+     * @param server The server
+     */
+    void connect(TableServer &server);
+
+    /**
+     * @brief deliver Queues an event for the client to answer. Safe to call from any thread
+     * @param event The event
+     */
+    void deliver(const TableEvent &event);
+
+    /**
+     * @brief getAnswered Gets the number of bets and moves the client has submitted
+     * @return The number of actions
+     */
+    long long getAnswered() const;
+
+    /**
+     * @brief getRefused Gets the number of actions the server refused because the table had closed or its mailbox was full
+     * @return The number of refused actions
+     */
+    long long getRefused() const;
+
+private:
+    /**
+     * @brief rules The house rules of the tables
+     */
+    TableRules rules;
+
+    /**
+     * @brief server The server the client answers
+     */
+    TableServer *server;
+
+    /**
+     * @brief lock Held to queue or take an event
+     */
+    std::mutex lock;
+
+    /**
+     * @brief wake Signalled when an event is queued or the client is stopping
+     */
+    std::condition_variable wake;
+
+    /**
+     * @brief inbox The events waiting to be answered
+     */
+    std::deque<TableEvent> inbox;
+
+    /**
+     * @brief stopping True once the destructor has started
+     */
+    bool stopping;
+
+    /**
+     * @brief answered The number of actions submitted
+     */
+    std::atomic<long long> answered{0};
+
+    /**
+     * @brief refused The number of actions the server refused
+     */
+    std::atomic<long long> refused{0};
+
+    /**
+     * @brief thread The client's thread
+     */
+    std::thread thread;
+
+    /**
+     * @brief work The loop of the client's thread
+     */
+    void work();
+
+    /**
+     * @brief answer Submits the action an event asks for, if any
+     * @param event The event
+     */
+    void answer(const TableEvent &event);
+};
+
+#endif // LOOPBACKCLIENT_H
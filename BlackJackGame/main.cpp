@@ -8,6 +8,7 @@
 #include "mainwindow.h"
 #include "controller.h"
 #include <QApplication>
+#include <stdexcept>
 
 /**
  * @brief main The point of execution
@@ -19,6 +20,50 @@ int main(int argc, char *argv[])
 {
     QApplication a(argc, argv);
     Controller c;
+
+    // --history FILE records each game to a hand history file
+    QStringList arguments = a.arguments();
+    int history = arguments.indexOf("--history");
+    if (history != -1 && history + 1 < arguments.size())
+        c.setHistoryPath(arguments[history + 1].toStdString());
+
+    // --seed N deals every game from the same seed, as logged when a game starts
+    int seed = arguments.indexOf("--seed");
+    if (seed != -1 && seed + 1 < arguments.size())
+        c.setSeed(arguments[seed + 1].toULongLong());
+
+    // --replay FILE [--from ROUND] plays a hand history back at the table
+    int replay = arguments.indexOf("--replay");
+    int from = arguments.indexOf("--from");
+    if (replay != -1 && replay + 1 < arguments.size())
+    {
+        try
+        {
+            c.setReplay(arguments[replay + 1].toStdString(), from != -1 && from + 1 < arguments.size() ? arguments[from + 1].toLongLong() : 0);
+        }
+        catch (const std::runtime_error &error)
+        {
+            qWarning("%s", error.what());
+        }
+    }
+
+    // --speed 1x|10x|instant plays the table faster. Instant runs the bots and replays as fast as the table can be drawn
+    int speed = arguments.indexOf("--speed");
+    if (speed != -1 && speed + 1 < arguments.size())
+    {
+        bool known = false;
+        for (TIMESCALE scale : TimeScale::allTimeScales)
+        {
+            if (arguments[speed + 1].compare(QString::fromStdString(TimeScale::toString(scale)), Qt::CaseInsensitive) == 0)
+            {
+                c.setTimeScale(scale);
+                known = true;
+            }
+        }
+        if (!known)
+            qWarning("Unknown speed %s, the table plays at 1x", qPrintable(arguments[speed + 1]));
+    }
+
     MainWindow w(&c);
     w.show();
     return a.exec();
@@ -15,8 +15,8 @@ MainWindow::MainWindow(Controller *controller, QWidget *parent)
 
     m_scene = new box2Dbase(this);
 
-    infoBar = new PlayerInfoView(ui);
-    screens = new Screens(ui, m_scene);
+    infoBar = new PlayerInfoView(ui, controller->getEvents());
+    screens = new Screens(ui, m_scene, controller->getTimer());
 
     setUpMainWindowConnects();
     setupCoinAnimViews();
@@ -160,23 +160,15 @@ void MainWindow::setUpMainWindowConnects()
             screens,
             &Screens::onGameOver);
 
-    // Controller -> PlayerInfoView
-    connect(screens,
-            &Screens::sendSettingsAccepted,
-            infoBar,
-            &PlayerInfoView::onSettingsAccepted);
+    // Controller -> PlayerInfoView, which follows the model's event log for everything else
     connect(controller,
-            &Controller::playerUpdated,
+            &Controller::newGame,
             infoBar,
-            &PlayerInfoView::onPlayerUpdated);
+            &PlayerInfoView::onNewGame);
     connect(controller,
             &Controller::updateAllPlayers,
             infoBar,
             &PlayerInfoView::onUpdateAllPlayers);
-    connect(controller,
-            &Controller::splitPlayerUpdateInfo,
-            infoBar,
-            &PlayerInfoView::onSplitPlayers);
     connect(controller,
             &Controller::currentPlayerTurn,
             infoBar,
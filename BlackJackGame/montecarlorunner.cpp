@@ -0,0 +1,113 @@
+/**
+ * @brief Implementation of The MonteCarloRunner class. It plays a batch of rounds across several threads, each with its own Simulator and GameState.
+ * Every thread gets its own Rng stream from a single master seed and a fixed share of the rounds
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/24/2025
+ */
+
+#include "montecarlorunner.h"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+MonteCarloRunner::MonteCarloRunner(int playerCount, const TableRules &rules, unsigned int threadCount, uint64_t masterSeed, int bet, BACKEND backend)
+    : playerCount(playerCount), rules(rules), threadCount(threadCount), masterSeed(masterSeed), bet(bet), backend(backend), useChart(false), backgroundShuffle(false)
+{
+    if (this->threadCount == 0)
+        this->threadCount = std::max(1u, std::thread::hardware_concurrency());
+}
+
+SimulationResult MonteCarloRunner::run(long long rounds) const
+{
+    std::vector<SimulationResult> results(threadCount);
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+
+    // The files are created up front so one that can't be created throws here rather than on a worker thread
+    std::vector<std::unique_ptr<HandHistoryWriter>> histories(threadCount);
+    if (!historyPath.empty())
+        for (unsigned int i = 0; i < threadCount; i++)
+            histories[i] = std::make_unique<HandHistoryWriter>(getHistoryPath(i), playerCount, rules.deckCount);
+    std::vector<std::exception_ptr> failures(threadCount);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int i = 0; i < threadCount; i++)
+    {
+        // Split the rounds evenly, the first threads take the remainder
+        long long share = rounds / threadCount + (i < rounds % threadCount ? 1 : 0);
+
+        // Each thread builds its own table so nothing is shared while playing
+        workers.emplace_back([this, i, share, &results, &histories, &failures]()
+                             {
+            Simulator simulator(playerCount, rules, bet, Rng::stream(masterSeed, i), backend);
+            if (useChart)
+                simulator.setChart(chart);
+            simulator.setShuffleModel(shuffleModel);
+            simulator.setBackgroundShuffle(backgroundShuffle);
+            simulator.setHistory(histories[i].get());
+            try
+            {
+                results[i] = simulator.run(share);
+                if (histories[i])
+                    histories[i]->close();
+            }
+            catch (...)
+            {
+                failures[i] = std::current_exception();
+            } });
+    }
+
+    for (std::thread &worker : workers)
+        worker.join();
+
+    // A failed history write is thrown again here, where the caller can catch it
+    for (const std::exception_ptr &failure : failures)
+        if (failure)
+            std::rethrow_exception(failure);
+
+    // Merge in thread order so the result only depends on the seed and thread count
+    SimulationResult merged;
+    for (const SimulationResult &result : results)
+        merged.merge(result);
+
+    merged.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return merged;
+}
+
+unsigned int MonteCarloRunner::getThreadCount() const
+{
+    return threadCount;
+}
+
+void MonteCarloRunner::setBackgroundShuffle(bool enabled)
+{
+    backgroundShuffle = enabled;
+}
+
+void MonteCarloRunner::setShuffleModel(const ShuffleModel &model)
+{
+    shuffleModel = model;
+}
+
+void MonteCarloRunner::setHistoryPath(const std::string &path)
+{
+    historyPath = path;
+}
+
+std::string MonteCarloRunner::getHistoryPath(unsigned int threadIndex) const
+{
+    if (historyPath.empty() || threadCount == 1)
+        return historyPath;
+    return historyPath + "." + std::to_string(threadIndex);
+}
+
+void MonteCarloRunner::setChart(const StrategyChart &chart)
+{
+    this->chart = chart;
+    useChart = true;
+}
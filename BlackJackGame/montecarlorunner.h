@@ -0,0 +1,132 @@
+#ifndef MONTECARLORUNNER_H
+#define MONTECARLORUNNER_H
+
+#include "simulator.h"
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief The MonteCarloRunner class plays a batch of rounds across several threads, each with its own Simulator and GameState.
+ * Every thread gets its own Rng stream from a single master seed and a fixed share of the rounds,
+ * so the merged result is bit-identical for the same seed and thread count
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/24/2025
+ */
+class MonteCarloRunner
+{
+public:
+    /**
+     * @brief MonteCarloRunner Constructor that sets up the tables each thread will play
+     * @param playerCount The number of seats at each table
+     * @param rules The house rules of each table, including the number of decks
+     * @param threadCount The number of worker threads, 0 uses every hardware thread
+     * @param masterSeed The seed every thread's stream is derived from
+     * @param bet The flat bet each seat places every round
+     * @param backend How the bots choose their moves
+     */
+    MonteCarloRunner(int playerCount, const TableRules &rules, unsigned int threadCount, uint64_t masterSeed, int bet = 10, BACKEND backend = BACKEND::BASIC);
+
+    /**
+     * @brief run Plays the given number of rounds split across the threads and merges the results.
+     * Throws std::runtime_error if a hand history can't be written
+     * @param rounds The total number of rounds to play
+     * @return The merged results of every thread
+     */
+    SimulationResult run(long long rounds) const;
+
+    /**
+     * @brief getThreadCount Gets the number of threads the rounds are split across
+     * @return The number of threads
+     */
+    unsigned int getThreadCount() const;
+
+    /**
+     * @brief setChart Has every table's BASIC backend play from a chart generated for the rules
+     * @param chart The chart to play from
+     */
+    void setChart(const StrategyChart &chart);
+
+    /**
+     * @brief setBackgroundShuffle Has every table shuffle its next shoes on its own background thread
+     * @param enabled True to shuffle in the background
+     */
+    void setBackgroundShuffle(bool enabled);
+
+    /**
+     * @brief setShuffleModel Changes how every table's shoe is shuffled
+     * @param model The uniform shuffle or a casino procedure
+     */
+    void setShuffleModel(const ShuffleModel &model);
+
+    /**
+     * @brief setHistoryPath Has every table record the rounds it plays. With more than one thread, each table writes the path followed by its thread index
+     * @param path The hand history file, empty to record nothing
+     */
+    void setHistoryPath(const std::string &path);
+
+    /**
+     * @brief getHistoryPath Gets the file a table records to
+     * @param threadIndex The index of the table's thread
+     * @return The path of the hand history file, empty when nothing is recorded
+     */
+    std::string getHistoryPath(unsigned int threadIndex) const;
+
+private:
+    /**
+     * @brief playerCount The number of seats at each table
+     */
+    int playerCount;
+
+    /**
+     * @brief rules The house rules of each table
+     */
+    TableRules rules;
+
+    /**
+     * @brief threadCount The number of worker threads
+     */
+    unsigned int threadCount;
+
+    /**
+     * @brief masterSeed The seed every thread's stream is derived from
+     */
+    uint64_t masterSeed;
+
+    /**
+     * @brief bet The flat bet each seat places every round
+     */
+    int bet;
+
+    /**
+     * @brief backend How the bots choose their moves
+     */
+    BACKEND backend;
+
+    /**
+     * @brief chart The chart the tables play from when useChart is set
+     */
+    StrategyChart chart;
+
+    /**
+     * @brief useChart True if the tables play from chart rather than the hand written tables
+     */
+    bool useChart;
+
+    /**
+     * @brief backgroundShuffle True if the tables shuffle on background threads
+     */
+    bool backgroundShuffle;
+
+    /**
+     * @brief shuffleModel How the tables shuffle their shoes
+     */
+    ShuffleModel shuffleModel;
+
+    /**
+     * @brief historyPath The hand history file the tables record to, empty when they don't
+     */
+    std::string historyPath;
+};
+
+#endif // MONTECARLORUNNER_H
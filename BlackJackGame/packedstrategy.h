@@ -0,0 +1,116 @@
+#ifndef PACKEDSTRATEGY_H
+#define PACKEDSTRATEGY_H
+
+#include "card.h"
+#include "hand.h"
+#include "shoecomposition.h"
+#include "strategychart.h"
+#include <array>
+#include <cstdint>
+
+/**
+ * @brief The PackedStrategy class is a StrategyChart packed for lookup speed. Every Hand::getStateId has one 32 bit row
+ * holding the move against each dealer up card in two bits, so the whole chart is 296 bytes and a lookup is a load, a shift and a mask.
+ * States the chart has no row for (hard 4 and below, soft 12, busted hands) hit, or stand once the hand is over 21.
+ * Surrender flags aren't packed, BotStrategy checks them separately since they depend on the hand's options
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/1/2025
+ */
+class PackedStrategy
+{
+public:
+    /**
+     * @brief PackedStrategy Packs a chart
+     * @param chart The chart to pack
+     */
+    constexpr explicit PackedStrategy(const StrategyChart &chart) : rows(pack(chart)) {}
+
+    /**
+     * @brief lookup Gets the move for a state id and dealer up card
+     * @param stateId The Hand::getStateId of the hand
+     * @param dealerIndex The ShoeComposition index of the dealer's up card
+     * @return The move from the chart, never SURRENDER
+     */
+    constexpr MOVE lookup(int stateId, int dealerIndex) const
+    {
+        return static_cast<MOVE>(rows[stateId] >> (dealerIndex * 2) & 3);
+    }
+
+    /**
+     * @brief getMove Gets the move for a hand from the chart, as if every move were allowed
+     * @param hand The player's hand
+     * @param dealerCard The dealer's up card
+     * @return The move from the chart, never SURRENDER
+     */
+    MOVE getMove(const Hand &hand, const Card &dealerCard) const
+    {
+        return lookup(hand.getStateId(), ShoeComposition::indexOf(dealerCard));
+    }
+
+private:
+    /**
+     * @brief Rows One packed row per state id
+     */
+    using Rows = std::array<uint32_t, Hand::stateCount>;
+
+    /**
+     * @brief rows The packed chart
+     */
+    Rows rows;
+
+    /**
+     * @brief packRow Packs a row of a chart table
+     * @param row The moves against each up card
+     * @return The moves two bits each, the two's move in the lowest bits
+     */
+    static constexpr uint32_t packRow(const std::array<MOVE, StrategyChart::dealerColumns> &row)
+    {
+        uint32_t packed = 0;
+        for (int dealer = 0; dealer < StrategyChart::dealerColumns; dealer++)
+            packed |= static_cast<uint32_t>(row[dealer]) << (dealer * 2);
+        return packed;
+    }
+
+    /**
+     * @brief fillRow Packs the same move against every up card
+     * @param move The move
+     * @return The packed row
+     */
+    static constexpr uint32_t fillRow(MOVE move)
+    {
+        uint32_t packed = 0;
+        for (int dealer = 0; dealer < StrategyChart::dealerColumns; dealer++)
+            packed |= static_cast<uint32_t>(move) << (dealer * 2);
+        return packed;
+    }
+
+    /**
+     * @brief pack Lays a chart out by state id
+     * @param chart The chart to pack
+     * @return The packed rows
+     */
+    static constexpr Rows pack(const StrategyChart &chart)
+    {
+        Rows packed{};
+        for (int state = 0; state < Hand::stateCount; state++)
+            packed[state] = fillRow(MOVE::HIT);
+
+        for (int total = 5; total <= 21; total++)
+            packed[total] = packRow(chart.hard[total - 5]);
+        for (int total = 22; total < Hand::softStateBase; total++)
+            packed[total] = fillRow(MOVE::STAND);
+        for (int total = 13; total <= 21; total++)
+            packed[Hand::softStateBase + total] = packRow(chart.soft[total - 13]);
+        for (int pair = 0; pair < StrategyChart::pairRows; pair++)
+            packed[Hand::pairStateBase + pair] = packRow(chart.pair[pair]);
+        return packed;
+    }
+};
+
+/**
+ * @brief gameStrategy The hand written Statistics tables packed at compile time
+ */
+inline constexpr PackedStrategy gameStrategy = PackedStrategy(StrategyChart::fromStatistics());
+
+#endif // PACKEDSTRATEGY_H
@@ -10,7 +10,13 @@
 #include <QHBoxLayout>
 #include <QString>
 
-PlayerInfoView::PlayerInfoView(Ui::MainWindow *ui, QObject *parent) : QObject(parent), ui(ui) {}
+PlayerInfoView::PlayerInfoView(Ui::MainWindow *ui, const GameEventLog &events, QObject *parent)
+    : QObject(parent), events(events), frame(new QTimer(this)), ui(ui)
+{
+    // The model can change many times a frame, the labels only need drawing once
+    connect(frame, &QTimer::timeout, this, &PlayerInfoView::readEvents);
+    frame->start(16);
+}
 
 void PlayerInfoView::buildLayout(int seats)
 {
@@ -133,37 +139,43 @@ bool PlayerInfoView::fillWholeCard(PLAYERSTATUS status)
     return status == PLAYERSTATUS::WON || status == PLAYERSTATUS::BLACKJACK || status == PLAYERSTATUS::LOST || status == PLAYERSTATUS::PUSHED || status == PLAYERSTATUS::BANKRUPT;
 }
 
-void PlayerInfoView::rebuildMapping()
+void PlayerInfoView::readEvents()
 {
-    // Reset modelToSeat to just have seatCount spots
-    modelToSeat.clear();
-    for (int i = 0; i < seatCount; i++)
-        modelToSeat.push_back(i);
-}
+    GameEvent event;
+    while (events.read(cursor, event))
+        mirror.apply(event);
 
-void PlayerInfoView::insertSplitMapping(int playerIndex)
-{
-    // Inserts a new player behind playerIndex but points them to the same original label
-    if (playerIndex < modelToSeat.size())
-        modelToSeat.insert(playerIndex + 1, modelToSeat[playerIndex]);
+    // Each seat shows the hand of it that changed last
+    for (int seat = 0; seat < seatCount; seat++)
+    {
+        if (!mirror.takeChanged(seat))
+            continue;
+        int hand = mirror.getLastHand(seat);
+        paintBorder(seatLabels[seat], mirror.getStatus(hand));
+        setSeatText(seat, mirror.getMoney(seat), mirror.getHand(hand).getBet(), mirror.getStatus(hand), mirror.getHand(hand).getTotal());
+    }
 }
 
-void PlayerInfoView::onSettingsAccepted(const std::vector<Player> &players, int, int)
+void PlayerInfoView::onNewGame(const RoundSnapshot &players)
 {
     userIndex = -1;
 
     // Builds all labels and then updates them
-    buildLayout(static_cast<int>(players.size()));
-    rebuildMapping();
-    for (int i = 0; i < static_cast<int>(players.size()); i++)
+    int seats = static_cast<int>(players.getPlayers().size());
+    buildLayout(seats);
+    for (int i = 0; i < seats; i++)
     {
         // Stores userIndex for creating name of label
-        if (players[i].isUser)
+        if (players.getPlayers()[i].isUser)
         {
             userIndex = i;
         }
-        refreshSeat(modelToSeat[i], players[i], players[i].money);
     }
+
+    // The snapshot is the new game before any event, so the log is followed from here
+    mirror.reset(players.getPlayers(), players.getDealerHand());
+    cursor = events.follow();
+    readEvents();
 }
 
 void PlayerInfoView::refreshSeat(int seat, const Player &player, int money)
@@ -175,40 +187,22 @@ void PlayerInfoView::refreshSeat(int seat, const Player &player, int money)
     setSeatText(seat, money, player.hand.getBet(), player.status, player.hand.getTotal());
 }
 
-void PlayerInfoView::onPlayerUpdated(int playerIndex, const Player &player, int money, int total)
+void PlayerInfoView::onUpdateAllPlayers(const RoundSnapshot &players)
 {
-    if (playerIndex >= modelToSeat.size())
-        return;
-
-    // Updates text and border for the playerIndex label
-    int seat = modelToSeat[playerIndex];
-    paintBorder(seatLabels[seat], player.status);
-    setSeatText(seat, money, player.hand.getBet(), player.status, total);
-}
-
-void PlayerInfoView::onUpdateAllPlayers(const std::vector<Player> &players)
-{
-    // Resets all labels and then updates with new info
-    rebuildMapping();
-    for (int i = 0; i < static_cast<int>(players.size()) && i < modelToSeat.size(); i++)
-        refreshSeat(modelToSeat[i], players[i], players[i].money);
-}
-
-void PlayerInfoView::onSplitPlayers(int originalIndex, const Player &originalPlayer, int money)
-{
-    // Adds a new person to vector after originalIndex and updates the label's money
-    insertSplitMapping(originalIndex);
-    if (originalIndex < modelToSeat.size())
-        refreshSeat(modelToSeat[originalIndex], originalPlayer, money);
+    // The snapshot is the table after every event published so far
+    mirror.reset(players.getPlayers(), players.getDealerHand());
+    cursor = events.follow();
+    readEvents();
 }
 
 void PlayerInfoView::onCurrentPlayerTurn(int newPlayerIndex, int money, int bet, int handTotal)
 {
-    if (newPlayerIndex >= modelToSeat.size())
+    readEvents();
+    if (newPlayerIndex >= mirror.getHandCount() || mirror.getSeat(newPlayerIndex) >= seatCount)
         return;
 
     // Set the border to active for the current player's turn
-    int seat = modelToSeat[newPlayerIndex];
+    int seat = mirror.getSeat(newPlayerIndex);
     paintBorder(seatLabels[seat], PLAYERSTATUS::ACTIVE);
     setSeatText(seat, money, bet, PLAYERSTATUS::ACTIVE, handTotal);
 }
@@ -265,8 +259,10 @@ void PlayerInfoView::onStopEverything()
     ui->playInfoContainer->hide();
 }
 
-void PlayerInfoView::onEndRound(const std::vector<Player> &players)
+void PlayerInfoView::onEndRound(const RoundSnapshot &players)
 {
+    readEvents();
+
     // Keeps track of best hand for a split player
     std::vector<int> bestHandsIndex = std::vector<int>(seatCount);
     int player = -1;
@@ -3,15 +3,20 @@
 
 #include <QObject>
 #include <QLabel>
+#include <QTimer>
 #include <QVector>
+#include "gameeventlog.h"
 #include "player.h"
+#include "roundsnapshot.h"
 #include "playerStatus.h"
+#include "tablemirror.h"
 #include "ui_mainwindow.h"
 
 using PlayerStatus::PLAYERSTATUS;
 
 /**
- * @brief The PlayerInfoView class is responsible for creating and maintaining player info cards in the info bar in the UI
+ * @brief The PlayerInfoView class is responsible for creating and maintaining player info cards in the info bar in the UI.
+ * It follows the model's GameEventLog once a frame rather than being sent every player after every action, and redraws only the seats that changed
  *
  * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
  * @date 4/21/2025
@@ -23,42 +28,24 @@ public:
     /**
      * @brief PlayerInfoView Constructor to create the player bar view
      * @param ui
+     * @param events The log of the model's changes to follow, kept by the controller for as long as the view
      * @param parent
      */
-    explicit PlayerInfoView(Ui::MainWindow *ui, QObject *parent = nullptr);
+    explicit PlayerInfoView(Ui::MainWindow *ui, const GameEventLog &events, QObject *parent = nullptr);
 
 public slots:
     /**
-     * @brief onSettingsAccepted Slot to create the player info cards once the settings and players have been setup
-     * @param players The players in the game
-     * @param deckCount The number of decks used in the game
-     * @param deterministic 0 for random shuffle, 1 for single player determined shuffle, 2 > for multiple player determined shuffle
+     * @brief onNewGame Slot to create the player info cards once the controller has made a new game, from the model's players
+     * so a replay's seats show the money and status they start with in the history
+     * @param players The players of the new game
      */
-    void onSettingsAccepted(const std::vector<Player> &players, int deckCount, int deterministic);
+    void onNewGame(const RoundSnapshot &players);
 
     /**
-     * @brief onPlayerUpdated Slot to update the money and status of the player at the passed index
-     * @param playerIndex The index of the player
-     * @param hand The hand of the player
-     * @param total The total of the cards in the hand
-     * @param money The money the player has
-     * @param status The status of the player
-     */
-    void onPlayerUpdated(int playerIndex, const Player &player, int money, int total); // TODO
-
-    /**
-     * @brief onUpdateAllPlayers Slot to update all of the players
+     * @brief onUpdateAllPlayers Slot to start following the log again from the players just dealt, so a view that fell a whole log behind catches up each round
      * @param players The players to update
      */
-    void onUpdateAllPlayers(const std::vector<Player> &players);
-
-    /**
-     * @brief onSplitPlayers Slot that a player split
-     * @param originalIndex The index of the original player who split
-     * @param originalPlayer The original player
-     * @param money The money of the first hand
-     */
-    void onSplitPlayers(int originalIndex, const Player &originalPlayer, int money);
+    void onUpdateAllPlayers(const RoundSnapshot &players);
 
     /**
      * @brief onCurrentPlayerTurn Slot to select a new player
@@ -78,10 +65,28 @@ public slots:
      * @brief onEndRound Slot to receive when the round has ended
      * @param players The players after the round has ended
      */
-    void onEndRound(const std::vector<Player> &players);
+    void onEndRound(const RoundSnapshot &players);
 
 private:
-    QVector<int> modelToSeat;
+    /**
+     * @brief events The log of the model's changes
+     */
+    const GameEventLog &events;
+
+    /**
+     * @brief cursor Where the view is in the log
+     */
+    GameEventLog::Cursor cursor;
+
+    /**
+     * @brief mirror The table as rebuilt from the log
+     */
+    TableMirror mirror;
+
+    /**
+     * @brief frame Reads the log once a frame
+     */
+    QTimer *frame;
 
     /**
      * @brief seatCount Number of players
@@ -110,15 +115,10 @@ private:
     void buildLayout(int seats);
 
     /**
-     * @brief rebuildMapping Rebuilds the labels to correctly correspond to a player after splitting
-     */
-    void rebuildMapping();
-
-    /**
-     * @brief insertSplitMapping Inserts a new player into the modelToSeat to get the proper label index after a split
-     * @param modelIndex The index of the original player
+     * @brief readEvents Applies the events published since the last read and redraws the seats they changed.
+     * Called before anything the controller tells the view directly, so it is drawn over the changes that came before it
      */
-    void insertSplitMapping(int modelIndex);
+    void readEvents();
 
     /**
      * @brief refreshSeat Refreshes the label for the player at the given seat
@@ -0,0 +1,78 @@
+/**
+ * @brief Implementation of The PlayerTable class. It stores every seat and hand at the table as parallel arrays, with split hands appended to an arena
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/2/2025
+ */
+
+#include "playertable.h"
+
+using PlayerStatus::PLAYERSTATUS;
+
+/**
+ * @brief reservedHandsPerSeat Arena slots set aside per seat up front, enough for a seat to split to four hands without reallocating
+ */
+static const int reservedHandsPerSeat = 4;
+
+Player PlayerView::toPlayer() const
+{
+    Player player(money(), hand().getBet(), isUser(), playerHandCount(), playerHandIndex());
+    player.hand = hand();
+    player.originalHand = originalHand();
+    player.status = status();
+    return player;
+}
+
+PlayerTable::PlayerTable(const std::vector<Player> &players) : seatCount(static_cast<int>(players.size()))
+{
+    hands.reserve(seatCount * reservedHandsPerSeat);
+    statuses.reserve(seatCount * reservedHandsPerSeat);
+    seats.reserve(seatCount * reservedHandsPerSeat);
+    order.reserve(seatCount * reservedHandsPerSeat);
+
+    for (int i = 0; i < seatCount; i++)
+    {
+        hands.push_back(players[i].hand);
+        statuses.push_back(players[i].status);
+        seats.push_back(i);
+        order.push_back(i);
+        seatMoney.push_back(players[i].money);
+        users.push_back(players[i].isUser);
+        handCounts.push_back(1);
+        seatStarts.push_back(i);
+    }
+}
+
+int PlayerTable::split(int position)
+{
+    int slot = order[position];
+    int splitSeat = seats[slot];
+
+    // The new hand goes on the end of the arena, only its slot number is inserted into the play order
+    int newSlot = static_cast<int>(hands.size());
+    hands.push_back(Hand(hands[slot].getBet()));
+    statuses.push_back(PLAYERSTATUS::WAITING);
+    seats.push_back(splitSeat);
+    order.insert(order.begin() + position + 1, newSlot);
+
+    handCounts[splitSeat]++;
+    for (int later = splitSeat + 1; later < seatCount; later++)
+        seatStarts[later]++;
+
+    return position + 1;
+}
+
+void PlayerTable::clearSplits()
+{
+    hands.resize(seatCount);
+    statuses.resize(seatCount);
+    seats.resize(seatCount);
+    order.resize(seatCount);
+
+    for (int i = 0; i < seatCount; i++)
+    {
+        order[i] = i;
+        seatStarts[i] = i;
+        handCounts[i] = 1;
+    }
+}
@@ -0,0 +1,357 @@
+#ifndef PLAYERTABLE_H
+#define PLAYERTABLE_H
+
+#include "hand.h"
+#include "player.h"
+#include "playerStatus.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class PlayerTable;
+
+/**
+ * @brief The PlayerView class is a read only view of one hand in a PlayerTable, with the same fields a Player has.
+ * It only holds the table and the hand's position, so it is free to copy and always sees the table's current state
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/2/2025
+ */
+class PlayerView
+{
+public:
+    /**
+     * @brief PlayerView Constructor for a view of the hand at a position
+     * @param table The table the hand is in
+     * @param position The hand's position in play order
+     */
+    PlayerView(const PlayerTable &table, int position) : table(&table), position(position) {}
+
+    /**
+     * @brief hand Gets the hand's cards and bet
+     */
+    const Hand &hand() const;
+
+    /**
+     * @brief money Gets the seat's money for its original hand, 0 for a split hand like Player
+     */
+    int money() const;
+
+    /**
+     * @brief status Gets the hand's status
+     */
+    PlayerStatus::PLAYERSTATUS status() const;
+
+    /**
+     * @brief isUser Checks if the seat is played by a user
+     */
+    bool isUser() const;
+
+    /**
+     * @brief originalHand Checks if this is the seat's original hand rather than a split
+     */
+    bool originalHand() const;
+
+    /**
+     * @brief playerHandCount Gets the number of hands the seat has for its original hand, 0 for a split hand like Player
+     */
+    unsigned int playerHandCount() const;
+
+    /**
+     * @brief playerHandIndex Gets the offset of the hand from the seat's original hand in play order
+     */
+    unsigned int playerHandIndex() const;
+
+    /**
+     * @brief getPosition Gets the hand's position in play order
+     */
+    int getPosition() const { return position; }
+
+    /**
+     * @brief toPlayer Copies the hand out into a Player
+     * @return A Player with the same fields
+     */
+    Player toPlayer() const;
+
+private:
+    /**
+     * @brief table The table the hand is in
+     */
+    const PlayerTable *table;
+
+    /**
+     * @brief position The hand's position in play order
+     */
+    int position;
+};
+
+/**
+ * @brief The PlayerSpan struct is a read only view of every hand in a PlayerTable in play order. It can be iterated like a const std::vector<Player>
+ * without copying any hands
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/2/2025
+ */
+struct PlayerSpan
+{
+    /**
+     * @brief The Iterator struct steps through the positions of the table
+     */
+    struct Iterator
+    {
+        /**
+         * @brief table The table being iterated
+         */
+        const PlayerTable *table;
+
+        /**
+         * @brief position The current position
+         */
+        int position;
+
+        /**
+         * @brief operator * Gets a view of the hand at the current position
+         */
+        PlayerView operator*() const { return PlayerView(*table, position); }
+
+        /**
+         * @brief operator ++ Moves to the next position
+         */
+        Iterator &operator++()
+        {
+            position++;
+            return *this;
+        }
+
+        /**
+         * @brief operator != Checks if two iterators are at different positions
+         * @param other The other iterator
+         */
+        bool operator!=(const Iterator &other) const { return position != other.position; }
+
+        /**
+         * @brief operator == Checks if two iterators are at the same position
+         * @param other The other iterator
+         */
+        bool operator==(const Iterator &other) const { return position == other.position; }
+    };
+
+    /**
+     * @brief table The table the span views
+     */
+    const PlayerTable *table;
+
+    /**
+     * @brief count The number of hands in the span
+     */
+    int count;
+
+    /**
+     * @brief begin Gets the first hand to iterate from
+     */
+    Iterator begin() const { return Iterator{table, 0}; }
+
+    /**
+     * @brief end Gets one past the last hand
+     */
+    Iterator end() const { return Iterator{table, count}; }
+
+    /**
+     * @brief size Gets the number of hands in the span
+     */
+    std::size_t size() const { return static_cast<std::size_t>(count); }
+
+    /**
+     * @brief operator [] Gets the hand at a position without bounds checking
+     * @param position The position in play order
+     */
+    PlayerView operator[](int position) const { return PlayerView(*table, position); }
+};
+
+/**
+ * @brief The PlayerTable class stores every seat and hand at the table as parallel arrays instead of a vector of Player.
+ * Hands live in an arena: each seat's original hand is in the first slots, and split hands are appended to the end for the rest of the round,
+ * so splitting never moves another hand. Play order is a separate array of slot numbers, the only thing a split inserts into.
+ * Money, user flags and hand counts are kept once per seat, and each hand keeps its status and the seat it belongs to.
+ * Clearing the splits between rounds just truncates the arrays, so a table stops allocating once it has seen its largest round
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/2/2025
+ */
+class PlayerTable
+{
+public:
+    /**
+     * @brief PlayerTable Constructor that gives each player a seat
+     * @param players The players, one per seat, their hands, money and statuses are copied in
+     */
+    explicit PlayerTable(const std::vector<Player> &players);
+
+    /**
+     * @brief size Gets the number of hands being played, every seat's hand plus the split hands
+     */
+    int size() const { return static_cast<int>(order.size()); }
+
+    /**
+     * @brief getSeatCount Gets the number of seats
+     */
+    int getSeatCount() const { return seatCount; }
+
+    /**
+     * @brief hand Gets the hand at a position in play order
+     * @param position The position
+     */
+    Hand &hand(int position) { return hands[order[position]]; }
+
+    /**
+     * @brief hand Gets the hand at a position in play order
+     * @param position The position
+     */
+    const Hand &hand(int position) const { return hands[order[position]]; }
+
+    /**
+     * @brief status Gets the status of the hand at a position in play order
+     * @param position The position
+     */
+    PlayerStatus::PLAYERSTATUS &status(int position) { return statuses[order[position]]; }
+
+    /**
+     * @brief status Gets the status of the hand at a position in play order
+     * @param position The position
+     */
+    PlayerStatus::PLAYERSTATUS status(int position) const { return statuses[order[position]]; }
+
+    /**
+     * @brief seat Gets the seat a hand belongs to
+     * @param position The position of the hand in play order
+     */
+    int seat(int position) const { return seats[order[position]]; }
+
+    /**
+     * @brief isOriginal Checks if the hand at a position is a seat's original hand rather than a split
+     * @param position The position
+     */
+    bool isOriginal(int position) const { return order[position] < seatCount; }
+
+    /**
+     * @brief handIndex Gets the offset of a hand from its seat's original hand in play order
+     * @param position The position of the hand
+     */
+    unsigned int handIndex(int position) const { return static_cast<unsigned int>(position - seatStarts[seat(position)]); }
+
+    /**
+     * @brief seatStart Gets the position of a seat's original hand in play order
+     * @param seat The seat
+     */
+    int seatStart(int seat) const { return seatStarts[seat]; }
+
+    /**
+     * @brief money Gets a seat's money
+     * @param seat The seat
+     */
+    int &money(int seat) { return seatMoney[seat]; }
+
+    /**
+     * @brief money Gets a seat's money
+     * @param seat The seat
+     */
+    int money(int seat) const { return seatMoney[seat]; }
+
+    /**
+     * @brief isUser Checks if a seat is played by a user
+     * @param seat The seat
+     */
+    bool isUser(int seat) const { return users[seat] != 0; }
+
+    /**
+     * @brief handCount Gets the number of hands a seat is playing
+     * @param seat The seat
+     */
+    unsigned int handCount(int seat) const { return handCounts[seat]; }
+
+    /**
+     * @brief split Adds an empty hand with the same bet right after the hand at a position, for the same seat.
+     * References to hands taken before the split are no longer valid
+     * @param position The position of the hand being split
+     * @return The position of the new hand
+     */
+    int split(int position);
+
+    /**
+     * @brief clearSplits Removes every split hand, leaving each seat's original hand in seat order
+     */
+    void clearSplits();
+
+    /**
+     * @brief view Gets a view of the hand at a position
+     * @param position The position
+     */
+    PlayerView view(int position) const { return PlayerView(*this, position); }
+
+    /**
+     * @brief players Gets a view of every hand in play order
+     */
+    PlayerSpan players() const { return PlayerSpan{this, size()}; }
+
+private:
+    /**
+     * @brief seatCount The number of seats, and so the number of original hands at the start of the arena
+     */
+    int seatCount;
+
+    /**
+     * @brief hands The arena of hands, original hands by seat then split hands in the order they were made
+     */
+    std::vector<Hand> hands;
+
+    /**
+     * @brief statuses The status of each hand in the arena
+     */
+    std::vector<PlayerStatus::PLAYERSTATUS> statuses;
+
+    /**
+     * @brief seats The seat each hand in the arena belongs to
+     */
+    std::vector<int> seats;
+
+    /**
+     * @brief order The arena slot of each hand in play order
+     */
+    std::vector<int> order;
+
+    /**
+     * @brief seatMoney The money of each seat
+     */
+    std::vector<int> seatMoney;
+
+    /**
+     * @brief users One for each seat played by a user
+     */
+    std::vector<uint8_t> users;
+
+    /**
+     * @brief handCounts The number of hands each seat is playing
+     */
+    std::vector<unsigned int> handCounts;
+
+    /**
+     * @brief seatStarts The position of each seat's original hand in play order
+     */
+    std::vector<int> seatStarts;
+};
+
+inline const Hand &PlayerView::hand() const { return table->hand(position); }
+
+inline int PlayerView::money() const { return originalHand() ? table->money(table->seat(position)) : 0; }
+
+inline PlayerStatus::PLAYERSTATUS PlayerView::status() const { return table->status(position); }
+
+inline bool PlayerView::isUser() const { return table->isUser(table->seat(position)); }
+
+inline bool PlayerView::originalHand() const { return table->isOriginal(position); }
+
+inline unsigned int PlayerView::playerHandCount() const { return originalHand() ? table->handCount(table->seat(position)) : 0; }
+
+inline unsigned int PlayerView::playerHandIndex() const { return table->handIndex(position); }
+
+#endif // PLAYERTABLE_H
@@ -0,0 +1,95 @@
+/**
+ * @brief Implementation of The QuantileSketch class. It estimates quantiles of a stream of non negative whole numbers in constant memory
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/10/2025
+ */
+
+#include "quantilesketch.h"
+#include <algorithm>
+#include <cmath>
+
+QuantileSketch::QuantileSketch() : count(0), sum(0) {}
+
+std::size_t QuantileSketch::bucketOf(long long value)
+{
+    if (value < exactValues)
+        return static_cast<std::size_t>(value);
+
+    // Shift the value down until its top bits are the sub bucket, the shift picks the power of two
+    int shift = 0;
+#if defined(__GNUC__)
+    shift = 63 - __builtin_clzll(static_cast<unsigned long long>(value)) - subBucketBits;
+#else
+    while ((value >> shift) >= exactValues)
+        shift++;
+#endif
+    long long subBucket = value >> shift;
+    return static_cast<std::size_t>((static_cast<long long>(shift) << subBucketBits) + subBucket);
+}
+
+long long QuantileSketch::lowestIn(std::size_t bucket)
+{
+    if (bucket < static_cast<std::size_t>(exactValues))
+        return static_cast<long long>(bucket);
+
+    int shift = static_cast<int>(bucket >> subBucketBits) - 1;
+    long long subBucket = static_cast<long long>(bucket) - (static_cast<long long>(shift) << subBucketBits);
+    return subBucket << shift;
+}
+
+void QuantileSketch::add(long long value)
+{
+    value = std::max(value, 0LL);
+    std::size_t bucket = bucketOf(value);
+    if (bucket >= buckets.size())
+        buckets.resize(bucket + 1, 0);
+
+    buckets[bucket]++;
+    count++;
+    sum += static_cast<double>(value);
+}
+
+void QuantileSketch::merge(const QuantileSketch &other)
+{
+    if (other.buckets.size() > buckets.size())
+        buckets.resize(other.buckets.size(), 0);
+    for (std::size_t i = 0; i < other.buckets.size(); i++)
+        buckets[i] += other.buckets[i];
+
+    count += other.count;
+    sum += other.sum;
+}
+
+long long QuantileSketch::quantile(double fraction) const
+{
+    if (count == 0)
+        return 0;
+
+    // The value with this many values at or below it, counting from 1
+    long long rank = static_cast<long long>(std::ceil(std::clamp(fraction, 0.0, 1.0) * count));
+    rank = std::clamp(rank, 1LL, count);
+
+    long long seen = 0;
+    for (std::size_t bucket = 0; bucket < buckets.size(); bucket++)
+    {
+        seen += static_cast<long long>(buckets[bucket]);
+        if (seen < rank)
+            continue;
+
+        long long lowest = lowestIn(bucket);
+        long long width = lowestIn(bucket + 1) - lowest;
+        return lowest + width / 2;
+    }
+    return lowestIn(buckets.size() - 1);
+}
+
+long long QuantileSketch::getCount() const
+{
+    return count;
+}
+
+double QuantileSketch::getMean() const
+{
+    return count > 0 ? sum / count : 0;
+}
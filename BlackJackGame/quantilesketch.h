@@ -0,0 +1,96 @@
+#ifndef QUANTILESKETCH_H
+#define QUANTILESKETCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The QuantileSketch class estimates quantiles of a stream of non negative whole numbers, like money or round counts, in constant memory.
+ * Values below 128 are counted exactly and larger ones in buckets 1/64 of a power of two wide, so a quantile is within 0.8% of a value that was added.
+ * Sketches of different threads merge by adding their counts, which doesn't depend on the order they are merged in
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/10/2025
+ */
+class QuantileSketch
+{
+public:
+    /**
+     * @brief QuantileSketch Constructor that starts the sketch empty
+     */
+    QuantileSketch();
+
+    /**
+     * @brief add Counts a value
+     * @param value The value, negative values are counted as 0
+     */
+    void add(long long value);
+
+    /**
+     * @brief merge Counts every value another sketch counted
+     * @param other The sketch to add in
+     */
+    void merge(const QuantileSketch &other);
+
+    /**
+     * @brief quantile Estimates the value a given fraction of the counted values are at or below
+     * @param fraction The fraction, 0 for the smallest value and 1 for the largest
+     * @return The middle of the bucket the quantile falls in, exact below 128, or 0 if nothing was counted
+     */
+    long long quantile(double fraction) const;
+
+    /**
+     * @brief getCount Gets the number of values counted
+     * @return The count
+     */
+    long long getCount() const;
+
+    /**
+     * @brief getMean Gets the exact mean of the values counted
+     * @return The mean, or 0 if nothing was counted
+     */
+    double getMean() const;
+
+private:
+    /**
+     * @brief subBucketBits Each power of two above the exact range is split into 2^subBucketBits buckets
+     */
+    static constexpr int subBucketBits = 6;
+
+    /**
+     * @brief exactValues Values below this have a bucket each
+     */
+    static constexpr long long exactValues = 2LL << subBucketBits;
+
+    /**
+     * @brief buckets The count of values in each bucket, grown to the largest bucket used
+     */
+    std::vector<uint64_t> buckets;
+
+    /**
+     * @brief count The number of values counted
+     */
+    long long count;
+
+    /**
+     * @brief sum The sum of the values counted, kept as a double so billions of large values don't overflow
+     */
+    double sum;
+
+    /**
+     * @brief bucketOf Gets the bucket a value is counted in
+     * @param value The value, at least 0
+     * @return The bucket index
+     */
+    static std::size_t bucketOf(long long value);
+
+    /**
+     * @brief lowestIn Gets the smallest value counted in a bucket
+     * @param bucket The bucket index
+     * @return The smallest value
+     */
+    static long long lowestIn(std::size_t bucket);
+};
+
+#endif // QUANTILESKETCH_H
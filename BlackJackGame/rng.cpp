@@ -0,0 +1,61 @@
+/**
+ * @brief Implementation of The Rng class. It is a small, fast xoshiro256** random number generator.
+ * A single master seed can be split into independent streams with jump()
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/24/2025
+ */
+
+#include "rng.h"
+#include <random>
+
+Rng::Rng() : Rng(randomSeed()) {}
+
+Rng::Rng(uint64_t seed)
+{
+    // Expand the seed with SplitMix64 so similar seeds give unrelated states
+    for (uint64_t &word : state)
+    {
+        seed += 0x9e3779b97f4a7c15;
+        uint64_t z = seed;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        word = z ^ (z >> 31);
+    }
+}
+
+Rng Rng::stream(uint64_t masterSeed, unsigned int streamIndex)
+{
+    Rng rng(masterSeed);
+    for (unsigned int i = 0; i < streamIndex; i++)
+        rng.jump();
+    return rng;
+}
+
+uint64_t Rng::randomSeed()
+{
+    std::random_device device;
+    return (static_cast<uint64_t>(device()) << 32) ^ device();
+}
+
+void Rng::jump()
+{
+    static const uint64_t jumpTable[] = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c};
+
+    uint64_t jumped[4] = {0, 0, 0, 0};
+    for (uint64_t jumpWord : jumpTable)
+    {
+        for (int bit = 0; bit < 64; bit++)
+        {
+            if (jumpWord & (uint64_t(1) << bit))
+            {
+                for (int i = 0; i < 4; i++)
+                    jumped[i] ^= state[i];
+            }
+            (*this)();
+        }
+    }
+
+    for (int i = 0; i < 4; i++)
+        state[i] = jumped[i];
+}
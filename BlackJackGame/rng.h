@@ -0,0 +1,100 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief The Rng class is a small, fast xoshiro256** random number generator.
+ * A single master seed can be split into independent streams with jump(), which advances the generator by 2^128 steps,
+ * so parallel simulations stay reproducible for the same seed and stream count
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/24/2025
+ */
+class Rng
+{
+public:
+    /**
+     * @brief result_type The type of number produced, required by std::shuffle and the std distributions
+     */
+    using result_type = uint64_t;
+
+    /**
+     * @brief Rng Constructor that seeds the generator from std::random_device, for play that doesn't need to be reproduced
+     */
+    Rng();
+
+    /**
+     * @brief Rng Constructor that seeds the generator from a single 64 bit seed
+     * @param seed The seed to expand into the generator state
+     */
+    explicit Rng(uint64_t seed);
+
+    /**
+     * @brief stream Creates the generator for one stream of a master seed
+     * @param masterSeed The seed shared by every stream
+     * @param streamIndex The index of the stream, each index is 2^128 steps after the previous one
+     * @return The generator for the stream
+     */
+    static Rng stream(uint64_t masterSeed, unsigned int streamIndex);
+
+    /**
+     * @brief randomSeed Gets a non deterministic seed from std::random_device
+     * @return A 64 bit seed
+     */
+    static uint64_t randomSeed();
+
+    /**
+     * @brief jump Advances the generator by 2^128 steps
+     */
+    void jump();
+
+    /**
+     * @brief operator () Generates the next random number
+     * @return A uniformly distributed 64 bit number
+     */
+    uint64_t operator()()
+    {
+        uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+        uint64_t shifted = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= shifted;
+        state[3] = rotateLeft(state[3], 45);
+
+        return result;
+    }
+
+    /**
+     * @brief min The smallest number the generator produces
+     */
+    static constexpr uint64_t min() { return 0; }
+
+    /**
+     * @brief max The largest number the generator produces
+     */
+    static constexpr uint64_t max() { return std::numeric_limits<uint64_t>::max(); }
+
+private:
+    /**
+     * @brief state The 256 bit state of the generator
+     */
+    uint64_t state[4];
+
+    /**
+     * @brief rotateLeft Rotates the bits of a number left
+     * @param x The number to rotate
+     * @param k The number of bits to rotate by
+     * @return The rotated number
+     */
+    static uint64_t rotateLeft(uint64_t x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+};
+
+#endif // RNG_H
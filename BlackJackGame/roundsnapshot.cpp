@@ -0,0 +1,14 @@
+/**
+ * @brief Implementation of The RoundSnapshot class. It is an immutable, shared copy of the hands at one point in a round
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/3/2025
+ */
+
+#include "roundsnapshot.h"
+#include <utility>
+
+RoundSnapshot::RoundSnapshot() : RoundSnapshot(std::vector<Player>(), Hand(0), 0) {}
+
+RoundSnapshot::RoundSnapshot(std::vector<Player> players, const Hand &dealerHand, uint64_t version)
+    : data(std::make_shared<const Data>(Data{std::move(players), dealerHand, version})) {}
@@ -0,0 +1,99 @@
+#ifndef ROUNDSNAPSHOT_H
+#define ROUNDSNAPSHOT_H
+
+#include "hand.h"
+#include "player.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief The RoundSnapshot class is an immutable copy of every hand and the dealer's hand at one point in a round.
+ * The copy is shared and reference counted, so passing a snapshot around or storing it copies a pointer, not the hands.
+ * GameState makes a new copy only when something has changed since its last snapshot
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/3/2025
+ */
+class RoundSnapshot
+{
+public:
+    /**
+     * @brief RoundSnapshot Constructor for an empty snapshot that has no hands
+     */
+    RoundSnapshot();
+
+    /**
+     * @brief RoundSnapshot Constructor that takes ownership of the hands
+     * @param players Every hand in play order
+     * @param dealerHand The dealer's hand
+     * @param version The version of the model the hands were copied from
+     */
+    RoundSnapshot(std::vector<Player> players, const Hand &dealerHand, uint64_t version);
+
+    /**
+     * @brief getPlayers Gets every hand in play order
+     */
+    const std::vector<Player> &getPlayers() const { return data->players; }
+
+    /**
+     * @brief getDealerHand Gets the dealer's hand
+     */
+    const Hand &getDealerHand() const { return data->dealerHand; }
+
+    /**
+     * @brief getVersion Gets the version of the model the snapshot was taken at. Two snapshots with the same version hold the same hands
+     */
+    uint64_t getVersion() const { return data->version; }
+
+    /**
+     * @brief size Gets the number of hands
+     */
+    std::size_t size() const { return data->players.size(); }
+
+    /**
+     * @brief operator [] Gets the hand at a position in play order
+     * @param index The position
+     */
+    const Player &operator[](std::size_t index) const { return data->players[index]; }
+
+    /**
+     * @brief begin Gets the first hand to iterate from
+     */
+    std::vector<Player>::const_iterator begin() const { return data->players.begin(); }
+
+    /**
+     * @brief end Gets one past the last hand
+     */
+    std::vector<Player>::const_iterator end() const { return data->players.end(); }
+
+private:
+    /**
+     * @brief The Data struct is the shared part of a snapshot
+     */
+    struct Data
+    {
+        /**
+         * @brief players Every hand in play order
+         */
+        std::vector<Player> players;
+
+        /**
+         * @brief dealerHand The dealer's hand
+         */
+        Hand dealerHand;
+
+        /**
+         * @brief version The version of the model the hands were copied from
+         */
+        uint64_t version;
+    };
+
+    /**
+     * @brief data The hands, shared with every copy of the snapshot
+     */
+    std::shared_ptr<const Data> data;
+};
+
+#endif // ROUNDSNAPSHOT_H
@@ -8,14 +8,15 @@
 
 #include "screens.h"
 #include "botstrategy.h"
+#include "cardimages.h"
 #include <QPalette>
 #include <QPixmap>
 #include <QGraphicsDropShadowEffect>
 #include <QRandomGenerator>
 #include <QtMath>
 
-Screens::Screens(Ui::MainWindow *ui, box2Dbase *m_scene, QWidget *parent)
-    : QStackedWidget(parent), ui(ui), m_scene(m_scene)
+Screens::Screens(Ui::MainWindow *ui, box2Dbase *m_scene, TimerManager *timer, QWidget *parent)
+    : QStackedWidget(parent), ui(ui), timer(timer), timerScope(timer->createScope()), m_scene(m_scene)
 {
     // Ensure the start Screen in displayed
     moveToStartScreen();
@@ -33,9 +34,6 @@ Screens::Screens(Ui::MainWindow *ui, box2Dbase *m_scene, QWidget *parent)
     setUpBankruptcyMenu();
     setUpRecomendedMove();
 
-    // Set up timer
-    timer = new TimerManager();
-
     // Set up tutorial popup
     tutorialPopup = new TutorialPopup(ui, QWidgetStyle, QPushButtonStyleSmallFont);
 
@@ -45,7 +43,7 @@ Screens::Screens(Ui::MainWindow *ui, box2Dbase *m_scene, QWidget *parent)
 
 Screens::~Screens()
 {
-    delete timer;
+    timer->cancelScope(timerScope);
     delete tableView;
     delete tutorialPopup;
 }
@@ -190,7 +188,7 @@ void Screens::setUpScreenConnects()
 
 void Screens::setUpTable()
 {
-    tableView = new TableView(ui->table);
+    tableView = new TableView(timer, ui->table);
     if (!ui->table->layout())
     {
         ui->table->setLayout(new QVBoxLayout());
@@ -887,7 +885,7 @@ void Screens::acceptSettingsButtonPressed()
     // Hide gameplay buttons during setup
     toggleVisibleGamePlayButtons(false);
 
-    int determinedDeck;
+    SHOEORDER order;
 
     // Set up based on game mode
     if (mode == GAMEPLAYMODE::BLACKJACK)
@@ -898,18 +896,18 @@ void Screens::acceptSettingsButtonPressed()
 
         // Show betting UI
         toggleVisibleBettingView(true);
-        determinedDeck = 0;
+        order = SHOEORDER::RANDOM;
     }
     else if (mode == GAMEPLAYMODE::BLACKJACKTUTORIAL)
     {
         initialMoney = 1000000;
-        determinedDeck = 1;
+        order = SHOEORDER::TUTORIAL;
         deckCount = 2;
     }
     else if (mode == GAMEPLAYMODE::BLACKJACKPRACTICE)
     {
         initialMoney = 1000000;
-        determinedDeck = 0;
+        order = SHOEORDER::RANDOM;
         deckCount = 1;
     }
 
@@ -930,7 +928,7 @@ void Screens::acceptSettingsButtonPressed()
     tableView->createPlayerCardContainers(playerCount);
 
     // Notify model
-    emit sendSettingsAccepted(players, deckCount, determinedDeck);
+    emit sendSettingsAccepted(players, deckCount, order);
 
     // Show dealer's card pile
     tableView->createDealerPile();
@@ -946,7 +944,7 @@ void Screens::acceptSettingsButtonPressed()
                                   {
             emit sendGameSetupCompleteStartBetting();
             updateBetLabelText(0);
-            onPressPlacedBetButton(); });
+            onPressPlacedBetButton(); }, timerScope);
     }
 
     // Ensure buttons remain disabled initially
@@ -980,7 +978,7 @@ void Screens::playerUpdated(int playerIndex, const Player &player, int)
     // If only one card, deal it immediately
     if (player.hand.getCards().size() == 1)
     {
-        dealCard(playerIndex, player.playerHandIndex, player.hand.getCards()[0].getImagePath());
+        dealCard(playerIndex, player.playerHandIndex, CardImages::imagePath(player.hand.getCards()[0]));
     }
     // If multiple cards, animate new ones only
     else if (player.hand.getCards().size() >= 2)
@@ -993,13 +991,13 @@ void Screens::playerUpdated(int playerIndex, const Player &player, int)
             // If first card updated, deal immediately
             if (firstLoop)
             {
-                dealCard(playerIndex, player.playerHandIndex, player.hand.getCards()[i].getImagePath());
+                dealCard(playerIndex, player.playerHandIndex, CardImages::imagePath(player.hand.getCards()[i]));
                 firstLoop = false;
                 continue;
             }
             // Delay dealing additional cards for animation effect
             timer->scheduleSingleShot(600, [=]()
-                                      { dealCard(playerIndex, player.playerHandIndex, player.hand.getCards()[i].getImagePath()); });
+                                      { dealCard(playerIndex, player.playerHandIndex, CardImages::imagePath(player.hand.getCards()[i])); }, timerScope);
         }
     }
 
@@ -1015,7 +1013,7 @@ void Screens::playerUpdated(int playerIndex, const Player &player, int)
     players[playerIndex].status = player.status;
 }
 
-void Screens::allPlayersUpdated(const std::vector<Player> &players)
+void Screens::allPlayersUpdated(const RoundSnapshot &players)
 {
     toggleEnabledGamePlayButtons(false);
     unsigned int waitTime = 0;
@@ -1033,8 +1031,11 @@ void Screens::allPlayersUpdated(const std::vector<Player> &players)
         for (int i = 0; i < static_cast<int>(tempPlayers.size()); i++)
         {
             tempPlayers[i].hand.addCard(players[i].hand.getCards()[j]);
-            timer->scheduleSingleShot(waitTime, [=]()
-                                      { playerUpdated(i, tempPlayers[i], tempPlayers[i].hand.getTotal()); });
+
+            // Only capture the one player being dealt to, not every player
+            Player dealtPlayer = tempPlayers[i];
+            timer->scheduleSingleShot(waitTime, [this, i, dealtPlayer]()
+                                      { playerUpdated(i, dealtPlayer, dealtPlayer.hand.getTotal()); }, timerScope);
             waitTime += 600;
         }
         waitTime += 600;
@@ -1047,7 +1048,7 @@ void Screens::allPlayersUpdated(const std::vector<Player> &players)
         {
             toggleEnabledGamePlayButtons(true);
         }
-        emit dealAnimationComplete(); });
+        emit dealAnimationComplete(); }, timerScope);
 
     if (mode == GAMEPLAYMODE::BLACKJACKPRACTICE && players[userIndex].hand.getCards().size() >= 2)
     {
@@ -1075,12 +1076,6 @@ void Screens::dealerUpdated(const Hand &hand, int)
     int prevHandSize = dealerHand.getCards().size();
     dealerHand = hand;
 
-    // If middle of round, change first card to show back of card
-    if (!showDealerCard && dealerHand.getCards().size() > 0)
-    {
-        dealerHand.setCardImagePath(0, ":/cardImages/cards_pngsource/back_of_card.png");
-    }
-
     unsigned int waitTime = 600 * players.size();
 
     // If dealer card flipped, get the correct card image
@@ -1088,7 +1083,7 @@ void Screens::dealerUpdated(const Hand &hand, int)
     {
         waitTime = 600;
 
-        QString imagePath = dealerHand.getCards().at(0).getImagePath();
+        QString imagePath = CardImages::imagePath(dealerHand.getCards().at(0));
         tableView->revealDealerCard(imagePath);
     }
 
@@ -1096,7 +1091,7 @@ void Screens::dealerUpdated(const Hand &hand, int)
     for (int i = prevHandSize; i < static_cast<int>(dealerHand.getCards().size()); i++)
     {
         timer->scheduleSingleShot(waitTime, [=]()
-                                  { dealCard(-1, 0, dealerHand.getCards()[i].getImagePath()); });
+                                  { dealCard(-1, 0, dealerCardImage(i)); }, timerScope);
         if (!showDealerCard)
         {
             waitTime *= 2;
@@ -1108,17 +1103,26 @@ void Screens::dealerUpdated(const Hand &hand, int)
     if (showDealerCard)
     {
         timer->scheduleSingleShot(waitTime, [=]()
-                                  { emit sendDealerDonePlaying(); });
+                                  { emit sendDealerDonePlaying(); }, timerScope);
     }
 
     // Show the first reccomended move after dealer gets cards
     if (dealerHand.getCards().size() == 2 && mode == GAMEPLAYMODE::BLACKJACKPRACTICE)
     {
         timer->scheduleSingleShot(waitTime / 1.5, [=]()
-                                  { updateRecommendedMove(players[userIndex].hand); });
+                                  { updateRecommendedMove(players[userIndex].hand); }, timerScope);
     }
 }
 
+QString Screens::dealerCardImage(int index)
+{
+    // If middle of round, the first card shows the back of card
+    if (index == 0 && !showDealerCard)
+        return CardImages::backOfCard();
+
+    return CardImages::imagePath(dealerHand.getCards()[index]);
+}
+
 void Screens::updateShowDealerCardBool(bool flipped)
 {
     showDealerCard = flipped;
@@ -1143,7 +1147,7 @@ void Screens::onSplitPlayers(int originalIndex, const Player &originalPlayer, co
 
     // Updates new player hand
     timer->scheduleSingleShot(600 * 2, [=]()
-                              { playerUpdated(originalIndex + 1, newPlayer, newPlayer.hand.getTotal()); });
+                              { playerUpdated(originalIndex + 1, newPlayer, newPlayer.hand.getTotal()); }, timerScope);
 
     if (mode == GAMEPLAYMODE::BLACKJACKTUTORIAL)
     {
@@ -1220,7 +1224,7 @@ void Screens::toggleEnabledQPushButton(QPushButton *button, bool enabled)
     button->setEnabled(enabled);
 }
 
-void Screens::endRound(const std::vector<Player> &players)
+void Screens::endRound(const RoundSnapshot &players)
 {
     toggleEnabledQPushButton(ui->nextRound, true);
     toggleEnabledGamePlayButtons(false);
@@ -1232,9 +1236,7 @@ void Screens::endRound(const std::vector<Player> &players)
         return;
     }
 
-    std::vector<Player> localPlayers = players;
-
-    for (Player &player : localPlayers)
+    for (const Player &player : players)
     {
         ui->coinAnimView->viewport()->update();
 
@@ -1268,7 +1270,7 @@ void Screens::onPressNextRound()
         m_scene->update();
     }
 
-    timer->cancelAllTimers();
+    timer->cancelScope(timerScope);
     tableView->clearTable();
 
     // Remove split hands
@@ -1299,7 +1301,7 @@ void Screens::onPressNextRound()
     else if (mode == GAMEPLAYMODE::BLACKJACKTUTORIAL || mode == GAMEPLAYMODE::BLACKJACKPRACTICE)
     {
         timer->scheduleSingleShot(2100, [=]()
-                                  { onPressPlacedBetButton(); });
+                                  { onPressPlacedBetButton(); }, timerScope);
         ui->practiceBestMoveLabel->setText("Best move is: \n");
     }
 }
@@ -1328,7 +1330,7 @@ void Screens::resetEverything()
         m_scene->clear();
     }
     tableView->stopEverything();
-    timer->cancelAllTimers();
+    timer->cancelScope(timerScope);
     players.clear();
     ui->practiceBestMoveLabel->setText("Best move is: \n");
 }
@@ -3,10 +3,12 @@
 
 #include "box2dbase.h"
 #include "player.h"
+#include "roundsnapshot.h"
 #include "tableview.h"
 #include "ui_mainwindow.h"
 #include "hand.h"
 #include "playerStatus.h"
+#include "shoeorder.h"
 #include <QWidget>
 #include <QGraphicsView>
 #include <QtWidgets/qstackedwidget.h>
@@ -16,6 +18,7 @@
 #include "tutorialpopup.h"
 
 using PlayerStatus::PLAYERSTATUS;
+using ShoeOrder::SHOEORDER;
 
 /**
  * @brief The Screens class handles all main screens of the program (main menu, playing blackjack, practice blackjack, and strategy screens)
@@ -32,9 +35,10 @@ public:
      * @brief Screens Constructor for all the UI visuals
      * @param ui The ui to adjust ui elements on
      * @param m_scene A box2D for winning animations
+     * @param timer The timer the table runs on, shared with the controller so the screens keep in step with it
      * @param parent The parent of this object
      */
-    explicit Screens(Ui::MainWindow *ui, box2Dbase *m_scene, QWidget *parent = nullptr);
+    explicit Screens(Ui::MainWindow *ui, box2Dbase *m_scene, TimerManager *timer, QWidget *parent = nullptr);
 
     /**
      * @brief ~Screens Deconstructor for the Screens class
@@ -53,10 +57,15 @@ private:
     TableView *tableView;
 
     /**
-     * @brief timer An instance of TimerManager to wrap singleshot timers
+     * @brief timer The TimerManager shared with the controller to wrap singleshot timers
      */
     TimerManager *timer;
 
+    /**
+     * @brief timerScope The scope of the screens' own timers, so stopping them leaves the controller's alone
+     */
+    int timerScope;
+
     /**
      * @brief m_scene An instance of Box2D for winning animations
      */
@@ -371,6 +380,13 @@ private:
      */
     int indexToSeat(unsigned int playerIndex);
 
+    /**
+     * @brief dealerCardImage Gets the image to show for one of the dealer's cards, the first card is face down until it is flipped
+     * @param index The index of the card in the dealer's hand
+     * @return The image path of the card
+     */
+    QString dealerCardImage(int index);
+
     /**
      * @brief updateRecommendedMove Updates the reccomended move in practice mode
      * @param playerHand The players hand to use to get the recommended move
@@ -383,9 +399,9 @@ signals:
      * @brief sendSettingsAccepted Singal to send for when the suer has accepted the settings
      * @param players The number of players in the game
      * @param decks The number of decks to play with
-     * @param deterministic 0 = random shuffle, 1 = shuffle for single player, 2 = shuffle for 3 players
+     * @param order How the deck orders its cards, the tutorial deals a set order
      */
-    void sendSettingsAccepted(std::vector<Player> &players, int decks, int deterministic);
+    void sendSettingsAccepted(std::vector<Player> &players, int decks, SHOEORDER order);
 
     /**
      * @brief sendGameSetupCompleteStartBetting
@@ -471,9 +487,9 @@ public slots:
 
     /**
      * @brief allPlayersUpdated Slot for receiving all of the updated players to display
-     * @param players The vector containing all of the players
+     * @param players The snapshot containing all of the players
      */
-    void allPlayersUpdated(const std::vector<Player> &players);
+    void allPlayersUpdated(const RoundSnapshot &players);
 
     /**
      * @brief dealerUpdated Slot for receiving updated dealer info
@@ -500,7 +516,7 @@ public slots:
      * @brief endRound SLot for the round ending
      * @param players The players after the round has ended
      */
-    void endRound(const std::vector<Player> &players);
+    void endRound(const RoundSnapshot &players);
 
     /**
      * @brief updateShowDealerCardBool Updates the bool for when to flip the dealers secret card
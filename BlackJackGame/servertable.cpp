@@ -0,0 +1,324 @@
+/**
+ * @brief Implementation of The ServerTable class. It is one table of a TableServer, playing the turn order Controller follows on actions posted to its mailbox
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/11/2025
+ */
+
+#include "servertable.h"
+#include "bettingpolicy.h"
+#include "botstrategy.h"
+#include <chrono>
+
+using PlayerStatus::PLAYERSTATUS;
+
+/**
+ * @brief botBetting How the bots bet, a tenth of their money like Controller's bots
+ */
+static const BettingPolicy botBetting = BettingPolicy::proportional(10);
+
+/**
+ * @brief now Gets the steady clock in nanoseconds, the clock actions are stamped with
+ * @return The time
+ */
+static int64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+TableAction TableAction::placeBet(int seat, int amount)
+{
+    TableAction action;
+    action.seat = seat;
+    action.isBet = true;
+    action.bet = amount;
+    return action;
+}
+
+TableAction TableAction::play(int seat, int hand, MOVE move)
+{
+    TableAction action;
+    action.seat = seat;
+    action.hand = hand;
+    action.move = move;
+    return action;
+}
+
+void TableStats::merge(const TableStats &other)
+{
+    actions += other.actions;
+    rejected += other.rejected;
+    rounds += other.rounds;
+    latency.merge(other.latency);
+}
+
+ServerTable::ServerTable(int id, std::vector<Player> players, const TableRules &rules, uint64_t seed, long long roundLimit)
+    : id(id), model(std::move(players), rules, SHOEORDER::RANDOM, Rng(seed)), rules(rules), roundLimit(roundLimit), rounds(0), phase(PHASE::STARTING), current(-1),
+      hasUsers(false), scheduled(true), closed(false), abandoned(false)
+{
+    const PlayerTable &table = model.getPlayerTable();
+    for (int seat = 0; seat < table.getSeatCount(); seat++)
+        hasUsers = hasUsers || table.isUser(seat);
+    mailbox.reserve(mailboxCapacity);
+}
+
+bool ServerTable::post(const TableAction &action, bool &accepted)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    accepted = !closed && mailbox.size() < mailboxCapacity;
+    if (!accepted)
+        return false;
+
+    mailbox.push_back(action);
+    if (scheduled)
+        return false;
+    scheduled = true;
+    return true;
+}
+
+bool ServerTable::run(const std::function<void(const TableEvent &event)> &send, TableStats &stats, bool &released)
+{
+    released = false;
+    {
+        // A table closed while it waited to run has nothing more to send
+        std::lock_guard<std::mutex> guard(lock);
+        if (closed)
+        {
+            scheduled = false;
+            released = abandoned;
+            return false;
+        }
+    }
+
+    if (phase == PHASE::STARTING)
+        startRound(send, stats);
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        draining.swap(mailbox);
+    }
+
+    int64_t handledAt = now();
+    for (const TableAction &action : draining)
+    {
+        stats.actions++;
+        stats.latency.add((handledAt - action.sentAt) / 1000);
+        handle(action, send, stats);
+    }
+    draining.clear();
+
+    // A table of bots plays one round a run, so it takes turns on the workers with the tables waiting on users
+    std::lock_guard<std::mutex> guard(lock);
+    if (phase == PHASE::CLOSED)
+        closed = true;
+    if (!closed && (!mailbox.empty() || phase == PHASE::STARTING))
+        return true;
+    scheduled = false;
+    released = abandoned;
+    return false;
+}
+
+bool ServerTable::close()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    if (abandoned)
+        return false;
+    abandoned = true;
+    closed = true;
+
+    // A table that is queued or running is released by that run instead
+    return !scheduled;
+}
+
+bool ServerTable::isClosed() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return closed;
+}
+
+void ServerTable::handle(const TableAction &action, const std::function<void(const TableEvent &event)> &send, TableStats &stats)
+{
+    const PlayerTable &table = model.getPlayerTable();
+    bool userSeat = action.seat >= 0 && action.seat < table.getSeatCount() && table.isUser(action.seat);
+
+    if (userSeat && action.isBet && phase == PHASE::BETTING && action.seat == current && action.bet > 0 && action.bet <= table.money(current))
+    {
+        model.setPlayerBet(current, action.bet);
+        advanceBet(send, stats);
+        return;
+    }
+
+    if (userSeat && !action.isBet && phase == PHASE::PLAYING && action.hand == current && table.seat(current) == action.seat)
+    {
+        HandOptions options = model.getOptions(current);
+        bool allowed = (action.move != MOVE::DOUBLE || options.canDouble) && (action.move != MOVE::SPLIT || options.canSplit) && (action.move != MOVE::SURRENDER || options.canSurrender);
+        if (allowed)
+        {
+            play(current, action.move);
+            if (table.status(current) == PLAYERSTATUS::ACTIVE)
+                sendTurn(send);
+            else
+                advancePlayer(send, stats);
+            return;
+        }
+    }
+
+    // Out of turn, a bet the seat can't cover, or a move the hand can't make
+    stats.rejected++;
+    if (!userSeat)
+        return;
+    send(event(TABLEEVENT::REJECTED, action.seat));
+
+    // The table is still waiting on the seat if it was its turn, so it is asked again
+    if (phase == PHASE::BETTING && action.seat == current)
+        send(event(TABLEEVENT::BET, current));
+    else if (phase == PHASE::PLAYING && current < model.getPlayerCount() && table.seat(current) == action.seat)
+        sendTurn(send);
+}
+
+void ServerTable::startRound(const std::function<void(const TableEvent &event)> &send, TableStats &stats)
+{
+    model.clearHands();
+    phase = PHASE::BETTING;
+    current = -1;
+    advanceBet(send, stats);
+}
+
+void ServerTable::advanceBet(const std::function<void(const TableEvent &event)> &send, TableStats &stats)
+{
+    const PlayerTable &table = model.getPlayerTable();
+    while (true)
+    {
+        // Skip all bankrupt seats
+        current++;
+        while (current < table.getSeatCount() && table.status(current) == PLAYERSTATUS::BANKRUPT)
+            current++;
+
+        // Everyone has bet
+        if (current == table.getSeatCount())
+        {
+            model.dealInitialCards();
+            phase = PHASE::PLAYING;
+            current = -1;
+            advancePlayer(send, stats);
+            return;
+        }
+
+        if (table.isUser(current))
+        {
+            send(event(TABLEEVENT::BET, current));
+            return;
+        }
+        model.setPlayerBet(current, botBetting.getBet(table.money(current)));
+    }
+}
+
+void ServerTable::advancePlayer(const std::function<void(const TableEvent &event)> &send, TableStats &stats)
+{
+    const PlayerTable &table = model.getPlayerTable();
+    while (true)
+    {
+        // Get to the next hand that is able to play, the count grows as hands are split
+        current++;
+        while (current < model.getPlayerCount() && (table.status(current) == PLAYERSTATUS::BANKRUPT || table.status(current) == PLAYERSTATUS::STAND))
+            current++;
+
+        // All hands have gone, or the dealer's 21 ends the round before anyone plays
+        if (current >= model.getPlayerCount() || model.getDealerHand().getTotal() == 21)
+        {
+            finishRound(send, stats);
+            return;
+        }
+
+        model.setPlayerActive(current);
+        if (table.isUser(table.seat(current)))
+        {
+            sendTurn(send);
+            return;
+        }
+        playBot(current);
+    }
+}
+
+void ServerTable::finishRound(const std::function<void(const TableEvent &event)> &send, TableStats &stats)
+{
+    const PlayerTable &table = model.getPlayerTable();
+    bool anyStood = false;
+    for (int i = 0; i < model.getPlayerCount(); i++)
+        anyStood = anyStood || table.status(i) == PLAYERSTATUS::STAND;
+    if (anyStood)
+        model.dealerPlay();
+    model.endRound();
+    rounds++;
+    stats.rounds++;
+
+    // The table plays on while a seat it waits for still has money
+    bool playing = false;
+    for (int seat = 0; seat < table.getSeatCount(); seat++)
+    {
+        if (table.isUser(seat))
+            send(event(TABLEEVENT::ROUND_OVER, seat));
+        if (table.status(seat) != PLAYERSTATUS::BANKRUPT && (table.isUser(seat) || !hasUsers))
+            playing = true;
+    }
+
+    if (!playing || (roundLimit > 0 && rounds >= roundLimit))
+    {
+        phase = PHASE::CLOSED;
+        for (int seat = 0; seat < table.getSeatCount(); seat++)
+            if (table.isUser(seat))
+                send(event(TABLEEVENT::CLOSED, seat));
+        return;
+    }
+
+    if (hasUsers)
+        startRound(send, stats);
+    else
+        phase = PHASE::STARTING;
+}
+
+void ServerTable::playBot(int index)
+{
+    const PlayerTable &table = model.getPlayerTable();
+    const Card upCard = model.getDealerHand().getCards()[1];
+    while (table.status(index) == PLAYERSTATUS::ACTIVE)
+        play(index, BotStrategy::getNextMove(table.hand(index), upCard, rules, model.getOptions(index)));
+}
+
+void ServerTable::play(int index, MOVE move)
+{
+    HandOptions options = model.getOptions(index);
+    if (move == MOVE::STAND)
+        model.stand(index);
+    else if (move == MOVE::SURRENDER && options.canSurrender)
+        model.surrender(index);
+    else if (move == MOVE::DOUBLE && options.canDouble)
+        model.doubleDown(index);
+    // Splitting keeps this hand active and inserts the second hand right after it
+    else if (move == MOVE::SPLIT && options.canSplit)
+        model.split(index);
+    else
+        model.hit(index);
+}
+
+void ServerTable::sendTurn(const std::function<void(const TableEvent &event)> &send) const
+{
+    const PlayerTable &table = model.getPlayerTable();
+    TableEvent turn = event(TABLEEVENT::TURN, table.seat(current));
+    turn.hand = current;
+    turn.cards = table.hand(current);
+    turn.upCard = model.getDealerHand().getCards()[1];
+    turn.options = model.getOptions(current);
+    send(turn);
+}
+
+TableEvent ServerTable::event(TABLEEVENT type, int seat) const
+{
+    TableEvent sent;
+    sent.table = id;
+    sent.type = type;
+    sent.seat = seat;
+    sent.round = rounds;
+    sent.money = model.getPlayerTable().money(seat);
+    return sent;
+}
@@ -0,0 +1,410 @@
+#ifndef SERVERTABLE_H
+#define SERVERTABLE_H
+
+#include "gamestate.h"
+#include "quantilesketch.h"
+#include "statistics.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace TableEventType
+{
+
+    /**
+     * @brief The TABLEEVENT enum What a table tells the seats playing at it
+     *
+     * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+     * @date 5/11/2025
+     */
+    enum class TABLEEVENT
+    {
+        BET,
+        TURN,
+        REJECTED,
+        ROUND_OVER,
+        CLOSED
+    };
+
+    /**
+     * @brief toString Converts a TABLEEVENT to a string
+     * @param event The TABLEEVENT to convert
+     * @return A string of the TABLEEVENT provided
+     */
+    inline std::string toString(TABLEEVENT event)
+    {
+        switch (event)
+        {
+        case TABLEEVENT::BET:
+            return "Bet";
+        case TABLEEVENT::TURN:
+            return "Turn";
+        case TABLEEVENT::REJECTED:
+            return "Rejected";
+        case TABLEEVENT::ROUND_OVER:
+            return "Round over";
+        case TABLEEVENT::CLOSED:
+            return "Closed";
+        default:
+            return "Unknown";
+        }
+    }
+
+    /**
+     * @brief allTableEvents An array of all TABLEEVENT values for iteration
+     */
+    static constexpr std::array<TABLEEVENT, 5> allTableEvents = {TABLEEVENT::BET, TABLEEVENT::TURN, TABLEEVENT::REJECTED, TABLEEVENT::ROUND_OVER, TABLEEVENT::CLOSED};
+}
+
+using TableEventType::TABLEEVENT;
+
+/**
+ * @brief The TableAction struct is a bet or a move sent to a table by the seat making it
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/11/2025
+ */
+struct TableAction
+{
+    /**
+     * @brief seat The seat acting, which must own the hand
+     */
+    int seat = 0;
+
+    /**
+     * @brief hand The hand moved in play order, unused for a bet
+     */
+    int hand = 0;
+
+    /**
+     * @brief isBet True for a bet, false for a move
+     */
+    bool isBet = false;
+
+    /**
+     * @brief bet The amount bet
+     */
+    int bet = 0;
+
+    /**
+     * @brief move The move made
+     */
+    MOVE move = MOVE::STAND;
+
+    /**
+     * @brief sentAt When the action was submitted, in steady clock nanoseconds, for measuring how long it waited
+     */
+    int64_t sentAt = 0;
+
+    /**
+     * @brief placeBet Gets the action of a seat betting
+     * @param seat The seat
+     * @param amount The bet
+     * @return The action
+     */
+    static TableAction placeBet(int seat, int amount);
+
+    /**
+     * @brief play Gets the action of a seat making a move
+     * @param seat The seat
+     * @param hand The hand in play order
+     * @param move The move
+     * @return The action
+     */
+    static TableAction play(int seat, int hand, MOVE move);
+};
+
+/**
+ * @brief The TableEvent struct is sent to a seat when it has to act or something happened to it
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/11/2025
+ */
+struct TableEvent
+{
+    /**
+     * @brief table The table's id
+     */
+    int table = 0;
+
+    /**
+     * @brief type What happened
+     */
+    TABLEEVENT type = TABLEEVENT::BET;
+
+    /**
+     * @brief seat The seat told
+     */
+    int seat = 0;
+
+    /**
+     * @brief hand The hand to move in play order, for TURN
+     */
+    int hand = 0;
+
+    /**
+     * @brief round The number of rounds the table had finished when the event was sent
+     */
+    long long round = 0;
+
+    /**
+     * @brief money The seat's money
+     */
+    int money = 0;
+
+    /**
+     * @brief cards The cards of the hand to move, for TURN
+     */
+    Hand cards;
+
+    /**
+     * @brief upCard The dealer's face up card, for TURN
+     */
+    Card upCard;
+
+    /**
+     * @brief options The moves the hand may make besides hitting and standing, for TURN
+     */
+    HandOptions options;
+};
+
+/**
+ * @brief The TableStats struct counts the work a table server has done
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/11/2025
+ */
+struct TableStats
+{
+    /**
+     * @brief actions The actions handled, bets and moves
+     */
+    long long actions = 0;
+
+    /**
+     * @brief rejected The actions dropped because it wasn't the seat's turn or the move wasn't allowed
+     */
+    long long rejected = 0;
+
+    /**
+     * @brief rounds The rounds finished across every table
+     */
+    long long rounds = 0;
+
+    /**
+     * @brief latency The microseconds from an action being submitted to its table handling it
+     */
+    QuantileSketch latency;
+
+    /**
+     * @brief merge Adds another count to this one
+     * @param other The count to add
+     */
+    void merge(const TableStats &other);
+};
+
+/**
+ * @brief The ServerTable class is one table of a TableServer: a GameState, the seats' mailbox, and the turn order Controller follows, without Qt.
+ * Actions are posted to the mailbox from any thread and handled one at a time by whichever worker runs the table, so a table's game is never touched by two threads at once.
+ * Bot seats bet and play as soon as it is their turn like Controller's bots, only without the delay, and user seats are sent an event and waited on
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/11/2025
+ */
+class ServerTable
+{
+public:
+    /**
+     * @brief mailboxCapacity The most actions waiting at a table before more are refused
+     */
+    static constexpr std::size_t mailboxCapacity = 64;
+
+    /**
+     * @brief ServerTable Constructor that seats the players. The first round starts the first time the table runs
+     * @param id The table's id, sent with its events
+     * @param players The players, one per seat, users are sent events and bots play themselves
+     * @param rules The house rules of the table
+     * @param seed The seed the shoe is dealt from
+     * @param roundLimit The rounds to play before closing, 0 for no limit
+     */
+    ServerTable(int id, std::vector<Player> players, const TableRules &rules, uint64_t seed, long long roundLimit);
+
+    /**
+     * @brief post Adds an action to the mailbox. Safe to call from any thread
+     * @param action The action
+     * @param accepted Set to false if the mailbox was full or the table has closed
+     * @return True if the table was idle and has to be scheduled to run
+     */
+    bool post(const TableAction &action, bool &accepted);
+
+    /**
+     * @brief run Starts the first round if it hasn't, then handles every action in the mailbox. Only one thread may run a table at a time
+     * @param send Called with each event for the seats
+     * @param stats Counts the actions handled and the rounds finished
+     * @param released Set to true if the table was closed by close and this was its last run, so nothing will touch it again
+     * @return True if the table has more to do and has to be scheduled again
+     */
+    bool run(const std::function<void(const TableEvent &event)> &send, TableStats &stats, bool &released);
+
+    /**
+     * @brief close Closes the table before it is done, refusing any more actions. Safe to call from any thread
+     * @return True if the table was idle, so nothing will touch it again. Otherwise its last run reports it released
+     */
+    bool close();
+
+    /**
+     * @brief isClosed Checks if the table has played its rounds, every user has gone bankrupt or it was closed
+     * @return True once the table is closed
+     */
+    bool isClosed() const;
+
+private:
+    /**
+     * @brief The PHASE enum Where the table is in a round
+     */
+    enum class PHASE
+    {
+        STARTING,
+        BETTING,
+        PLAYING,
+        CLOSED
+    };
+
+    /**
+     * @brief id The table's id
+     */
+    int id;
+
+    /**
+     * @brief model The game at the table
+     */
+    GameState model;
+
+    /**
+     * @brief rules The house rules of the table, for the bots
+     */
+    TableRules rules;
+
+    /**
+     * @brief roundLimit The rounds to play before closing, 0 for no limit
+     */
+    long long roundLimit;
+
+    /**
+     * @brief rounds The rounds finished
+     */
+    long long rounds;
+
+    /**
+     * @brief phase Where the table is in a round, only read and written by the thread running the table
+     */
+    PHASE phase;
+
+    /**
+     * @brief current The seat betting or the hand playing
+     */
+    int current;
+
+    /**
+     * @brief hasUsers True if any seat is played by a user, otherwise the table plays its bots until the round limit
+     */
+    bool hasUsers;
+
+    /**
+     * @brief lock Held to post to or drain the mailbox
+     */
+    mutable std::mutex lock;
+
+    /**
+     * @brief mailbox The actions waiting
+     */
+    std::vector<TableAction> mailbox;
+
+    /**
+     * @brief draining The actions being handled, swapped with the mailbox so posting doesn't wait on a whole batch
+     */
+    std::vector<TableAction> draining;
+
+    /**
+     * @brief scheduled True while the table is queued or running, so it is only ever scheduled once
+     */
+    bool scheduled;
+
+    /**
+     * @brief closed True once the table has closed, read by posting threads
+     */
+    bool closed;
+
+    /**
+     * @brief abandoned True once close has been called, so it is only released once
+     */
+    bool abandoned;
+
+    /**
+     * @brief handle Plays an action if it is the seat's turn and the move is allowed
+     * @param action The action
+     * @param send Called with each event for the seats
+     * @param stats Counts the rounds finished and rejected actions
+     */
+    void handle(const TableAction &action, const std::function<void(const TableEvent &event)> &send, TableStats &stats);
+
+    /**
+     * @brief startRound Clears the hands and opens betting
+     * @param send Called with each event for the seats
+     * @param stats Counts the rounds finished
+     */
+    void startRound(const std::function<void(const TableEvent &event)> &send, TableStats &stats);
+
+    /**
+     * @brief advanceBet Moves betting to the next seat with money, betting for bots, and deals once every seat has bet
+     * @param send Called with each event for the seats
+     * @param stats Counts the rounds finished
+     */
+    void advanceBet(const std::function<void(const TableEvent &event)> &send, TableStats &stats);
+
+    /**
+     * @brief advancePlayer Moves play to the next hand that can act, playing bots' hands, and finishes the round after the last one
+     * @param send Called with each event for the seats
+     * @param stats Counts the rounds finished
+     */
+    void advancePlayer(const std::function<void(const TableEvent &event)> &send, TableStats &stats);
+
+    /**
+     * @brief finishRound Has the dealer play if any hand stood, settles the bets and starts the next round or closes the table
+     * @param send Called with each event for the seats
+     * @param stats Counts the rounds finished
+     */
+    void finishRound(const std::function<void(const TableEvent &event)> &send, TableStats &stats);
+
+    /**
+     * @brief playBot Plays a bot's hand until it stands or busts, splits keep it active
+     * @param index The hand in play order
+     */
+    void playBot(int index);
+
+    /**
+     * @brief play Makes a move on a hand, hitting when the move isn't allowed like Controller's bots
+     * @param index The hand in play order
+     * @param move The move
+     */
+    void play(int index, MOVE move);
+
+    /**
+     * @brief sendTurn Tells a user it is their hand's turn
+     * @param send Called with the event
+     */
+    void sendTurn(const std::function<void(const TableEvent &event)> &send) const;
+
+    /**
+     * @brief event Gets an event for a seat with its money and the table's round filled in
+     * @param type What happened
+     * @param seat The seat told
+     * @return The event
+     */
+    TableEvent event(TABLEEVENT type, int seat) const;
+};
+
+#endif // SERVERTABLE_H
@@ -0,0 +1,34 @@
+/**
+ * @brief Implementation of The ShoeComposition class. It counts how many cards of each blackjack value are left in a shoe
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/26/2025
+ */
+
+#include "shoecomposition.h"
+
+ShoeComposition::ShoeComposition()
+{
+    clear();
+}
+
+ShoeComposition::ShoeComposition(int deckCount)
+{
+    clear();
+
+    // Four of each value per deck, sixteen tens
+    for (int i = 0; i < valueCount; i++)
+    {
+        int cards = deckCount * (i == tenIndex ? 16 : 4);
+        for (int j = 0; j < cards; j++)
+            add(i);
+    }
+}
+
+void ShoeComposition::clear()
+{
+    for (uint8_t &count : counts)
+        count = 0;
+    total = 0;
+    key = 0;
+}
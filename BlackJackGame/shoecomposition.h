@@ -0,0 +1,151 @@
+#ifndef SHOECOMPOSITION_H
+#define SHOECOMPOSITION_H
+
+#include "card.h"
+#include <cstdint>
+
+/**
+ * @brief The ShoeComposition class counts how many cards of each blackjack value are left in a shoe.
+ * Values are indexed like the strategy tables: 0 - 7 for two through nine, 8 for any ten value card and 9 for aces.
+ * The counts are also packed into a single 64 bit key that is updated in O(1) as cards are added and removed, for use in caches.
+ * Shoes of up to 15 decks fit in the key
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/26/2025
+ */
+class ShoeComposition
+{
+public:
+    /**
+     * @brief valueCount The number of distinct blackjack values
+     */
+    static constexpr int valueCount = 10;
+
+    /**
+     * @brief tenIndex The index of the ten value cards
+     */
+    static constexpr int tenIndex = 8;
+
+    /**
+     * @brief aceIndex The index of the aces
+     */
+    static constexpr int aceIndex = 9;
+
+    /**
+     * @brief maxDecks The most decks whose counts fit in the key
+     */
+    static constexpr int maxDecks = 15;
+
+    /**
+     * @brief ShoeComposition Constructor that creates an empty shoe
+     */
+    ShoeComposition();
+
+    /**
+     * @brief ShoeComposition Constructor that creates a full shoe
+     * @param deckCount The number of 52 card decks in the shoe
+     */
+    explicit ShoeComposition(int deckCount);
+
+    /**
+     * @brief indexOf Gets the value index of a card
+     * @param card The card to get the index of
+     * @return The index from 0 (two) to 9 (ace)
+     */
+    static int indexOf(const Card &card)
+    {
+        static constexpr int8_t indices[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 8, 8, 9};
+        return indices[static_cast<int>(card.getRank())];
+    }
+
+    /**
+     * @brief hardValue Gets the blackjack value of an index with aces counted as 1
+     * @param index The value index
+     * @return The value from 1 to 10
+     */
+    static int hardValue(int index)
+    {
+        return index == aceIndex ? 1 : index + 2;
+    }
+
+    /**
+     * @brief getCount Gets the number of cards left of a value
+     * @param index The value index
+     * @return The number of cards of that value
+     */
+    int getCount(int index) const { return counts[index]; }
+
+    /**
+     * @brief getTotal Gets the number of cards left in the shoe
+     * @return The total number of cards
+     */
+    int getTotal() const { return total; }
+
+    /**
+     * @brief getKey Gets the packed counts, equal keys mean equal compositions
+     * @return The 64 bit key of the composition
+     */
+    uint64_t getKey() const { return key; }
+
+    /**
+     * @brief add Adds a card of the given value to the shoe
+     * @param index The value index
+     */
+    void add(int index)
+    {
+        counts[index]++;
+        total++;
+        key += uint64_t(1) << shifts[index];
+    }
+
+    /**
+     * @brief remove Removes a card of the given value from the shoe
+     * @param index The value index, there must be at least one card of it left
+     */
+    void remove(int index)
+    {
+        counts[index]--;
+        total--;
+        key -= uint64_t(1) << shifts[index];
+    }
+
+    /**
+     * @brief addCard Adds a card to the shoe
+     * @param card The card to add
+     */
+    void addCard(const Card &card) { add(indexOf(card)); }
+
+    /**
+     * @brief removeCard Removes a card from the shoe
+     * @param card The card to remove
+     */
+    void removeCard(const Card &card) { remove(indexOf(card)); }
+
+    /**
+     * @brief clear Removes every card from the shoe
+     */
+    void clear();
+
+private:
+    /**
+     * @brief shifts The bit offset of each count in the key. Two through nine and aces get 6 bits, tens get 8
+     */
+    static constexpr int shifts[valueCount] = {0, 6, 12, 18, 24, 30, 36, 42, 48, 56};
+
+    /**
+     * @brief counts The number of cards left of each value
+     */
+    uint8_t counts[valueCount];
+
+    /**
+     * @brief total The number of cards left in the shoe
+     */
+    int total;
+
+    /**
+     * @brief key The counts packed into 64 bits
+     */
+    uint64_t key;
+};
+
+#endif // SHOECOMPOSITION_H
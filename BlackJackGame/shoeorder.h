@@ -0,0 +1,63 @@
+#ifndef SHOEORDER_H
+#define SHOEORDER_H
+
+#include <string>
+#include <ostream>
+
+namespace ShoeOrder
+{
+
+    /**
+     * @brief The SHOEORDER enum How a deck orders its cards when it shuffles
+     *
+     * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+     * @date 5/8/2025
+     */
+    enum class SHOEORDER
+    {
+        RANDOM,
+        TUTORIAL,
+        TWOS
+    };
+
+    /**
+     * @brief toString Converts a SHOEORDER to a string
+     * @param order The SHOEORDER to convert
+     * @return A string of the SHOEORDER provided
+     */
+    inline std::string toString(SHOEORDER order)
+    {
+        switch (order)
+        {
+        case SHOEORDER::RANDOM:
+            return "Random";
+        case SHOEORDER::TUTORIAL:
+            return "Tutorial";
+        case SHOEORDER::TWOS:
+            return "All Twos";
+        }
+
+        return "Unknown shoe order";
+    }
+
+    /**
+     * @brief operator << Prints out the string of the SHOEORDER when used with the ostream operator
+     * @param os The stream to add the string to
+     * @param order The SHOEORDER to convert
+     * @return The ostream with the SHOEORDER as a string
+     */
+    inline std::ostream &operator<<(std::ostream &os, SHOEORDER order)
+    {
+        return os << toString(order);
+    }
+
+    /**
+     * @brief allShoeOrders An array of all the SHOEORDER values
+     */
+    inline constexpr SHOEORDER allShoeOrders[] = {
+        SHOEORDER::RANDOM,
+        SHOEORDER::TUTORIAL,
+        SHOEORDER::TWOS};
+
+}
+#endif // SHOEORDER_H
@@ -0,0 +1,90 @@
+/**
+ * @brief Implementation of The ShoePool class. It shuffles shoes ahead of time on a background thread so a Deck can swap in a ready shoe at the cut card
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/4/2025
+ */
+
+#include "shoepool.h"
+
+ShoePool::ShoePool(const std::vector<Card> &shoe, Rng rng, const ShuffleModel &model)
+    : current(shoe), rng(rng), model(model), stopping(false), waits(0)
+{
+    worker = std::thread(&ShoePool::run, this);
+}
+
+ShoePool::~ShoePool()
+{
+    stop();
+}
+
+void ShoePool::run()
+{
+    ShuffledShoe shoe;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            wake.wait(guard, [this]()
+                      { return stopping.load() || !ready.full(); });
+        }
+        if (stopping.load())
+            return;
+
+        // Shuffle on from the last shoe, the same as Deck::shuffle does
+        shoe.seed = rng();
+        ShuffleKernel::shuffleFromSeed(current, shoe.seed, model);
+
+        // Reuse a dealt shoe's memory when the deck has given one back
+        if (!spent.tryPop(shoe.cards))
+            shoe.cards.clear();
+        shoe.cards.assign(current.begin(), current.end());
+
+        ready.tryPush(shoe);
+        notify();
+    }
+}
+
+uint64_t ShoePool::swap(std::vector<Card> &shoe)
+{
+    ShuffledShoe next;
+    if (!ready.tryPop(next))
+    {
+        waits++;
+        std::unique_lock<std::mutex> guard(lock);
+        wake.wait(guard, [this, &next]()
+                  { return ready.tryPop(next); });
+    }
+
+    // If the background thread hasn't taken back the old ones yet, this shoe's memory is just freed
+    spent.tryPush(shoe);
+    shoe.swap(next.cards);
+
+    if (ready.size() <= refillLevel)
+        notify();
+    return next.seed;
+}
+
+Rng ShoePool::stop()
+{
+    if (worker.joinable())
+    {
+        stopping.store(true);
+        notify();
+        worker.join();
+    }
+    return rng;
+}
+
+long long ShoePool::getWaitCount() const
+{
+    return waits;
+}
+
+void ShoePool::notify()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+    }
+    wake.notify_all();
+}
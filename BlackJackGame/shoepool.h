@@ -0,0 +1,153 @@
+#ifndef SHOEPOOL_H
+#define SHOEPOOL_H
+
+#include "card.h"
+#include "rng.h"
+#include "shufflekernel.h"
+#include "spscring.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief The ShuffledShoe struct is a shoe shuffled by the background thread and the seed it was shuffled with
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/6/2025
+ */
+struct ShuffledShoe
+{
+    /**
+     * @brief cards The cards, top card first
+     */
+    std::vector<Card> cards;
+
+    /**
+     * @brief seed The seed of the generator the shoe was shuffled with
+     */
+    uint64_t seed = 0;
+};
+
+/**
+ * @brief The ShoePool class shuffles shoes ahead of time on a background thread so a Deck can swap in a ready shoe at the cut card
+ * instead of shuffling while a hand is being dealt. Finished shoes go to the deck through one SpscRing and spent shoes come back through
+ * another to be reused, so neither thread allocates or locks once the pool is warm. The lock is only taken to sleep when a ring is full or empty.
+ * Each shoe is the last one shuffled again with a generator seeded from the pool's generator, the same way Deck::shuffle does it,
+ * so a seeded pool deals exactly the shoes the deck would have shuffled itself
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/4/2025
+ */
+class ShoePool
+{
+public:
+    /**
+     * @brief ShoePool Constructor that starts the background thread
+     * @param shoe The last shoe dealt, the first shoe in the pool is a shuffle of it
+     * @param rng The generator the shoes' seeds come from, owned by the background thread until the pool stops
+     * @param model How the shoes are shuffled
+     */
+    ShoePool(const std::vector<Card> &shoe, Rng rng, const ShuffleModel &model);
+
+    /**
+     * @brief ~ShoePool Destructor that stops the background thread
+     */
+    ~ShoePool();
+
+    ShoePool(const ShoePool &) = delete;
+    ShoePool &operator=(const ShoePool &) = delete;
+
+    /**
+     * @brief swap Swaps a spent shoe for the next shuffled one. Only waits if the background thread has fallen behind
+     * @param shoe The spent shoe, replaced with a freshly shuffled one
+     * @return The seed the new shoe was shuffled with
+     */
+    uint64_t swap(std::vector<Card> &shoe);
+
+    /**
+     * @brief stop Stops the background thread. Shoes that were shuffled but not dealt are thrown away
+     * @return The generator, to keep shuffling from where the pool left off
+     */
+    Rng stop();
+
+    /**
+     * @brief getWaitCount Gets the number of swaps that had to wait for a shoe to be shuffled
+     */
+    long long getWaitCount() const;
+
+private:
+    /**
+     * @brief depth The number of shoes kept shuffled ahead
+     */
+    static constexpr std::size_t depth = 4;
+
+    /**
+     * @brief refillLevel The background thread is only woken once this few shoes are left, so it shuffles in bursts rather than once per swap
+     */
+    static constexpr std::size_t refillLevel = depth / 2;
+
+    /**
+     * @brief ready Shuffled shoes waiting to be dealt, from the background thread to the deck
+     */
+    SpscRing<ShuffledShoe, depth> ready;
+
+    /**
+     * @brief spent Dealt shoes to reuse, from the deck to the background thread
+     */
+    SpscRing<std::vector<Card>, depth> spent;
+
+    /**
+     * @brief current The last shoe shuffled, shuffled again for the next one. Only touched by the background thread
+     */
+    std::vector<Card> current;
+
+    /**
+     * @brief rng The generator the shoes' seeds come from. Only touched by the background thread while it runs
+     */
+    Rng rng;
+
+    /**
+     * @brief model How the shoes are shuffled
+     */
+    ShuffleModel model;
+
+    /**
+     * @brief stopping Set to tell the background thread to finish
+     */
+    std::atomic<bool> stopping;
+
+    /**
+     * @brief waits The number of swaps that had to wait for a shoe
+     */
+    long long waits;
+
+    /**
+     * @brief lock Only held to sleep and wake, never while shuffling or dealing
+     */
+    std::mutex lock;
+
+    /**
+     * @brief wake Signalled when a shoe is ready, when the ready shoes run low, or when the pool is stopping
+     */
+    std::condition_variable wake;
+
+    /**
+     * @brief worker The background thread
+     */
+    std::thread worker;
+
+    /**
+     * @brief run The background thread's loop, keeps the ready ring full until stopped
+     */
+    void run();
+
+    /**
+     * @brief notify Wakes the other thread. The lock is taken first so a thread that just found a ring full or empty can't miss the wake up
+     */
+    void notify();
+};
+
+#endif // SHOEPOOL_H
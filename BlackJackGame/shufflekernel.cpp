@@ -0,0 +1,271 @@
+/**
+ * @brief Implementation of The ShuffleKernel class. It shuffles shoes of one byte cards, uniformly with batched bounded random numbers
+ * or following a casino dealer's riffles, strips and boxes
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/5/2025
+ */
+
+#include "shufflekernel.h"
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
+ShuffleModel ShuffleModel::casino(double clumping)
+{
+    ShuffleModel model;
+    model.type = SHUFFLE::CASINO;
+    model.clumping = clumping;
+    return model;
+}
+
+std::string ShuffleModel::describe() const
+{
+    if (type == SHUFFLE::RANDOM)
+        return ShuffleType::toString(type);
+
+    std::ostringstream description;
+    description << ShuffleType::toString(type) << ": "
+                << riffles << (riffles == 1 ? " riffle, " : " riffles, ")
+                << strips << (strips == 1 ? " strip, " : " strips, ")
+                << boxes << (boxes == 1 ? " box, " : " boxes, ")
+                << "clumping " << clumping;
+    return description.str();
+}
+
+uint64_t ShuffleKernel::multiply(uint64_t a, uint64_t b, uint64_t &low)
+{
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    low = static_cast<uint64_t>(product);
+    return static_cast<uint64_t>(product >> 64);
+#else
+    // Schoolbook multiply on 32 bit halves for compilers without a 128 bit type
+    uint64_t aLow = a & 0xFFFFFFFF, aHigh = a >> 32;
+    uint64_t bLow = b & 0xFFFFFFFF, bHigh = b >> 32;
+    uint64_t lowLow = aLow * bLow;
+    uint64_t middle = aHigh * bLow + (lowLow >> 32);
+    uint64_t middleLow = (middle & 0xFFFFFFFF) + aLow * bHigh;
+    low = (middleLow << 32) | (lowLow & 0xFFFFFFFF);
+    return aHigh * bHigh + (middle >> 32) + (middleLow >> 32);
+#endif
+}
+
+uint64_t ShuffleKernel::bounded(Rng &rng, uint64_t bound)
+{
+    // The high half of random * bound is uniform once the few low halves that would bias it are rejected
+    uint64_t low;
+    uint64_t result = multiply(rng(), bound, low);
+    if (low < bound)
+    {
+        uint64_t threshold = (0 - bound) % bound;
+        while (low < threshold)
+            result = multiply(rng(), bound, low);
+    }
+    return result;
+}
+
+template <std::size_t... Swaps>
+void ShuffleKernel::swapBatch(Card *cards, std::size_t remaining, Rng &rng, std::index_sequence<Swaps...>)
+{
+    // Each index is the high half of the last product's low half times its bound, like rolling several dice from one number.
+    // A braced list is evaluated in order, so the leftover carries from one index to the next
+    uint64_t leftover = rng();
+    uint64_t indices[] = {multiply(leftover, remaining - Swaps, leftover)...};
+
+    // Only the rare leftover below the product of the bounds needs the division to check for bias
+    uint64_t product = (uint64_t(1) * ... * (remaining - Swaps));
+    if (leftover < product)
+    {
+        uint64_t threshold = (0 - product) % product;
+        while (leftover < threshold)
+        {
+            leftover = rng();
+            uint64_t redrawn[] = {multiply(leftover, remaining - Swaps, leftover)...};
+            ((indices[Swaps] = redrawn[Swaps]), ...);
+        }
+    }
+
+    (std::swap(cards[remaining - 1 - Swaps], cards[indices[Swaps]]), ...);
+}
+
+void ShuffleKernel::shuffle(Card *cards, std::size_t count, Rng &rng)
+{
+    // As many swaps per random number as keep the product of their bounds in 64 bits
+    std::size_t remaining = count;
+    for (; remaining > 0xFFFFFFFF; remaining--)
+        swapBatch(cards, remaining, rng, std::make_index_sequence<1>());
+    for (; remaining > 65536; remaining -= 2)
+        swapBatch(cards, remaining, rng, std::make_index_sequence<2>());
+    for (; remaining > 1024; remaining -= 3)
+        swapBatch(cards, remaining, rng, std::make_index_sequence<3>());
+    for (; remaining > 6; remaining -= 6)
+        swapBatch(cards, remaining, rng, std::make_index_sequence<6>());
+
+    // The last few cards take one batch of all but one of them
+    switch (remaining)
+    {
+    case 6:
+        swapBatch(cards, remaining, rng, std::make_index_sequence<5>());
+        break;
+    case 5:
+        swapBatch(cards, remaining, rng, std::make_index_sequence<4>());
+        break;
+    case 4:
+        swapBatch(cards, remaining, rng, std::make_index_sequence<3>());
+        break;
+    case 3:
+        swapBatch(cards, remaining, rng, std::make_index_sequence<2>());
+        break;
+    case 2:
+        swapBatch(cards, remaining, rng, std::make_index_sequence<1>());
+        break;
+    default:
+        break;
+    }
+}
+
+void ShuffleKernel::shuffle(std::vector<Card> &shoe, Rng &rng, const ShuffleModel &model)
+{
+    if (model.type == SHUFFLE::RANDOM)
+    {
+        shuffle(shoe.data(), shoe.size(), rng);
+        return;
+    }
+
+    if (model.riffles > 0)
+        riffle(shoe, rng, model.grabSize, model.clumping);
+    for (int i = 0; i < model.strips; i++)
+        strip(shoe, rng, model.grabSize, model.stripPackets);
+    for (int i = 1; i < model.riffles; i++)
+        riffle(shoe, rng, model.grabSize, model.clumping);
+    for (int i = 0; i < model.boxes; i++)
+        box(shoe, rng);
+    cut(shoe, rng);
+}
+
+void ShuffleKernel::shuffleFromSeed(std::vector<Card> &shoe, uint64_t seed, const ShuffleModel &model)
+{
+    if (model.type == SHUFFLE::RANDOM)
+    {
+        // One deck in code order, copied once per deck
+        static const std::array<Card, Card::count> orderedDeck = []()
+        {
+            std::array<Card, Card::count> deck;
+            for (unsigned int code = 0; code < Card::count; code++)
+                deck[code] = Card::fromCode(static_cast<uint8_t>(code));
+            return deck;
+        }();
+        for (std::size_t start = 0; start < shoe.size(); start += Card::count)
+            std::copy_n(orderedDeck.begin(), std::min<std::size_t>(Card::count, shoe.size() - start), shoe.begin() + start);
+    }
+
+    Rng rng(seed);
+    shuffle(shoe, rng, model);
+}
+
+bool ShuffleKernel::chance(Rng &rng, double probability)
+{
+    // The top 53 bits as a double in [0, 1)
+    return static_cast<double>(rng() >> 11) * 0x1.0p-53 < probability;
+}
+
+void ShuffleKernel::riffleGrab(Card *cards, int count, Card *scratch, Rng &rng, double clumping)
+{
+    if (count < 2)
+        return;
+
+    // Gilbert-Shannon-Reeds cut: the size of the top half is the number of heads in count coin flips
+    int cutIndex = 0;
+    for (int bits = count; bits > 0; bits -= 64)
+    {
+        uint64_t flips = rng();
+        if (bits < 64)
+            flips &= (uint64_t(1) << bits) - 1;
+        for (; flips != 0; flips &= flips - 1)
+            cutIndex++;
+    }
+
+    // Cards fall from the bottom of each half, from a half in proportion to the cards it has left
+    int left = cutIndex;
+    int right = count - cutIndex;
+    bool lastLeft = false;
+    for (int out = count - 1; out >= 0; out--)
+    {
+        bool fromLeft;
+        if (left == 0)
+            fromLeft = false;
+        else if (right == 0)
+            fromLeft = true;
+        else if (out < count - 1 && clumping > 0 && chance(rng, clumping))
+            fromLeft = lastLeft;
+        else
+            fromLeft = bounded(rng, left + right) < static_cast<uint64_t>(left);
+
+        scratch[out] = fromLeft ? cards[--left] : cards[cutIndex + --right];
+        lastLeft = fromLeft;
+    }
+    std::copy(scratch, scratch + count, cards);
+}
+
+void ShuffleKernel::riffle(std::vector<Card> &shoe, Rng &rng, int grabSize, double clumping)
+{
+    int size = static_cast<int>(shoe.size());
+    std::vector<Card> scratch(std::min(grabSize, size));
+    for (int start = 0; start < size; start += grabSize)
+        riffleGrab(shoe.data() + start, std::min(grabSize, size - start), scratch.data(), rng, clumping);
+}
+
+void ShuffleKernel::strip(std::vector<Card> &shoe, Rng &rng, int grabSize, int packets)
+{
+    int size = static_cast<int>(shoe.size());
+    std::vector<Card> scratch(std::min(grabSize, size));
+    for (int start = 0; start < size; start += grabSize)
+    {
+        int count = std::min(grabSize, size - start);
+        int meanPacket = std::max(1, count / std::max(1, packets));
+
+        // Each packet pulled off the top lands on the ones before it, so the first packet ends up on the bottom
+        int out = count;
+        for (int top = 0; top < count;)
+        {
+            int packet = std::min(count - top, 1 + static_cast<int>(bounded(rng, 2 * meanPacket - 1)));
+            out -= packet;
+            std::copy(shoe.begin() + start + top, shoe.begin() + start + top + packet, scratch.begin() + out);
+            top += packet;
+        }
+        std::copy(scratch.begin(), scratch.begin() + count, shoe.begin() + start);
+    }
+}
+
+void ShuffleKernel::box(std::vector<Card> &shoe, Rng &rng)
+{
+    int size = static_cast<int>(shoe.size());
+    if (size < 4)
+        return;
+
+    // Four packets of a quarter each, give or take an eighth of a quarter
+    int quarter = size / 4;
+    int spread = quarter / 8;
+    std::vector<Card> scratch(size);
+    int out = size;
+    int top = 0;
+    for (int packet = 0; packet < 4; packet++)
+    {
+        int packetSize = packet == 3 ? size - top : quarter - spread + static_cast<int>(bounded(rng, 2 * spread + 1));
+        out -= packetSize;
+        std::copy(shoe.begin() + top, shoe.begin() + top + packetSize, scratch.begin() + out);
+        top += packetSize;
+    }
+    shoe.swap(scratch);
+}
+
+void ShuffleKernel::cut(std::vector<Card> &shoe, Rng &rng)
+{
+    // The cut card goes somewhere in the middle half of the shoe
+    std::size_t size = shoe.size();
+    if (size < 4)
+        return;
+    std::size_t cutIndex = size / 4 + bounded(rng, size / 2);
+    std::rotate(shoe.begin(), shoe.begin() + cutIndex, shoe.end());
+}
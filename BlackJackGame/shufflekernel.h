@@ -0,0 +1,230 @@
+#ifndef SHUFFLEKERNEL_H
+#define SHUFFLEKERNEL_H
+
+#include "card.h"
+#include "rng.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ShuffleType
+{
+
+    /**
+     * @brief The SHUFFLE enum How a shoe is shuffled
+     *
+     * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+     * @date 5/5/2025
+     */
+    enum class SHUFFLE
+    {
+        RANDOM,
+        CASINO
+    };
+
+    /**
+     * @brief toString Converts a SHUFFLE to a string
+     * @param shuffle The SHUFFLE to convert
+     * @return A string of the SHUFFLE provided
+     */
+    inline std::string toString(SHUFFLE shuffle)
+    {
+        switch (shuffle)
+        {
+        case SHUFFLE::RANDOM:
+            return "Random";
+        case SHUFFLE::CASINO:
+            return "Casino";
+        default:
+            return "Unknown";
+        }
+    }
+
+    /**
+     * @brief allShuffles An array of all SHUFFLE values for iteration
+     */
+    static constexpr std::array<SHUFFLE, 2> allShuffles = {SHUFFLE::RANDOM, SHUFFLE::CASINO};
+}
+
+using ShuffleType::SHUFFLE;
+
+/**
+ * @brief The ShuffleModel struct describes how a shoe is shuffled. RANDOM is a uniform random permutation.
+ * CASINO follows a dealer's procedure on the previous shoe's order: riffle, strip, riffle again the remaining times, box, then cut.
+ * Riffles and strips work on grabs of the shoe the size of one riffle, so cards stay near their old zone the way they do at a real table
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/5/2025
+ */
+struct ShuffleModel
+{
+    /**
+     * @brief type How the shoe is shuffled
+     */
+    SHUFFLE type = SHUFFLE::RANDOM;
+
+    /**
+     * @brief riffles The number of riffle passes over the shoe
+     */
+    int riffles = 3;
+
+    /**
+     * @brief strips The number of strip passes after the first riffle
+     */
+    int strips = 1;
+
+    /**
+     * @brief boxes The number of box passes after the last riffle
+     */
+    int boxes = 1;
+
+    /**
+     * @brief grabSize The number of cards riffled or stripped together
+     */
+    int grabSize = 52;
+
+    /**
+     * @brief stripPackets The average number of packets a grab is stripped into
+     */
+    int stripPackets = 5;
+
+    /**
+     * @brief clumping The chance the next card of a riffle falls from the same half as the last one regardless of their sizes.
+     * 0 is a perfect Gilbert-Shannon-Reeds riffle, higher values leave bigger clumps of cards together
+     */
+    double clumping = 0.0;
+
+    /**
+     * @brief casino Gets a casino shuffle with the default procedure
+     * @param clumping The imperfection of each riffle
+     * @return The shuffle model
+     */
+    static ShuffleModel casino(double clumping = 0.0);
+
+    /**
+     * @brief describe Summarizes the model in one line, for example "Casino: 3 riffles, 1 strip, 1 box, clumping 0.2"
+     * @return The summary
+     */
+    std::string describe() const;
+};
+
+/**
+ * @brief The ShuffleKernel class shuffles shoes of one byte cards. Random shuffles are a Fisher-Yates shuffle whose swap indices come
+ * from Lemire's nearly divisionless bounded random numbers, batched so one 64 bit random number gives the indices of several swaps.
+ * For a shoe of up to 1024 cards that is six swaps per random number, against one or two for std::shuffle. Each batch is unrolled at compile time,
+ * which is where the time goes: left as a loop over a run time batch size it is no faster than std::shuffle unless the compiler peels it
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/5/2025
+ */
+class ShuffleKernel
+{
+public:
+    /**
+     * @brief bounded Gets a uniform random number below a bound without a division in the common case
+     * @param rng The generator
+     * @param bound The number of possible values, at least 1
+     * @return A number from 0 to bound - 1
+     */
+    static uint64_t bounded(Rng &rng, uint64_t bound);
+
+    /**
+     * @brief shuffle Uniformly shuffles cards in place
+     * @param cards The first card
+     * @param count The number of cards
+     * @param rng The generator
+     */
+    static void shuffle(Card *cards, std::size_t count, Rng &rng);
+
+    /**
+     * @brief shuffle Shuffles a shoe in place following a model
+     * @param shoe The cards, top card first
+     * @param rng The generator
+     * @param model How to shuffle
+     */
+    static void shuffle(std::vector<Card> &shoe, Rng &rng, const ShuffleModel &model);
+
+    /**
+     * @brief shuffleFromSeed Shuffles a shoe following a model with a generator seeded for this shoe alone.
+     * A uniform shuffle starts over from the cards in code order, so the shoe only depends on the seed and its size.
+     * A casino shuffle works on the shoe as it was, the same as a dealer picking up the last shoe
+     * @param shoe The cards, top card first. A uniform shuffle needs whole decks
+     * @param seed The seed of the shoe
+     * @param model How to shuffle
+     */
+    static void shuffleFromSeed(std::vector<Card> &shoe, uint64_t seed, const ShuffleModel &model);
+
+    /**
+     * @brief riffle Riffles every grab of a shoe once, cutting each near the middle and dropping cards from the two halves
+     * @param shoe The cards, top card first
+     * @param rng The generator
+     * @param grabSize The number of cards riffled together
+     * @param clumping The chance a card falls from the same half as the last one regardless of their sizes
+     */
+    static void riffle(std::vector<Card> &shoe, Rng &rng, int grabSize, double clumping);
+
+    /**
+     * @brief strip Strips every grab of a shoe once, pulling packets off the top and stacking them so their order reverses
+     * @param shoe The cards, top card first
+     * @param rng The generator
+     * @param grabSize The number of cards stripped together
+     * @param packets The average number of packets per grab
+     */
+    static void strip(std::vector<Card> &shoe, Rng &rng, int grabSize, int packets);
+
+    /**
+     * @brief box Cuts the whole shoe into four packets of about the same size and stacks them in reverse order
+     * @param shoe The cards, top card first
+     * @param rng The generator
+     */
+    static void box(std::vector<Card> &shoe, Rng &rng);
+
+    /**
+     * @brief cut Moves the cards above a random cut point to the bottom of the shoe
+     * @param shoe The cards, top card first
+     * @param rng The generator
+     */
+    static void cut(std::vector<Card> &shoe, Rng &rng);
+
+private:
+    /**
+     * @brief swapBatch Makes the next swaps of a shuffle, one for each index in the sequence, with their indices all taken from one random number.
+     * The product of the bounds has to fit in 64 bits
+     * @param cards The first card
+     * @param remaining The number of cards left to shuffle, the largest bound
+     * @param rng The generator
+     */
+    template <std::size_t... Swaps>
+    static void swapBatch(Card *cards, std::size_t remaining, Rng &rng, std::index_sequence<Swaps...>);
+
+    /**
+     * @brief multiply Multiplies two 64 bit numbers into 128 bits
+     * @param a The first number
+     * @param b The second number
+     * @param low Set to the low 64 bits of the product
+     * @return The high 64 bits of the product
+     */
+    static uint64_t multiply(uint64_t a, uint64_t b, uint64_t &low);
+
+    /**
+     * @brief riffleGrab Riffles a range of cards once
+     * @param cards The first card
+     * @param count The number of cards
+     * @param scratch Somewhere to hold count cards
+     * @param rng The generator
+     * @param clumping The chance a card falls from the same half as the last one
+     */
+    static void riffleGrab(Card *cards, int count, Card *scratch, Rng &rng, double clumping);
+
+    /**
+     * @brief chance Gets true with a probability
+     * @param rng The generator
+     * @param probability The probability of true
+     */
+    static bool chance(Rng &rng, double probability);
+};
+
+#endif // SHUFFLEKERNEL_H
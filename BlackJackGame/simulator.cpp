@@ -0,0 +1,235 @@
+/**
+ * @brief Implementation of The Simulator class. It plays blackjack rounds headlessly on a GameState, using a BotStrategy as the policy for every seat.
+ * It follows the same turn order as Controller but without any Qt signals or timers
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/24/2025
+ */
+
+#include "simulator.h"
+#include "playerStatus.h"
+#include <chrono>
+
+using PlayerStatus::PLAYERSTATUS;
+
+/**
+ * @brief startingMoney The bankroll of every simulated seat. Large enough that no seat goes bankrupt in a realistic run
+ */
+static const int startingMoney = 1000000000;
+
+void SimulationResult::addHand(double units)
+{
+    hands++;
+    double delta = units - mean;
+    mean += delta / hands;
+    m2 += delta * (units - mean);
+}
+
+void SimulationResult::merge(const SimulationResult &other)
+{
+    rounds += other.rounds;
+    if (other.hands == 0)
+        return;
+
+    // Chan et al. pairwise combination of the two means and sums of squares
+    long long combined = hands + other.hands;
+    double delta = other.mean - mean;
+    mean += delta * other.hands / combined;
+    m2 += other.m2 + delta * delta * (static_cast<double>(hands) * other.hands / combined);
+    hands = combined;
+}
+
+double SimulationResult::houseEdge() const
+{
+    return -mean;
+}
+
+double SimulationResult::variance() const
+{
+    if (hands < 2)
+        return 0;
+    return m2 / (hands - 1);
+}
+
+double SimulationResult::roundsPerSecond() const
+{
+    return seconds > 0 ? rounds / seconds : 0;
+}
+
+double SimulationResult::handsPerSecond() const
+{
+    return seconds > 0 ? hands / seconds : 0;
+}
+
+Simulator::Simulator(int playerCount, const TableRules &rules, int bet, Rng rng, BACKEND backend)
+    : model(createPlayers(playerCount, bet), rules, SHOEORDER::RANDOM, rng), strategy(backend, rules), betting(BettingPolicy::flat(bet)), seatMoney(playerCount), seatBets(playerCount) {}
+
+std::vector<Player> Simulator::createPlayers(int playerCount, int bet)
+{
+    std::vector<Player> players;
+    players.reserve(playerCount);
+
+    for (int i = 0; i < playerCount; i++)
+    {
+        players.emplace_back(startingMoney, bet, false, 1, 0);
+        players[i].originalHand = true;
+    }
+    return players;
+}
+
+SimulationResult Simulator::run(long long rounds)
+{
+    SimulationResult result;
+    auto start = std::chrono::steady_clock::now();
+
+    for (long long i = 0; i < rounds; i++)
+        playRound(result);
+
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+void Simulator::playRound(SimulationResult &result)
+{
+    model.clearHands();
+
+    // Every seat with money left bets by the policy
+    const PlayerTable &table = model.getPlayerTable();
+    for (int i = 0; i < model.getPlayerCount(); i++)
+    {
+        seatMoney[i] = table.money(i);
+        seatBets[i] = table.status(i) == PLAYERSTATUS::BANKRUPT ? 0 : betting.getBet(seatMoney[i]);
+        if (seatBets[i] > 0)
+            model.setPlayerBet(i, seatBets[i]);
+    }
+
+    model.dealInitialCards();
+
+    // Players only get a turn if the dealer does not have 21, the same as Controller::advanceToNextPlayer
+    if (model.getDealerHand().getTotal() != 21)
+    {
+        const Card upCard = model.getDealerHand().getCards()[1];
+
+        // The player count grows while playing as hands are split
+        for (int i = 0; i < model.getPlayerCount(); i++)
+            playHand(i, upCard);
+
+        if (onePlayerStillAlive())
+            model.dealerPlay();
+    }
+
+    model.endRound();
+
+    // Settle each seat against the money it had before betting
+    for (int seat = 0; seat < table.getSeatCount(); seat++)
+        if (seatBets[seat] > 0)
+            result.addHand(static_cast<double>(table.money(seat) - seatMoney[seat]) / seatBets[seat]);
+    result.rounds++;
+}
+
+void Simulator::setBettingPolicy(const BettingPolicy &policy)
+{
+    betting = policy;
+}
+
+void Simulator::startSession(int money, uint64_t seed)
+{
+    model.clearHands();
+    for (int seat = 0; seat < model.getPlayerTable().getSeatCount(); seat++)
+        model.setSeatMoney(seat, money);
+    model.reseed(seed);
+}
+
+void Simulator::setChart(const StrategyChart &chart)
+{
+    strategy.setChart(chart);
+}
+
+void Simulator::setBackgroundShuffle(bool enabled)
+{
+    model.setBackgroundShuffle(enabled);
+}
+
+void Simulator::setShuffleModel(const ShuffleModel &shuffleModel)
+{
+    model.setShuffleModel(shuffleModel);
+}
+
+void Simulator::setHistory(HandHistoryWriter *history)
+{
+    model.setHistory(history);
+}
+
+const PlayerTable &Simulator::getPlayerTable() const
+{
+    return model.getPlayerTable();
+}
+
+void Simulator::playHand(int playerIndex, const Card &upCard)
+{
+    // Read the hand in place, a reference into the table would not survive a split
+    const PlayerTable &table = model.getPlayerTable();
+    if (table.status(playerIndex) == PLAYERSTATUS::BANKRUPT || table.status(playerIndex) == PLAYERSTATUS::STAND)
+        return;
+
+    model.setPlayerActive(playerIndex);
+
+    while (table.status(playerIndex) == PLAYERSTATUS::ACTIVE)
+    {
+        const Hand &hand = table.hand(playerIndex);
+        HandOptions options = model.getOptions(playerIndex);
+        MOVE move;
+        if (strategy.getBackend() == BACKEND::BASIC)
+            move = strategy.getBasicMove(hand, upCard, options);
+        else if (strategy.getBackend() == BACKEND::COUNTING)
+            move = BotStrategy::getCountedMove(hand, upCard, playerTrueCount(), strategy.getRules(), options);
+        else
+        {
+            // The dealer's hole card hasn't been seen, so it is still part of the unseen cards
+            ShoeComposition unseen = model.getShoeComposition();
+            unseen.addCard(model.getDealerHand().getCards()[0]);
+            move = strategy.getMove(hand, upCard, unseen, options);
+        }
+
+        if (move == MOVE::STAND)
+        {
+            model.stand(playerIndex);
+        }
+        else if (move == MOVE::SURRENDER && options.canSurrender)
+        {
+            model.surrender(playerIndex);
+        }
+        // If the rules or money don't allow doubling, hit instead
+        else if (move == MOVE::DOUBLE && options.canDouble)
+        {
+            model.doubleDown(playerIndex);
+        }
+        // Splitting keeps this hand active and inserts the second hand right after it
+        else if (move == MOVE::SPLIT && options.canSplit)
+        {
+            model.split(playerIndex);
+        }
+        else
+        {
+            model.hit(playerIndex);
+        }
+    }
+}
+
+double Simulator::playerTrueCount() const
+{
+    // The deck counted the dealer's hole card when it was dealt, but the players haven't seen it
+    CardCounter seen = model.getCounter();
+    seen.uncount(model.getDealerHand().getCards()[0]);
+    return seen.getTrueCount(model.getShoeComposition().getTotal() + 1);
+}
+
+bool Simulator::onePlayerStillAlive() const
+{
+    for (int i = 0; i < model.getPlayerCount(); i++)
+    {
+        if (model.getPlayers()[i].status() == PLAYERSTATUS::STAND)
+            return true;
+    }
+    return false;
+}
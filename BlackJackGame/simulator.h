@@ -0,0 +1,211 @@
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include "bettingpolicy.h"
+#include "gamestate.h"
+#include "botstrategy.h"
+#include <vector>
+
+/**
+ * @brief The SimulationResult struct holds the accumulated outcome of a batch of simulated rounds.
+ * Per hand results are measured in units of the initial bet and accumulated with Welford's method
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/24/2025
+ */
+struct SimulationResult
+{
+    /**
+     * @brief rounds The number of rounds played
+     */
+    long long rounds = 0;
+
+    /**
+     * @brief hands The number of initial hands played (one per seat that bet per round, splits not counted)
+     */
+    long long hands = 0;
+
+    /**
+     * @brief seconds The wall clock time spent playing the rounds
+     */
+    double seconds = 0;
+
+    /**
+     * @brief mean The running mean of the result of a hand in initial bets
+     */
+    double mean = 0;
+
+    /**
+     * @brief m2 The running sum of squared differences from the mean
+     */
+    double m2 = 0;
+
+    /**
+     * @brief addHand Adds the result of a single hand to the accumulator
+     * @param units The amount won (positive) or lost (negative) in initial bets
+     */
+    void addHand(double units);
+
+    /**
+     * @brief merge Combines another result into this one, as if all of its hands had been added here.
+     * Merging the same results in the same order always gives bit-identical values
+     * @param other The result to combine
+     */
+    void merge(const SimulationResult &other);
+
+    /**
+     * @brief houseEdge Gets the house edge as a fraction of the initial bet
+     * @return The negated expected value of a hand
+     */
+    double houseEdge() const;
+
+    /**
+     * @brief variance Gets the sample variance of a hand in squared initial bets
+     * @return The variance, or 0 if fewer than 2 hands were played
+     */
+    double variance() const;
+
+    /**
+     * @brief roundsPerSecond Gets the throughput of the simulation
+     * @return The number of rounds played per second
+     */
+    double roundsPerSecond() const;
+
+    /**
+     * @brief handsPerSecond Gets the throughput of the simulation
+     * @return The number of initial hands played per second
+     */
+    double handsPerSecond() const;
+};
+
+/**
+ * @brief The Simulator class plays blackjack rounds headlessly on a GameState, using a BotStrategy as the policy for every seat.
+ * It follows the same turn order as Controller but without any Qt signals or timers
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/24/2025
+ */
+class Simulator
+{
+public:
+    /**
+     * @brief Simulator Constructor that creates a table of bot players
+     * @param playerCount The number of seats at the table
+     * @param rules The house rules of the table, including the number of decks
+     * @param bet The flat bet each seat places every round until setBettingPolicy. Bets that are a multiple of the payout denominator keep blackjack payouts exact
+     * @param rng The random number generator for the shoe
+     * @param backend How the bots choose their moves
+     */
+    Simulator(int playerCount, const TableRules &rules, int bet = 10, Rng rng = Rng(), BACKEND backend = BACKEND::BASIC);
+
+    /**
+     * @brief run Plays the given number of rounds and accumulates the results
+     * @param rounds The number of rounds to play
+     * @return The results of the rounds played
+     */
+    SimulationResult run(long long rounds);
+
+    /**
+     * @brief playRound Plays a single round: bet, deal, play every hand, dealer plays and settle. Bankrupt seats sit the round out
+     * @param result The result to add each seat's outcome to, in units of the seat's bet
+     */
+    void playRound(SimulationResult &result);
+
+    /**
+     * @brief setBettingPolicy Changes how every seat sizes its bet from its money, from the next round on
+     * @param policy The betting policy
+     */
+    void setBettingPolicy(const BettingPolicy &policy);
+
+    /**
+     * @brief startSession Starts every seat over with the given money and the shoe over from a seed, so the same seed plays the same session
+     * @param money The money each seat starts with
+     * @param seed The seed the shoe is dealt from
+     */
+    void startSession(int money, uint64_t seed);
+
+    /**
+     * @brief setChart Has the BASIC backend play from a chart generated for the table's rules
+     * @param chart The chart to play from
+     */
+    void setChart(const StrategyChart &chart);
+
+    /**
+     * @brief setBackgroundShuffle Has the table shuffle its next shoes on a background thread. A seeded table plays the same rounds either way
+     * @param enabled True to shuffle in the background
+     */
+    void setBackgroundShuffle(bool enabled);
+
+    /**
+     * @brief setShuffleModel Changes how the table's shoe is shuffled
+     * @param shuffleModel The uniform shuffle or a casino procedure
+     */
+    void setShuffleModel(const ShuffleModel &shuffleModel);
+
+    /**
+     * @brief setHistory Records every round the table plays
+     * @param history The writer to record to, owned by the caller, null to stop recording
+     */
+    void setHistory(HandHistoryWriter *history);
+
+    /**
+     * @brief getPlayerTable Gets the table's seats, with each seat's money after the last round
+     * @return The player table
+     */
+    const PlayerTable &getPlayerTable() const;
+
+private:
+    /**
+     * @brief model The game being simulated
+     */
+    GameState model;
+
+    /**
+     * @brief strategy The policy every seat plays by
+     */
+    BotStrategy strategy;
+
+    /**
+     * @brief betting How each seat sizes its bet
+     */
+    BettingPolicy betting;
+
+    /**
+     * @brief seatMoney The money each seat had before betting this round
+     */
+    std::vector<int> seatMoney;
+
+    /**
+     * @brief seatBets The bet each seat placed this round, 0 for a bankrupt seat
+     */
+    std::vector<int> seatBets;
+
+    /**
+     * @brief playHand Plays the hand at the given index until it stands or busts
+     * @param playerIndex The index of the hand to play
+     * @param upCard The dealer's face up card
+     */
+    void playHand(int playerIndex, const Card &upCard);
+
+    /**
+     * @brief playerTrueCount Gets the true count of the cards the players have seen, everything dealt since the shuffle but the dealer's hole card
+     * @return The true count from the players' point of view
+     */
+    double playerTrueCount() const;
+
+    /**
+     * @brief onePlayerStillAlive Checks if there is at least one hand that stood
+     * @return True if the dealer needs to play, false otherwise
+     */
+    bool onePlayerStillAlive() const;
+
+    /**
+     * @brief createPlayers Creates the bot players for the table
+     * @param playerCount The number of players to create
+     * @param bet The initial bet of the players
+     * @return A vector of the players
+     */
+    static std::vector<Player> createPlayers(int playerCount, int bet);
+};
+
+#endif // SIMULATOR_H
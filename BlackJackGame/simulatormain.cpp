@@ -0,0 +1,454 @@
+/**
+ * @brief Main for the headless blackjack simulator. Plays bot only rounds as fast as possible and reports throughput, house edge and variance
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/24/2025
+ */
+
+#include "bankrollsimulator.h"
+#include "goldenrun.h"
+#include "montecarlorunner.h"
+#include "strategygenerator.h"
+#include <chrono>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+// The project file points this at the golden runs kept with the sources, so a build run from anywhere can check them
+#ifndef GOLDEN_FILE
+#define GOLDEN_FILE "golden/bankrolls.txt"
+#endif
+
+/**
+ * @brief presetName Gets the command line name of a preset, its name in lower case with dashes for spaces
+ * @param preset The preset
+ * @return The name to pass to --preset
+ */
+static std::string presetName(PRESET preset)
+{
+    std::string name = RulePreset::toString(preset);
+    for (char &c : name)
+        c = c == ' ' ? '-' : static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return name;
+}
+
+/**
+ * @brief parsePreset Finds the preset with the given command line name
+ * @param name The name passed to --preset
+ * @param preset Set to the preset if it is found
+ * @return True if the name is a preset
+ */
+static bool parsePreset(const char *name, PRESET &preset)
+{
+    for (PRESET candidate : RulePreset::allPresets)
+    {
+        if (presetName(candidate) == name)
+        {
+            preset = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief printUsage Prints the command line options of the simulator
+ * @param program The name the program was run as
+ */
+static void printUsage(const char *program)
+{
+    std::cout << "Usage: " << program << " [--rounds N] [--players N] [--bet N] [--threads N] [--seed N] [--strategy basic|composition|counting]\n"
+              << "       [--preset NAME|all] [--decks N] [--h17] [--payout N:D] [--no-das] [--max-hands N] [--rsa] [--hsa] [--surrender] [--penetration F] [--csm]\n"
+              << "       [--chart DIR] [--print-chart] [--background-shuffle] [--shuffle random|casino] [--clumping F] [--history FILE]\n"
+              << "       [--golden-write FILE] [--golden-check FILE] [--golden] [--bankroll N] [--sessions N] [--betting flat|proportional] [--divisor N] [--min-bet N]\n"
+              << "  --rounds      Number of rounds to play, or the most rounds of each bankroll session (default 1000000)\n"
+              << "  --players     Number of bot seats at the table (default 1)\n"
+              << "  --bet         Flat bet per seat, multiples of the payout denominator keep payouts exact (default 10)\n"
+              << "  --threads     Number of worker threads, 0 for every hardware thread (default 0)\n"
+              << "  --seed        Master seed, the same seed and thread count give identical results (default random)\n"
+              << "  --strategy    basic uses the strategy tables, composition computes the best move from the unseen cards,\n"
+              << "                counting adds the Hi-Lo Illustrious 18 deviations to the tables (default basic)\n"
+              << "  --preset      Start from a casino rule set, all runs every preset one after another (default game)\n"
+              << "  --decks       Number of decks in the shoe (default 6)\n"
+              << "  --h17         Dealer hits soft 17\n"
+              << "  --payout      Blackjack payout (default 3:2)\n"
+              << "  --no-das      No doubling after a split\n"
+              << "  --max-hands   Most hands a seat can split into, 0 for no limit\n"
+              << "  --rsa         Split aces may be resplit\n"
+              << "  --hsa         Split aces may be hit\n"
+              << "  --surrender   Late surrender is offered\n"
+              << "  --penetration Deal the shoe to this fraction before reshuffling instead of shuffling every round\n"
+              << "  --csm         Deal from a continuous shuffling machine that takes the discards back after every round\n"
+              << "  --chart       Play basic strategy from the chart generated for the rules, cached in DIR\n"
+              << "  --print-chart Generate the chart for the rules and print it as a constexpr StrategyChart instead of playing\n"
+              << "  --background-shuffle Shuffle the next shoes on a background thread per table, for shoe games with spare cores.\n"
+              << "                Results are the same for a seed\n"
+              << "  --shuffle     random shuffles uniformly, casino riffles, strips and boxes the last shoe like a dealer (default random)\n"
+              << "  --clumping    Chance each riffled card falls from the same half as the last, 0 is a perfect riffle (default 0)\n"
+              << "  --history     Record every round to a compressed hand history, one file per thread named FILE.N with more than one\n"
+              << "  --golden-write Play the golden run scenarios from the seed and save each seat's money at the end to FILE\n"
+              << "  --golden-check Play the golden runs saved in FILE again and report any that end differently, exits with 1 if one does\n"
+              << "  --golden      Check the golden runs kept with the sources, the same as --golden-check " GOLDEN_FILE "\n"
+              << "  --bankroll    Play sessions of one seat starting with N money until it goes bankrupt or the rounds run out,\n"
+              << "                and report the risk of ruin, N0 and how the money moves instead of the house edge\n"
+              << "  --sessions    Number of bankroll sessions (default 1000)\n"
+              << "  --betting     flat bets --bet every round, proportional bets the money over --divisor like the game's bots (default flat)\n"
+              << "  --divisor     The money is divided by this for a proportional bet (default 10)\n"
+              << "  --min-bet     Smallest proportional bet (default 1)\n"
+              << "Presets:";
+    for (PRESET preset : RulePreset::allPresets)
+        std::cout << " " << presetName(preset);
+    std::cout << "\n";
+}
+
+/**
+ * @brief runRules Plays a batch of rounds under one set of rules
+ * @param rules The rules of the table
+ * @param players The number of seats
+ * @param threads The number of worker threads
+ * @param seed The master seed
+ * @param bet The flat bet per seat
+ * @param backend How the bots choose their moves
+ * @param rounds The number of rounds to play
+ * @param chartDirectory The directory generated charts are cached in, empty to play the hand written tables
+ * @param backgroundShuffle True to shuffle on background threads
+ * @param shuffleModel How the shoes are shuffled
+ * @return The merged results
+ */
+static SimulationResult runRules(const TableRules &rules, int players, unsigned int threads, uint64_t seed, int bet, BACKEND backend, long long rounds, const std::string &chartDirectory, bool backgroundShuffle, const ShuffleModel &shuffleModel)
+{
+    MonteCarloRunner runner(players, rules, threads, seed, bet, backend);
+    runner.setBackgroundShuffle(backgroundShuffle);
+    runner.setShuffleModel(shuffleModel);
+    if (!chartDirectory.empty())
+    {
+        bool generated;
+        runner.setChart(StrategyGenerator::loadOrGenerate(rules, chartDirectory, generated));
+    }
+    return runner.run(rounds);
+}
+
+/**
+ * @brief runBankroll Plays bankroll sessions and prints the risk of ruin, both measured and analytic, and the spread of the money over the sessions
+ * @param rules The rules of the table
+ * @param policy How the seat bets
+ * @param money The money each session starts with
+ * @param threads The number of worker threads
+ * @param seed The master seed
+ * @param backend How the seat chooses its moves
+ * @param sessions The number of sessions
+ * @param rounds The most rounds of a session
+ * @param chartDirectory The directory generated charts are cached in, empty to play the hand written tables
+ */
+static void runBankroll(const TableRules &rules, const BettingPolicy &policy, int money, unsigned int threads, uint64_t seed, BACKEND backend, long long sessions, long long rounds, const std::string &chartDirectory)
+{
+    BankrollSimulator simulator(rules, policy, money, threads, seed, backend);
+    if (!chartDirectory.empty())
+    {
+        bool generated;
+        simulator.setChart(StrategyGenerator::loadOrGenerate(rules, chartDirectory, generated));
+    }
+    BankrollResult result = simulator.run(sessions, rounds);
+
+    double mean = result.play.mean;
+    double variance = result.play.variance();
+    std::cout << "Seed:         " << seed << "\n"
+              << "Threads:      " << simulator.getThreadCount() << "\n"
+              << "Strategy:     " << StrategyBackend::toString(backend) << "\n"
+              << "Rules:        " << rules.describe() << "\n"
+              << "Betting:      " << policy.describe() << "\n"
+              << "Bankroll:     " << money << "\n"
+              << "Sessions:     " << result.sessions << " of up to " << rounds << " rounds\n"
+              << "Hands:        " << result.play.hands << " in " << result.seconds << " seconds\n"
+              << std::setprecision(6)
+              << "Player edge:  " << mean * 100 << "% per bet, variance " << variance << "\n"
+              << "N0:           " << BankrollSimulator::nZero(mean, variance) << " rounds\n"
+              << "Risk of ruin: " << result.riskOfRuin() * 100 << "% (+/- " << result.riskOfRuinError() * 100 << "%) played, "
+              << BankrollSimulator::analyticRiskOfRuin(policy, money, mean, variance, rounds) * 100 << "% analytic, "
+              << BankrollSimulator::analyticRiskOfRuin(policy, money, mean, variance, 0) * 100 << "% playing forever\n";
+    if (result.ruined > 0)
+        std::cout << "Rounds to ruin: " << result.ruinRounds.quantile(0.1) << " / " << result.ruinRounds.quantile(0.5) << " / " << result.ruinRounds.quantile(0.9)
+                  << " (10% / median / 90%)\n";
+
+    std::cout << "Money after each checkpoint, 5% / 25% / median / 75% / 95% of sessions and the mean:\n";
+    for (std::size_t i = 0; i < result.checkpoints.size(); i++)
+    {
+        const QuantileSketch &money = result.trajectory[i];
+        std::cout << std::right << std::setw(12) << result.checkpoints[i] << ":";
+        for (double fraction : {0.05, 0.25, 0.5, 0.75, 0.95})
+            std::cout << std::setw(12) << money.quantile(fraction);
+        std::cout << std::setw(14) << std::fixed << std::setprecision(1) << money.getMean() << std::defaultfloat << "\n";
+    }
+}
+
+/**
+ * @brief main The point of execution
+ * @param argc Number of args
+ * @param argv Char array of args
+ * @return int An int for the success or failues of the program
+ */
+int main(int argc, char *argv[])
+{
+    long long rounds = 1000000;
+    int players = 1;
+    int bet = 10;
+    unsigned int threads = 0;
+    uint64_t seed = Rng::randomSeed();
+    BACKEND backend = BACKEND::BASIC;
+    bool allPresets = false;
+    bool printChart = false;
+    bool backgroundShuffle = false;
+    ShuffleModel shuffleModel;
+    std::string chartDirectory;
+    std::string historyPath;
+    std::string goldenWritePath;
+    std::string goldenCheckPath;
+    int bankroll = 0;
+    long long sessions = 1000;
+    BETTING betting = BETTING::FLAT;
+    int divisor = 10;
+    int minimumBet = 1;
+
+    TableRules rules;
+    rules.deckCount = 6;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool hasValue = i + 1 < argc;
+        PRESET preset;
+        if (std::strcmp(argv[i], "--rounds") == 0 && hasValue)
+            rounds = std::atoll(argv[++i]);
+        else if (std::strcmp(argv[i], "--players") == 0 && hasValue)
+            players = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--decks") == 0 && hasValue)
+            rules.deckCount = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--bet") == 0 && hasValue)
+            bet = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--threads") == 0 && hasValue)
+            threads = std::strtoul(argv[++i], nullptr, 10);
+        else if (std::strcmp(argv[i], "--seed") == 0 && hasValue)
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (std::strcmp(argv[i], "--strategy") == 0 && hasValue && std::strcmp(argv[i + 1], "basic") == 0)
+        {
+            backend = BACKEND::BASIC;
+            i++;
+        }
+        else if (std::strcmp(argv[i], "--strategy") == 0 && hasValue && std::strcmp(argv[i + 1], "composition") == 0)
+        {
+            backend = BACKEND::COMPOSITION;
+            i++;
+        }
+        else if (std::strcmp(argv[i], "--strategy") == 0 && hasValue && std::strcmp(argv[i + 1], "counting") == 0)
+        {
+            backend = BACKEND::COUNTING;
+            i++;
+        }
+        else if (std::strcmp(argv[i], "--preset") == 0 && hasValue && std::strcmp(argv[i + 1], "all") == 0)
+        {
+            allPresets = true;
+            i++;
+        }
+        else if (std::strcmp(argv[i], "--preset") == 0 && hasValue && parsePreset(argv[i + 1], preset))
+        {
+            rules = TableRules::fromPreset(preset);
+            i++;
+        }
+        else if (std::strcmp(argv[i], "--h17") == 0)
+            rules.dealerHitsSoft17 = true;
+        else if (std::strcmp(argv[i], "--payout") == 0 && hasValue && std::sscanf(argv[i + 1], "%d:%d", &rules.blackjackNumerator, &rules.blackjackDenominator) == 2)
+            i++;
+        else if (std::strcmp(argv[i], "--no-das") == 0)
+            rules.doubleAfterSplit = false;
+        else if (std::strcmp(argv[i], "--max-hands") == 0 && hasValue)
+            rules.maxSplitHands = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--rsa") == 0)
+            rules.resplitAces = true;
+        else if (std::strcmp(argv[i], "--hsa") == 0)
+            rules.hitSplitAces = true;
+        else if (std::strcmp(argv[i], "--surrender") == 0)
+            rules.surrender = true;
+        else if (std::strcmp(argv[i], "--chart") == 0 && hasValue)
+            chartDirectory = argv[++i];
+        else if (std::strcmp(argv[i], "--print-chart") == 0)
+            printChart = true;
+        else if (std::strcmp(argv[i], "--background-shuffle") == 0)
+            backgroundShuffle = true;
+        else if (std::strcmp(argv[i], "--shuffle") == 0 && hasValue && std::strcmp(argv[i + 1], "random") == 0)
+        {
+            shuffleModel.type = SHUFFLE::RANDOM;
+            i++;
+        }
+        else if (std::strcmp(argv[i], "--shuffle") == 0 && hasValue && std::strcmp(argv[i + 1], "casino") == 0)
+        {
+            shuffleModel.type = SHUFFLE::CASINO;
+            i++;
+        }
+        else if (std::strcmp(argv[i], "--clumping") == 0 && hasValue)
+            shuffleModel.clumping = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--penetration") == 0 && hasValue)
+        {
+            rules.penetration = std::atof(argv[++i]);
+            rules.shuffleEveryRound = false;
+        }
+        else if (std::strcmp(argv[i], "--csm") == 0)
+            rules.continuousShuffle = true;
+        else if (std::strcmp(argv[i], "--history") == 0 && hasValue)
+            historyPath = argv[++i];
+        else if (std::strcmp(argv[i], "--golden-write") == 0 && hasValue)
+            goldenWritePath = argv[++i];
+        else if (std::strcmp(argv[i], "--golden-check") == 0 && hasValue)
+            goldenCheckPath = argv[++i];
+        else if (std::strcmp(argv[i], "--golden") == 0)
+            goldenCheckPath = GOLDEN_FILE;
+        else if (std::strcmp(argv[i], "--bankroll") == 0 && hasValue)
+            bankroll = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--sessions") == 0 && hasValue)
+            sessions = std::atoll(argv[++i]);
+        else if (std::strcmp(argv[i], "--betting") == 0 && hasValue && std::strcmp(argv[i + 1], "flat") == 0)
+        {
+            betting = BETTING::FLAT;
+            i++;
+        }
+        else if (std::strcmp(argv[i], "--betting") == 0 && hasValue && std::strcmp(argv[i + 1], "proportional") == 0)
+        {
+            betting = BETTING::PROPORTIONAL;
+            i++;
+        }
+        else if (std::strcmp(argv[i], "--divisor") == 0 && hasValue)
+            divisor = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--min-bet") == 0 && hasValue)
+            minimumBet = std::atoi(argv[++i]);
+        else
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    bool validRules = rules.deckCount > 0 && rules.deckCount <= ShoeComposition::maxDecks && rules.blackjackDenominator > 0 && rules.penetration > 0 && rules.penetration < 1;
+    bool validShuffle = shuffleModel.clumping >= 0 && shuffleModel.clumping < 1;
+    if (rounds <= 0 || players <= 0 || bet <= 0 || !validRules || !validShuffle)
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // The golden runs bring their own tables, so every other option but the seed is ignored
+    if (!goldenWritePath.empty() || !goldenCheckPath.empty())
+    {
+        try
+        {
+            if (!goldenWritePath.empty())
+            {
+                std::cout << "Seed: " << seed << "\n";
+                GoldenRun::write(goldenWritePath, seed, std::cout);
+            }
+            if (!goldenCheckPath.empty())
+            {
+                int failures = GoldenRun::check(goldenCheckPath, std::cout);
+                std::cout << (failures == 0 ? "Every golden run matches\n" : std::to_string(failures) + " golden runs don't match\n");
+                return failures == 0 ? 0 : 1;
+            }
+        }
+        catch (const std::runtime_error &error)
+        {
+            std::cerr << error.what() << "\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    if (printChart)
+    {
+        auto start = std::chrono::steady_clock::now();
+        StrategyChart chart = StrategyGenerator::generate(rules, threads);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "// " << rules.describe() << ", generated in " << seconds << " seconds\n";
+        StrategyGenerator::writeSource(chart, "generatedChart", std::cout);
+        return 0;
+    }
+
+    // A session seats one player at its own table, so --players doesn't apply
+    if (bankroll > 0)
+    {
+        if (sessions <= 0 || divisor <= 0 || minimumBet <= 0)
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+        BettingPolicy policy = betting == BETTING::FLAT ? BettingPolicy::flat(bet) : BettingPolicy::proportional(divisor, minimumBet);
+        runBankroll(rules, policy, bankroll, threads, seed, backend, sessions, rounds, chartDirectory);
+        return 0;
+    }
+
+    // Run every preset back to back with the same seed, one line each
+    if (allPresets)
+    {
+        std::cout << "Seed: " << seed << "  Strategy: " << StrategyBackend::toString(backend) << "  Rounds: " << rounds << "\n";
+        for (PRESET preset : RulePreset::allPresets)
+        {
+            TableRules presetRules = TableRules::fromPreset(preset);
+            SimulationResult result = runRules(presetRules, players, threads, seed, bet, backend, rounds, chartDirectory, backgroundShuffle, shuffleModel);
+            double standardError = std::sqrt(result.variance() / result.hands);
+
+            std::cout << std::left << std::setw(16) << RulePreset::toString(preset) << std::setw(36) << presetRules.describe()
+                      << std::right << std::fixed << std::setprecision(4)
+                      << std::setw(8) << result.houseEdge() * 100 << "% (+/- " << standardError * 100 << "%)  "
+                      << std::setprecision(0) << result.roundsPerSecond() << " rounds/sec\n"
+                      << std::defaultfloat;
+        }
+        return 0;
+    }
+
+    MonteCarloRunner runner(players, rules, threads, seed, bet, backend);
+    runner.setBackgroundShuffle(backgroundShuffle);
+    runner.setShuffleModel(shuffleModel);
+    runner.setHistoryPath(historyPath);
+
+    std::string chartSource = "hand written tables";
+    if (!chartDirectory.empty())
+    {
+        auto start = std::chrono::steady_clock::now();
+        bool generated;
+        runner.setChart(StrategyGenerator::loadOrGenerate(rules, chartDirectory, generated));
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        chartSource = generated ? "generated in " + std::to_string(seconds) + " seconds" : "loaded from " + chartDirectory;
+    }
+
+    SimulationResult result;
+    try
+    {
+        result = runner.run(rounds);
+    }
+    catch (const std::runtime_error &error)
+    {
+        std::cerr << error.what() << "\n";
+        return 1;
+    }
+
+    double standardError = std::sqrt(result.variance() / result.hands);
+
+    std::cout << "Seed:         " << seed << "\n"
+              << "Threads:      " << runner.getThreadCount() << "\n"
+              << "Strategy:     " << StrategyBackend::toString(backend) << "\n"
+              << "Rules:        " << rules.describe() << "\n"
+              << "Chart:        " << chartSource << "\n"
+              << "Shuffling:    " << shuffleModel.describe() << (backgroundShuffle ? ", in the background" : "") << "\n"
+              << "History:      " << (historyPath.empty() ? "not recorded" : runner.getHistoryPath(0) + (runner.getThreadCount() > 1 ? " and on" : "")) << "\n"
+              << "Rounds:       " << result.rounds << "\n"
+              << "Hands:        " << result.hands << "\n"
+              << "Seconds:      " << result.seconds << "\n"
+              << "Rounds/sec:   " << result.roundsPerSecond() << "\n"
+              << "Hands/sec:    " << result.handsPerSecond() << "\n"
+              << std::setprecision(10)
+              << "House edge:   " << result.houseEdge() * 100 << "% (+/- " << standardError * 100 << "%)\n"
+              << "Variance:     " << result.variance() << "\n";
+    return 0;
+}
@@ -0,0 +1,366 @@
+/**
+ * @brief Implementation of The SocketServer class. It lets remote players sit at the tables of a TableServer over a socket from one epoll loop
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/12/2025
+ */
+
+#include "socketserver.h"
+#include "handhistory.h"
+#include <cerrno>
+#include <cstring>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/**
+ * @brief readSize How many bytes are read from a socket at a time
+ */
+static constexpr std::size_t readSize = 4096;
+
+/**
+ * @brief epollBatch The most descriptors handled for each epoll_wait
+ */
+static constexpr int epollBatch = 256;
+
+/**
+ * @brief systemError Gets the exception for a failed system call
+ * @param what What was being done
+ * @return The exception with errno's message
+ */
+static std::runtime_error systemError(const std::string &what)
+{
+    return std::runtime_error("SocketServer: " + what + ": " + std::strerror(errno));
+}
+
+SocketServer::SocketServer(unsigned int workerCount, int tableCapacity, const TableRules &rules, int bots, int money, uint64_t seed)
+    : rules(rules), bots(bots), money(money), seeds(seed), epoll(-1), wake(-1), listener(-1), isUnix(false), connections(tableCapacity)
+{
+    epoll = epoll_create1(EPOLL_CLOEXEC);
+    wake = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epoll < 0 || wake < 0)
+    {
+        if (epoll >= 0)
+            close(epoll);
+        throw systemError("creating epoll");
+    }
+
+    epoll_event watch{};
+    watch.events = EPOLLIN;
+    watch.data.u64 = wakeKey;
+    epoll_ctl(epoll, EPOLL_CTL_ADD, wake, &watch);
+
+    tables = std::make_unique<TableServer>(workerCount, tableCapacity, [this](const TableEvent &event)
+                                           { queueEvent(event); });
+}
+
+SocketServer::~SocketServer()
+{
+    tables.reset();
+    for (Connection &connection : connections)
+        if (connection.descriptor >= 0)
+            close(connection.descriptor);
+    if (listener >= 0)
+        close(listener);
+    close(wake);
+    close(epoll);
+}
+
+void SocketServer::listen(const SocketEndpoint &endpoint)
+{
+    isUnix = !endpoint.unixPath.empty();
+    listener = socket(isUnix ? AF_UNIX : AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listener < 0)
+        throw systemError("creating socket");
+
+    int bound;
+    if (isUnix)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (endpoint.unixPath.size() >= sizeof(address.sun_path))
+            throw std::runtime_error("SocketServer: socket path is too long");
+        std::memcpy(address.sun_path, endpoint.unixPath.c_str(), endpoint.unixPath.size() + 1);
+        unlink(address.sun_path);
+        bound = bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address));
+    }
+    else
+    {
+        int reuse = 1;
+        setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(endpoint.port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bound = bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address));
+    }
+    if (bound < 0 || ::listen(listener, SOMAXCONN) < 0)
+        throw systemError("listening on " + endpoint.describe());
+
+    epoll_event watch{};
+    watch.events = EPOLLIN;
+    watch.data.u64 = listenKey;
+    epoll_ctl(epoll, EPOLL_CTL_ADD, listener, &watch);
+}
+
+void SocketServer::run()
+{
+    epoll_event ready[epollBatch];
+    while (!stopping.load(std::memory_order_acquire))
+    {
+        int count = epoll_wait(epoll, ready, epollBatch, -1);
+        if (count < 0 && errno != EINTR)
+            throw systemError("waiting on epoll");
+
+        bool eventsQueued = false;
+        for (int i = 0; i < count; i++)
+        {
+            uint64_t key = ready[i].data.u64;
+            if (key == listenKey)
+                acceptPlayers();
+            else if (key == wakeKey)
+            {
+                uint64_t signals;
+                while (read(wake, &signals, sizeof(signals)) > 0)
+                {
+                }
+                eventsQueued = true;
+            }
+            else
+            {
+                // A connection closed earlier in the batch may still have its events in it
+                int table = static_cast<int>(key);
+                if (connections[table].descriptor < 0)
+                    continue;
+                if (ready[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+                    readRequests(table);
+                if ((ready[i].events & EPOLLOUT) && connections[table].descriptor >= 0)
+                    flush(table);
+            }
+        }
+
+        // Requests just submitted are often answered by now, so their events go out in the same batch
+        if (eventsQueued)
+            deliverEvents();
+    }
+}
+
+void SocketServer::stop()
+{
+    stopping.store(true, std::memory_order_release);
+    uint64_t signal = 1;
+    ssize_t written = write(wake, &signal, sizeof(signal));
+    (void)written;
+}
+
+TableStats SocketServer::getStats() const
+{
+    return tables->getStats();
+}
+
+int SocketServer::getConnectionCount() const
+{
+    return connectionCount.load(std::memory_order_relaxed);
+}
+
+unsigned int SocketServer::getWorkerCount() const
+{
+    return tables->getWorkerCount();
+}
+
+long long SocketServer::getFramesWritten() const
+{
+    return framesWritten.load(std::memory_order_relaxed);
+}
+
+long long SocketServer::getWrites() const
+{
+    return writes.load(std::memory_order_relaxed);
+}
+
+void SocketServer::queueEvent(const TableEvent &event)
+{
+    uint8_t frame[Varint::maxBytes + TableProtocol::maxFrameBytes];
+    uint8_t *end = Varint::write(frame, static_cast<uint64_t>(event.table));
+
+    // A table given back is marked with an empty frame, which no event encodes to
+    if (event.seat < 0)
+        *end++ = 0;
+    else
+        end = TableProtocol::writeEvent(end, event);
+
+    bool wasEmpty;
+    {
+        std::lock_guard<std::mutex> guard(outboxLock);
+        wasEmpty = outbox.empty();
+        outbox.insert(outbox.end(), frame, end);
+    }
+
+    // Only the first event of a batch wakes run, the rest ride along
+    if (wasEmpty)
+    {
+        uint64_t signal = 1;
+        ssize_t written = write(wake, &signal, sizeof(signal));
+        (void)written;
+    }
+}
+
+void SocketServer::acceptPlayers()
+{
+    while (true)
+    {
+        int descriptor = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (descriptor < 0)
+            return;
+        if (!isUnix)
+        {
+            int noDelay = 1;
+            setsockopt(descriptor, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+        }
+
+        std::vector<Player> players;
+        for (int seat = 0; seat <= bots; seat++)
+        {
+            players.emplace_back(money, 0, seat == 0, 1, 0);
+            players[seat].originalHand = true;
+        }
+
+        // The table's first events are queued for this thread, so the connection is in place before they are delivered
+        int table = tables->openTable(std::move(players), rules, seeds());
+        if (table < 0)
+        {
+            close(descriptor);
+            continue;
+        }
+        connections[table].descriptor = descriptor;
+        connectionCount.fetch_add(1, std::memory_order_relaxed);
+
+        epoll_event watch{};
+        watch.events = EPOLLIN;
+        watch.data.u64 = static_cast<uint64_t>(table);
+        epoll_ctl(epoll, EPOLL_CTL_ADD, descriptor, &watch);
+    }
+}
+
+void SocketServer::readRequests(int table)
+{
+    Connection &connection = connections[table];
+    uint8_t buffer[readSize];
+    while (true)
+    {
+        ssize_t count = read(connection.descriptor, buffer, sizeof(buffer));
+        if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            break;
+        if (count <= 0)
+        {
+            closeConnection(table);
+            return;
+        }
+        connection.input.insert(connection.input.end(), buffer, buffer + count);
+    }
+
+    const uint8_t *in = connection.input.data();
+    const uint8_t *end = in + connection.input.size();
+    try
+    {
+        TableAction action;
+        while (TableProtocol::readAction(in, end, action))
+            tables->submit(table, action);
+    }
+    catch (const std::runtime_error &)
+    {
+        closeConnection(table);
+        return;
+    }
+    connection.input.erase(connection.input.begin(), connection.input.begin() + (in - connection.input.data()));
+}
+
+void SocketServer::deliverEvents()
+{
+    {
+        std::lock_guard<std::mutex> guard(outboxLock);
+        draining.swap(outbox);
+    }
+
+    const uint8_t *in = draining.data();
+    const uint8_t *end = in + draining.size();
+    while (in != end)
+    {
+        int table = static_cast<int>(Varint::read(in, end));
+        const uint8_t *frame = in;
+        in += 1 + *in;
+
+        Connection &connection = connections[table];
+        if (frame + 1 == in)
+        {
+            connection.closing = false;
+            continue;
+        }
+        if (connection.descriptor < 0 || connection.closing)
+            continue;
+        connection.output.insert(connection.output.end(), frame, in);
+        framesWritten.fetch_add(1, std::memory_order_relaxed);
+        if (!connection.flushQueued && !connection.waitingToWrite)
+        {
+            connection.flushQueued = true;
+            flushes.push_back(table);
+        }
+    }
+    draining.clear();
+
+    for (int table : flushes)
+    {
+        connections[table].flushQueued = false;
+        if (connections[table].descriptor >= 0)
+            flush(table);
+    }
+    flushes.clear();
+}
+
+void SocketServer::flush(int table)
+{
+    Connection &connection = connections[table];
+    std::size_t sent = 0;
+    while (sent < connection.output.size())
+    {
+        ssize_t count = send(connection.descriptor, connection.output.data() + sent, connection.output.size() - sent, MSG_NOSIGNAL);
+        if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            break;
+        if (count < 0)
+        {
+            closeConnection(table);
+            return;
+        }
+        writes.fetch_add(1, std::memory_order_relaxed);
+        sent += static_cast<std::size_t>(count);
+    }
+    connection.output.erase(connection.output.begin(), connection.output.begin() + sent);
+
+    // Only a full socket is watched for room, so epoll isn't woken for every socket that could take more
+    bool full = !connection.output.empty();
+    if (full != connection.waitingToWrite)
+    {
+        connection.waitingToWrite = full;
+        epoll_event watch{};
+        watch.events = full ? EPOLLIN | EPOLLOUT : EPOLLIN;
+        watch.data.u64 = static_cast<uint64_t>(table);
+        epoll_ctl(epoll, EPOLL_CTL_MOD, connection.descriptor, &watch);
+    }
+}
+
+void SocketServer::closeConnection(int table)
+{
+    Connection &connection = connections[table];
+    close(connection.descriptor);
+    connection = Connection();
+    connection.closing = true;
+    connectionCount.fetch_sub(1, std::memory_order_relaxed);
+
+    // The table's id is used again once it is given back
+    tables->closeTable(table);
+}
@@ -0,0 +1,263 @@
+#ifndef SOCKETSERVER_H
+#define SOCKETSERVER_H
+
+#include "tableprotocol.h"
+#include "tableserver.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief The SocketServer class lets remote players sit at the tables of a TableServer over a Unix domain socket or loopback TCP,
+ * speaking TableProtocol. Every connection gets a table of its own with the player in the first seat and bots in the rest,
+ * closed when the player leaves so its id goes to the next player to connect.
+ * One thread runs every socket from an epoll loop with non blocking reads and writes. Events the workers send are queued together
+ * and written out a batch at a time, one write per connection however many frames it has waiting. Linux only
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/12/2025
+ */
+class SocketServer
+{
+public:
+    /**
+     * @brief SocketServer Constructor that starts the table workers. Throws std::runtime_error if the epoll or wake up descriptors can't be made
+     * @param workerCount The number of worker threads, 0 uses every hardware thread
+     * @param tableCapacity The most players connected at once, one table each
+     * @param rules The house rules of every table
+     * @param bots The number of bot seats at each table
+     * @param money The money every seat starts with
+     * @param seed The seed the tables' shoes are seeded from
+     */
+    SocketServer(unsigned int workerCount, int tableCapacity, const TableRules &rules, int bots, int money, uint64_t seed);
+
+    /**
+     * @brief ~SocketServer Destructor that stops the workers and closes every socket
+     */
+    ~SocketServer();
+
+    SocketServer(const SocketServer &) = delete;
+    SocketServer &operator=(const SocketServer &) = delete;
+
+    /**
+     * @brief listen Starts listening for players. Throws std::runtime_error if the endpoint can't be bound
+     * @param endpoint Where to listen, a Unix domain socket path is replaced if it exists
+     */
+    void listen(const SocketEndpoint &endpoint);
+
+    /**
+     * @brief run Serves the players on the calling thread until stop is called
+     */
+    void run();
+
+    /**
+     * @brief stop Makes run return. Safe to call from any thread
+     */
+    void stop();
+
+    /**
+     * @brief getStats Adds up the work the tables have done so far
+     * @return The counts and the latency of the actions
+     */
+    TableStats getStats() const;
+
+    /**
+     * @brief getConnectionCount Gets the number of players connected
+     * @return The number of connections
+     */
+    int getConnectionCount() const;
+
+    /**
+     * @brief getWorkerCount Gets the number of table worker threads
+     * @return The number of workers
+     */
+    unsigned int getWorkerCount() const;
+
+    /**
+     * @brief getFramesWritten Gets the number of event frames written to players
+     * @return The number of frames
+     */
+    long long getFramesWritten() const;
+
+    /**
+     * @brief getWrites Gets the number of writes the frames took, fewer than the frames when they were batched
+     * @return The number of writes
+     */
+    long long getWrites() const;
+
+private:
+    /**
+     * @brief The Connection struct is one player's socket, only touched by the thread in run
+     */
+    struct Connection
+    {
+        /**
+         * @brief descriptor The socket, -1 once it is closed
+         */
+        int descriptor = -1;
+
+        /**
+         * @brief input Bytes read that don't make up a whole frame yet
+         */
+        std::vector<uint8_t> input;
+
+        /**
+         * @brief output Bytes waiting to be written
+         */
+        std::vector<uint8_t> output;
+
+        /**
+         * @brief waitingToWrite True while the socket is full and epoll is watching for room
+         */
+        bool waitingToWrite = false;
+
+        /**
+         * @brief flushQueued True while the connection is in the list to write at the end of the batch
+         */
+        bool flushQueued = false;
+
+        /**
+         * @brief closing True from the player leaving until the table is given back, so the events it sent before closing aren't delivered
+         * to the next player given its id
+         */
+        bool closing = false;
+    };
+
+    /**
+     * @brief listenKey The epoll key of the listening socket, past any table id
+     */
+    static constexpr uint64_t listenKey = UINT64_MAX;
+
+    /**
+     * @brief wakeKey The epoll key of the wake up descriptor
+     */
+    static constexpr uint64_t wakeKey = UINT64_MAX - 1;
+
+    /**
+     * @brief rules The house rules of every table
+     */
+    TableRules rules;
+
+    /**
+     * @brief bots The number of bot seats at each table
+     */
+    int bots;
+
+    /**
+     * @brief money The money every seat starts with
+     */
+    int money;
+
+    /**
+     * @brief seeds Gives each table the seed of its shoe
+     */
+    Rng seeds;
+
+    /**
+     * @brief epoll The epoll descriptor
+     */
+    int epoll;
+
+    /**
+     * @brief wake An eventfd written to wake run when events are queued or it should stop
+     */
+    int wake;
+
+    /**
+     * @brief listener The listening socket, -1 before listen
+     */
+    int listener;
+
+    /**
+     * @brief isUnix True if the listening socket is a Unix domain socket
+     */
+    bool isUnix;
+
+    /**
+     * @brief connections Every connection by its table's id
+     */
+    std::vector<Connection> connections;
+
+    /**
+     * @brief flushes The connections with bytes to write at the end of the batch
+     */
+    std::vector<int> flushes;
+
+    /**
+     * @brief outboxLock Held to queue events or take the queue
+     */
+    std::mutex outboxLock;
+
+    /**
+     * @brief outbox Encoded events waiting for run, each the table's id as a varint then the frame
+     */
+    std::vector<uint8_t> outbox;
+
+    /**
+     * @brief draining The events run is writing out, swapped with the outbox so workers queue into an empty one
+     */
+    std::vector<uint8_t> draining;
+
+    /**
+     * @brief stopping True once stop has been called
+     */
+    std::atomic<bool> stopping{false};
+
+    /**
+     * @brief connectionCount The number of players connected
+     */
+    std::atomic<int> connectionCount{0};
+
+    /**
+     * @brief framesWritten The number of event frames written
+     */
+    std::atomic<long long> framesWritten{0};
+
+    /**
+     * @brief writes The number of writes made
+     */
+    std::atomic<long long> writes{0};
+
+    /**
+     * @brief tables The tables the players sit at, last so its workers stop before anything they queue to is freed
+     */
+    std::unique_ptr<TableServer> tables;
+
+    /**
+     * @brief queueEvent Encodes an event for run to write, called on a worker thread
+     * @param event The event
+     */
+    void queueEvent(const TableEvent &event);
+
+    /**
+     * @brief acceptPlayers Accepts every waiting connection and opens a table for each
+     */
+    void acceptPlayers();
+
+    /**
+     * @brief readRequests Reads what a player has sent and submits each whole request to its table
+     * @param table The table's id
+     */
+    void readRequests(int table);
+
+    /**
+     * @brief deliverEvents Moves the queued events into their connections' output and writes each connection once
+     */
+    void deliverEvents();
+
+    /**
+     * @brief flush Writes as much of a connection's output as the socket takes, watching for room if some is left
+     * @param table The table's id
+     */
+    void flush(int table);
+
+    /**
+     * @brief closeConnection Closes a player's socket. Its table stays open but is never sent anything again
+     * @param table The table's id
+     */
+    void closeConnection(int table);
+};
+
+#endif // SOCKETSERVER_H
@@ -0,0 +1,94 @@
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @brief The SpscRing class is a fixed size, lock free queue for exactly one producer thread and one consumer thread.
+ * The producer only writes the tail and the consumer only writes the head, so neither side ever waits on a lock.
+ * The two indices sit on separate cache lines so the threads don't fight over one line
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/4/2025
+ * @tparam T The type of item queued, moved in and out of the ring
+ * @tparam Capacity The number of slots, a power of two
+ */
+template <typename T, std::size_t Capacity>
+class SpscRing
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+    /**
+     * @brief tryPush Adds an item to the back of the ring. Only the producer thread may call this
+     * @param value The item, moved from if there was room
+     * @return False if the ring was full
+     */
+    bool tryPush(T &value)
+    {
+        std::size_t writeIndex = tail.load(std::memory_order_relaxed);
+        if (writeIndex - head.load(std::memory_order_acquire) == Capacity)
+            return false;
+
+        items[writeIndex & (Capacity - 1)] = std::move(value);
+        tail.store(writeIndex + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief tryPop Takes the item at the front of the ring. Only the consumer thread may call this
+     * @param value Set to the item if there was one
+     * @return False if the ring was empty
+     */
+    bool tryPop(T &value)
+    {
+        std::size_t readIndex = head.load(std::memory_order_relaxed);
+        if (readIndex == tail.load(std::memory_order_acquire))
+            return false;
+
+        value = std::move(items[readIndex & (Capacity - 1)]);
+        head.store(readIndex + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief size Gets the number of items in the ring. An upper bound for the producer and a lower bound for the consumer, since the other thread may change it
+     */
+    std::size_t size() const { return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire); }
+
+    /**
+     * @brief empty Checks if the ring has no items. Exact for the consumer, may be out of date for the producer
+     */
+    bool empty() const { return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire); }
+
+    /**
+     * @brief full Checks if the ring has no free slots. Exact for the producer, may be out of date for the consumer
+     */
+    bool full() const { return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire) == Capacity; }
+
+private:
+    /**
+     * @brief cacheLine The size the indices are padded to
+     */
+    static constexpr std::size_t cacheLine = 64;
+
+    /**
+     * @brief items The slots, indexed by the low bits of head and tail. Not named slots, which Qt defines as a macro
+     */
+    std::array<T, Capacity> items;
+
+    /**
+     * @brief head The number of items ever popped, written by the consumer
+     */
+    alignas(cacheLine) std::atomic<std::size_t> head{0};
+
+    /**
+     * @brief tail The number of items ever pushed, written by the producer
+     */
+    alignas(cacheLine) std::atomic<std::size_t> tail{0};
+};
+
+#endif // SPSCRING_H
@@ -7,51 +7,26 @@
 
 #include "statistics.h"
 
-const MOVE Statistics::HardTable[17][10] = {
-    {MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                               // Hard 5
-    {MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                               // Hard 6
-    {MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                               // Hard 7
-    {MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                               // Hard 8
-    {MOVE::HIT, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                   // Hard 9
-    {MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT},       // Hard 10
-    {MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE}, // Hard 11
-    {MOVE::HIT, MOVE::HIT, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                         // Hard 12
-    {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                     // Hard 13
-    {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                     // Hard 14
-    {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                     // Hard 15
-    {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                     // Hard 16
-    {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND},           // Hard 17
-    {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND},           // Hard 18
-    {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND},           // Hard 19
-    {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND},           // Hard 20
-    {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND}            // Hard 21
-};
-
-const MOVE Statistics::SoftTable[9][10] = {
-    {MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                // A,2
-    {MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                // A,3
-    {MOVE::HIT, MOVE::HIT, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},             // A,4
-    {MOVE::HIT, MOVE::HIT, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},             // A,5
-    {MOVE::HIT, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},          // A,6
-    {MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::STAND, MOVE::STAND, MOVE::HIT, MOVE::HIT, MOVE::HIT},   // A,7
-    {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::DOUBLE, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND}, // A,8
-    {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND},  // A,9
-    {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND}   // A,10 (multi-card soft 21)
-};
-
-const MOVE Statistics::PairTable[10][10] = {
-    {MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},             // 2,2
-    {MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},             // 3,3
-    {MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                     // 4,4
-    {MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT}, // 5,5
-    {MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},               // 6,6
-    {MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},             // 7,7
-    {MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT},     // 8,8
-    {MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::STAND, MOVE::SPLIT, MOVE::SPLIT, MOVE::STAND, MOVE::STAND},     // 9,9
-    {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND},     // 10,10 (10, J, Q, K)
-    {MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT}      // A,A
-};
-
 Statistics::Statistics()
 {
 }
+
+const Deviation Statistics::Deviations[deviationCount] = {
+    {false, 16, 10, 0, MOVE::STAND, MOVE::HIT},   // 16 vs 10
+    {false, 15, 10, 4, MOVE::STAND, MOVE::HIT},   // 15 vs 10
+    {true, 10, 5, 5, MOVE::SPLIT, MOVE::STAND},   // 10,10 vs 5
+    {true, 10, 6, 4, MOVE::SPLIT, MOVE::STAND},   // 10,10 vs 6
+    {false, 10, 10, 4, MOVE::DOUBLE, MOVE::HIT},  // 10 vs 10
+    {false, 12, 3, 2, MOVE::STAND, MOVE::HIT},    // 12 vs 3
+    {false, 12, 2, 3, MOVE::STAND, MOVE::HIT},    // 12 vs 2
+    {false, 11, 11, 1, MOVE::DOUBLE, MOVE::HIT},  // 11 vs A
+    {false, 9, 2, 1, MOVE::DOUBLE, MOVE::HIT},    // 9 vs 2
+    {false, 10, 11, 4, MOVE::DOUBLE, MOVE::HIT},  // 10 vs A
+    {false, 9, 7, 3, MOVE::DOUBLE, MOVE::HIT},    // 9 vs 7
+    {false, 16, 9, 5, MOVE::STAND, MOVE::HIT},    // 16 vs 9
+    {false, 13, 2, -1, MOVE::STAND, MOVE::HIT},   // 13 vs 2
+    {false, 12, 4, 0, MOVE::STAND, MOVE::HIT},    // 12 vs 4
+    {false, 12, 5, -2, MOVE::STAND, MOVE::HIT},   // 12 vs 5
+    {false, 12, 6, -1, MOVE::STAND, MOVE::HIT},   // 12 vs 6
+    {false, 13, 3, -2, MOVE::STAND, MOVE::HIT}    // 13 vs 3
+};
@@ -1,7 +1,7 @@
 #ifndef STATISTICS_H
 #define STATISTICS_H
 
-#include <QObject>
+#include <string>
 
 namespace Move
 {
@@ -17,7 +17,8 @@ namespace Move
         HIT,
         DOUBLE,
         SPLIT,
-        STAND
+        STAND,
+        SURRENDER
     };
 
     /**
@@ -37,6 +38,8 @@ namespace Move
             return "Split";
         case MOVE::STAND:
             return "Stand";
+        case MOVE::SURRENDER:
+            return "Surrender";
         }
 
         return "Unknown move";
@@ -45,6 +48,45 @@ namespace Move
 
 using Move::MOVE;
 
+/**
+ * @brief The Deviation struct is a count indexed change to basic strategy. At or above the index the hand plays atOrAbove, below it plays below
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/28/2025
+ */
+struct Deviation
+{
+    /**
+     * @brief pair True if the deviation is for a pair, false for a hard total
+     */
+    bool pair;
+
+    /**
+     * @brief total The hard total of the hand, or the value of one card of the pair
+     */
+    int total;
+
+    /**
+     * @brief dealerValue The blackjack value of the dealer's up card, 11 for an ace
+     */
+    int dealerValue;
+
+    /**
+     * @brief index The Hi-Lo true count the deviation switches at
+     */
+    int index;
+
+    /**
+     * @brief atOrAbove The move when the true count is at or above the index
+     */
+    MOVE atOrAbove;
+
+    /**
+     * @brief below The move when the true count is below the index
+     */
+    MOVE below;
+};
+
 /**
  * @brief The Statistics class A class that holds the tables of correct moves for blackjack
  *
@@ -63,17 +105,66 @@ public:
     /**
      * @brief HardTable The table for hard hand's correct moves
      */
-    static const MOVE HardTable[17][10];
+    static constexpr MOVE HardTable[17][10] = {
+        {MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                               // Hard 5
+        {MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                               // Hard 6
+        {MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                               // Hard 7
+        {MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                               // Hard 8
+        {MOVE::HIT, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                   // Hard 9
+        {MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT},       // Hard 10
+        {MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE}, // Hard 11
+        {MOVE::HIT, MOVE::HIT, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                         // Hard 12
+        {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                     // Hard 13
+        {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                     // Hard 14
+        {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                     // Hard 15
+        {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                     // Hard 16
+        {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND},           // Hard 17
+        {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND},           // Hard 18
+        {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND},           // Hard 19
+        {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND},           // Hard 20
+        {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND}            // Hard 21
+    };
 
     /**
      * @brief SoftTable The table for soft hand's correct moves
      */
-    static const MOVE SoftTable[9][10];
+    static constexpr MOVE SoftTable[9][10] = {
+        {MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                // A,2
+        {MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                // A,3
+        {MOVE::HIT, MOVE::HIT, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},             // A,4
+        {MOVE::HIT, MOVE::HIT, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},             // A,5
+        {MOVE::HIT, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},          // A,6
+        {MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::STAND, MOVE::STAND, MOVE::HIT, MOVE::HIT, MOVE::HIT},   // A,7
+        {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::DOUBLE, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND}, // A,8
+        {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND},  // A,9
+        {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND}   // A,10 (multi-card soft 21)
+    };
 
     /**
      * @brief PairTable The table for pair hand's correct moves
      */
-    static const MOVE PairTable[10][10];
+    static constexpr MOVE PairTable[10][10] = {
+        {MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},             // 2,2
+        {MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},             // 3,3
+        {MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},                     // 4,4
+        {MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::DOUBLE, MOVE::HIT, MOVE::HIT}, // 5,5
+        {MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},               // 6,6
+        {MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::HIT, MOVE::HIT, MOVE::HIT, MOVE::HIT},             // 7,7
+        {MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT},     // 8,8
+        {MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::STAND, MOVE::SPLIT, MOVE::SPLIT, MOVE::STAND, MOVE::STAND},     // 9,9
+        {MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND, MOVE::STAND},     // 10,10 (10, J, Q, K)
+        {MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT, MOVE::SPLIT}      // A,A
+    };
+
+    /**
+     * @brief deviationCount The number of entries in Deviations
+     */
+    static constexpr int deviationCount = 17;
+
+    /**
+     * @brief Deviations The Illustrious 18 Hi-Lo index plays for a dealer standing on soft 17. Insurance is left out since the game doesn't offer it
+     */
+    static const Deviation Deviations[deviationCount];
 };
 
 #endif // STATISTICS_H
@@ -0,0 +1,18 @@
+/**
+ * @brief Implementation of The StrategyChart struct. It holds a full basic strategy chart
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/30/2025
+ */
+
+#include "strategychart.h"
+
+bool operator==(const StrategyChart &left, const StrategyChart &right)
+{
+    return left.hard == right.hard && left.soft == right.soft && left.pair == right.pair && left.surrenderHard == right.surrenderHard && left.surrenderPair == right.surrenderPair;
+}
+
+bool operator!=(const StrategyChart &left, const StrategyChart &right)
+{
+    return !(left == right);
+}
@@ -0,0 +1,129 @@
+#ifndef STRATEGYCHART_H
+#define STRATEGYCHART_H
+
+#include "statistics.h"
+#include <array>
+
+/**
+ * @brief The StrategyChart struct holds a full basic strategy chart: the hard, soft and pair tables laid out like the ones in Statistics,
+ * plus which hard totals and pairs should surrender. Rows and columns are indexed like the Statistics tables and ShoeComposition,
+ * with the dealer's up card from 0 (two) to 9 (ace). It is a literal type, so a chart can be written out as a constexpr initializer
+ * and every lookup is a plain array index
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/30/2025
+ */
+struct StrategyChart
+{
+    /**
+     * @brief hardRows The number of hard totals in the chart, 5 to 21
+     */
+    static constexpr int hardRows = 17;
+
+    /**
+     * @brief softRows The number of soft totals in the chart, A,2 to A,10
+     */
+    static constexpr int softRows = 9;
+
+    /**
+     * @brief pairRows The number of pairs in the chart, 2,2 to A,A
+     */
+    static constexpr int pairRows = 10;
+
+    /**
+     * @brief dealerColumns The number of dealer up cards
+     */
+    static constexpr int dealerColumns = 10;
+
+    /**
+     * @brief Table A table of moves by row and dealer up card
+     */
+    template <int Rows>
+    using Table = std::array<std::array<MOVE, dealerColumns>, Rows>;
+
+    /**
+     * @brief Flags A table of yes or no decisions by row and dealer up card
+     */
+    template <int Rows>
+    using Flags = std::array<std::array<bool, dealerColumns>, Rows>;
+
+    /**
+     * @brief hard The moves for hard totals. Never SURRENDER, see surrenderHard
+     */
+    Table<hardRows> hard{};
+
+    /**
+     * @brief soft The moves for soft totals
+     */
+    Table<softRows> soft{};
+
+    /**
+     * @brief pair The moves for pairs. Never SURRENDER, see surrenderPair
+     */
+    Table<pairRows> pair{};
+
+    /**
+     * @brief surrenderHard True where a two card hard total should surrender when it is allowed to
+     */
+    Flags<hardRows> surrenderHard{};
+
+    /**
+     * @brief surrenderPair True where a pair should surrender when it is allowed to
+     */
+    Flags<pairRows> surrenderPair{};
+
+    /**
+     * @brief hardMove Looks up the move for a hard total
+     * @param total The hard total, 5 to 21
+     * @param dealerIndex The index of the dealer's up card
+     * @return The move from the chart
+     */
+    constexpr MOVE hardMove(int total, int dealerIndex) const { return hard[total - 5][dealerIndex]; }
+
+    /**
+     * @brief softMove Looks up the move for a soft total
+     * @param total The soft total, 13 to 21
+     * @param dealerIndex The index of the dealer's up card
+     * @return The move from the chart
+     */
+    constexpr MOVE softMove(int total, int dealerIndex) const { return soft[total - 13][dealerIndex]; }
+
+    /**
+     * @brief pairMove Looks up the move for a pair
+     * @param pairIndex The index of one card of the pair
+     * @param dealerIndex The index of the dealer's up card
+     * @return The move from the chart
+     */
+    constexpr MOVE pairMove(int pairIndex, int dealerIndex) const { return pair[pairIndex][dealerIndex]; }
+
+    /**
+     * @brief fromStatistics Copies the hand written tables in Statistics into a chart. They have no surrender entries
+     * @return The chart the game has always played by
+     */
+    static constexpr StrategyChart fromStatistics()
+    {
+        StrategyChart chart;
+        for (int dealer = 0; dealer < dealerColumns; dealer++)
+        {
+            for (int row = 0; row < hardRows; row++)
+                chart.hard[row][dealer] = Statistics::HardTable[row][dealer];
+            for (int row = 0; row < softRows; row++)
+                chart.soft[row][dealer] = Statistics::SoftTable[row][dealer];
+            for (int row = 0; row < pairRows; row++)
+                chart.pair[row][dealer] = Statistics::PairTable[row][dealer];
+        }
+        return chart;
+    }
+};
+
+/**
+ * @brief operator == Checks if two charts make every decision the same way
+ */
+bool operator==(const StrategyChart &left, const StrategyChart &right);
+
+/**
+ * @brief operator != Checks if two charts differ anywhere
+ */
+bool operator!=(const StrategyChart &left, const StrategyChart &right);
+
+#endif // STRATEGYCHART_H
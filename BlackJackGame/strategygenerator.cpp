@@ -0,0 +1,414 @@
+/**
+ * @brief Implementation of The StrategyGenerator class. It computes the basic strategy chart for a set of house rules and caches charts on disk
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/30/2025
+ */
+
+#include "strategygenerator.h"
+#include "evengine.h"
+#include "hand.h"
+#include "shoecomposition.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief fileMagic The first bytes of every chart file
+ */
+static const char fileMagic[4] = {'B', 'J', 'S', 'C'};
+
+/**
+ * @brief fileVersion The version of the chart file layout, bumped whenever the layout or the generator's results change
+ */
+static const uint8_t fileVersion = 2;
+
+/**
+ * @brief moveCells The number of moves in a chart
+ */
+static const int moveCells = (StrategyChart::hardRows + StrategyChart::softRows + StrategyChart::pairRows) * StrategyChart::dealerColumns;
+
+/**
+ * @brief flagCells The number of surrender flags in a chart
+ */
+static const int flagCells = (StrategyChart::hardRows + StrategyChart::pairRows) * StrategyChart::dealerColumns;
+
+/**
+ * @brief headerSize The magic, version, deck count and rule flags
+ */
+static const std::size_t headerSize = 7;
+
+/**
+ * @brief fileSize The size of a chart file: the header, four moves per byte, eight flags per byte and a 32 bit checksum
+ */
+static const std::size_t fileSize = headerSize + (moveCells + 3) / 4 + (flagCells + 7) / 8 + 4;
+
+/**
+ * @brief splitHands Gets the most hands a split is solved for under a set of rules, see SplitOutcome::mostHands
+ * @param rules The house rules
+ * @return The most hands, from 1 to SplitOutcome::mostHands
+ */
+static int splitHands(const TableRules &rules)
+{
+    return rules.maxSplitHands == 0 ? SplitOutcome::mostHands : std::min(rules.maxSplitHands, SplitOutcome::mostHands);
+}
+
+/**
+ * @brief ruleFlags Packs the rules that change the chart into a byte
+ * @param rules The house rules
+ * @return The packed rules
+ */
+static uint8_t ruleFlags(const TableRules &rules)
+{
+    return static_cast<uint8_t>(rules.dealerHitsSoft17 | rules.doubleAfterSplit << 1 | rules.surrender << 2 | rules.resplitAces << 3 | rules.hitSplitAces << 4 | splitHands(rules) << 5);
+}
+
+/**
+ * @brief checksum Gets the 32 bit FNV-1a hash of some bytes
+ * @param bytes The bytes to hash
+ * @return The hash
+ */
+static uint32_t checksum(const std::vector<uint8_t> &bytes)
+{
+    uint32_t hash = 2166136261u;
+    for (uint8_t byte : bytes)
+    {
+        hash ^= byte;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief moveNames The enumerator name of each MOVE, for writing charts as source
+ */
+static const char *const moveNames[] = {"HIT", "DOUBLE", "SPLIT", "STAND", "SURRENDER"};
+
+/**
+ * @brief cardOf Gets a card with the value of a ShoeComposition index
+ * @param index The value index
+ * @return A card of that value
+ */
+static Card cardOf(int index)
+{
+    if (index == ShoeComposition::aceIndex)
+        return Card(SUIT::SPADES, RANK::ACE);
+    return Card(SUIT::SPADES, static_cast<RANK>(index));
+}
+
+/**
+ * @brief The CellValues struct adds up the expected values of every hand that lands in one cell of the chart, weighted by how likely each hand is
+ */
+struct CellValues
+{
+    /**
+     * @brief values The weighted sum of the expected values of each move
+     */
+    MoveValues values{0, 0, 0, 0};
+
+    /**
+     * @brief weight The sum of the weights
+     */
+    double weight = 0;
+
+    /**
+     * @brief add Adds a hand's expected values to the cell
+     * @param hand The expected values of the hand
+     * @param handWeight How likely the hand is to be dealt
+     */
+    void add(const MoveValues &hand, double handWeight)
+    {
+        values.stand += handWeight * hand.stand;
+        values.hit += handWeight * hand.hit;
+        values.doubleDown += handWeight * hand.doubleDown;
+        values.split += handWeight * hand.split;
+        weight += handWeight;
+    }
+
+    /**
+     * @brief decide Picks the best move for the cell and whether surrender beats it
+     * @param canSplit True if the cell may split
+     * @param canSurrender True if the rules offer surrender
+     * @param surrender Set to true if surrendering beats the best move
+     * @return The best move other than surrender, STAND for a cell no two card hand lands in
+     */
+    MOVE decide(bool canSplit, bool canSurrender, bool &surrender) const
+    {
+        surrender = false;
+        if (weight == 0)
+            return MOVE::STAND;
+
+        MoveValues average{values.stand / weight, values.hit / weight, values.doubleDown / weight, values.split / weight};
+        average.canDouble = true;
+        average.canSplit = canSplit;
+        MOVE best = average.getBestMove();
+
+        double bestValue = average.stand;
+        if (best == MOVE::HIT)
+            bestValue = average.hit;
+        else if (best == MOVE::DOUBLE)
+            bestValue = average.doubleDown;
+        else if (best == MOVE::SPLIT)
+            bestValue = average.split;
+
+        surrender = canSurrender && average.surrender > bestValue;
+        return best;
+    }
+};
+
+StrategyChart StrategyGenerator::generate(const TableRules &rules, unsigned int threadCount)
+{
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min(threadCount, static_cast<unsigned int>(StrategyChart::dealerColumns));
+
+    // Each thread takes the next up card until they're all done, every column has its own EVEngine so nothing is shared
+    StrategyChart chart;
+    std::atomic<int> nextColumn(0);
+    std::vector<std::thread> workers;
+    for (unsigned int i = 0; i < threadCount; i++)
+    {
+        workers.emplace_back([&rules, &chart, &nextColumn]()
+                             {
+            for (int upIndex = nextColumn++; upIndex < StrategyChart::dealerColumns; upIndex = nextColumn++)
+                generateColumn(rules, upIndex, chart); });
+    }
+
+    for (std::thread &worker : workers)
+        worker.join();
+    return chart;
+}
+
+void StrategyGenerator::generateColumn(const TableRules &rules, int upIndex, StrategyChart &chart)
+{
+    EVEngine engine(rules);
+    ShoeComposition shoe(rules.deckCount);
+    shoe.remove(upIndex);
+
+    // Hard totals are made from the non pairs when there are any, 4 and 20 only come from pairs
+    CellValues hard[22];
+    CellValues hardPairs[22];
+    CellValues soft[StrategyChart::softRows];
+    CellValues pair[StrategyChart::pairRows];
+
+    for (int first = 0; first < ShoeComposition::valueCount; first++)
+    {
+        for (int second = first; second < ShoeComposition::valueCount; second++)
+        {
+            double weight = static_cast<double>(shoe.getCount(first)) * (shoe.getCount(second) - (first == second));
+            if (weight <= 0)
+                continue;
+
+            // Blackjack is paid before anyone plays
+            bool hasAce = second == ShoeComposition::aceIndex;
+            if (hasAce && first == ShoeComposition::tenIndex)
+                continue;
+
+            Hand hand;
+            hand.addCard(cardOf(first));
+            hand.addCard(cardOf(second));
+
+            ShoeComposition unseen = shoe;
+            unseen.remove(first);
+            unseen.remove(second);
+            MoveValues values = engine.evaluate(hand, upIndex, unseen);
+
+            if (first == second)
+            {
+                pair[first].add(values, weight);
+                if (!hasAce)
+                    hardPairs[hand.getTotal()].add(values, weight);
+            }
+            else if (hasAce)
+                soft[hand.getTotal() - 13].add(values, weight);
+            else
+                hard[hand.getTotal()].add(values, weight);
+        }
+    }
+
+    bool surrender;
+    for (int row = 0; row < StrategyChart::hardRows; row++)
+    {
+        int total = row + 5;
+        const CellValues &cell = hard[total].weight > 0 ? hard[total] : hardPairs[total];
+        chart.hard[row][upIndex] = cell.decide(false, rules.surrender, surrender);
+        chart.surrenderHard[row][upIndex] = surrender;
+    }
+
+    for (int row = 0; row < StrategyChart::softRows; row++)
+        chart.soft[row][upIndex] = soft[row].decide(false, false, surrender);
+
+    // A seat limited to one hand can never split
+    for (int row = 0; row < StrategyChart::pairRows; row++)
+    {
+        chart.pair[row][upIndex] = pair[row].decide(rules.maxSplitHands != 1, rules.surrender, surrender);
+        chart.surrenderPair[row][upIndex] = surrender;
+    }
+}
+
+std::string StrategyGenerator::fileName(const TableRules &rules)
+{
+    std::string name = "chart-" + std::to_string(rules.deckCount) + "d";
+    name += rules.dealerHitsSoft17 ? "-h17" : "-s17";
+    name += rules.doubleAfterSplit ? "-das" : "-nodas";
+    name += rules.surrender ? "-ls" : "-nols";
+    name += "-sp" + std::to_string(splitHands(rules));
+    name += rules.resplitAces ? "-rsa" : "";
+    name += rules.hitSplitAces ? "-hsa" : "";
+    return name + ".bin";
+}
+
+bool StrategyGenerator::save(const StrategyChart &chart, const TableRules &rules, const std::string &path)
+{
+    std::vector<uint8_t> bytes(fileMagic, fileMagic + 4);
+    bytes.push_back(fileVersion);
+    bytes.push_back(static_cast<uint8_t>(rules.deckCount));
+    bytes.push_back(ruleFlags(rules));
+
+    // Moves are stored two bits each in the order HIT, DOUBLE, SPLIT, STAND, table by table and row by row
+    std::vector<uint8_t> moves;
+    auto addMoves = [&moves](const auto &table)
+    {
+        for (const auto &row : table)
+            for (MOVE move : row)
+                moves.push_back(static_cast<uint8_t>(move));
+    };
+    addMoves(chart.hard);
+    addMoves(chart.soft);
+    addMoves(chart.pair);
+
+    std::vector<uint8_t> flags;
+    auto addFlags = [&flags](const auto &table)
+    {
+        for (const auto &row : table)
+            for (bool flag : row)
+                flags.push_back(flag);
+    };
+    addFlags(chart.surrenderHard);
+    addFlags(chart.surrenderPair);
+
+    for (int i = 0; i < moveCells; i += 4)
+    {
+        uint8_t packed = 0;
+        for (int j = 0; j < 4 && i + j < moveCells; j++)
+            packed |= static_cast<uint8_t>((moves[i + j] & 3) << (j * 2));
+        bytes.push_back(packed);
+    }
+    for (int i = 0; i < flagCells; i += 8)
+    {
+        uint8_t packed = 0;
+        for (int j = 0; j < 8 && i + j < flagCells; j++)
+            packed |= static_cast<uint8_t>(flags[i + j] << j);
+        bytes.push_back(packed);
+    }
+
+    uint32_t hash = checksum(bytes);
+    for (int i = 0; i < 4; i++)
+        bytes.push_back(static_cast<uint8_t>(hash >> (i * 8)));
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(file);
+}
+
+bool StrategyGenerator::load(const TableRules &rules, const std::string &path, StrategyChart &chart)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (bytes.size() != fileSize || !std::equal(fileMagic, fileMagic + 4, bytes.begin()))
+        return false;
+    if (bytes[4] != fileVersion || bytes[5] != rules.deckCount || bytes[6] != ruleFlags(rules))
+        return false;
+
+    uint32_t stored = 0;
+    for (int i = 0; i < 4; i++)
+        stored |= static_cast<uint32_t>(bytes[fileSize - 4 + i]) << (i * 8);
+    bytes.resize(fileSize - 4);
+    if (checksum(bytes) != stored)
+        return false;
+
+    int cell = 0;
+    auto readMoves = [&bytes, &cell](auto &table)
+    {
+        for (auto &row : table)
+            for (MOVE &move : row)
+            {
+                move = static_cast<MOVE>(bytes[headerSize + cell / 4] >> (cell % 4 * 2) & 3);
+                cell++;
+            }
+    };
+    readMoves(chart.hard);
+    readMoves(chart.soft);
+    readMoves(chart.pair);
+
+    std::size_t flagStart = headerSize + (moveCells + 3) / 4;
+    cell = 0;
+    auto readFlags = [&bytes, &cell, flagStart](auto &table)
+    {
+        for (auto &row : table)
+            for (bool &flag : row)
+            {
+                flag = bytes[flagStart + cell / 8] >> (cell % 8) & 1;
+                cell++;
+            }
+    };
+    readFlags(chart.surrenderHard);
+    readFlags(chart.surrenderPair);
+    return true;
+}
+
+StrategyChart StrategyGenerator::loadOrGenerate(const TableRules &rules, const std::string &directory, bool &generated)
+{
+    std::string path = directory.empty() ? fileName(rules) : directory + "/" + fileName(rules);
+
+    StrategyChart chart;
+    generated = !load(rules, path, chart);
+    if (generated)
+    {
+        // Not being able to write the cache only costs the next run the generation time
+        chart = generate(rules);
+        save(chart, rules, path);
+    }
+    return chart;
+}
+
+void StrategyGenerator::writeSource(const StrategyChart &chart, const std::string &name, std::ostream &out)
+{
+    auto writeMoves = [&out](const char *label, const auto &table)
+    {
+        out << "    // " << label << "\n    {{";
+        for (std::size_t row = 0; row < table.size(); row++)
+        {
+            out << (row == 0 ? "{" : "      {");
+            for (std::size_t column = 0; column < table[row].size(); column++)
+                out << (column == 0 ? "" : ", ") << "MOVE::" << moveNames[static_cast<int>(table[row][column])];
+            out << (row + 1 == table.size() ? "}}},\n" : "},\n");
+        }
+    };
+    auto writeFlags = [&out](const char *label, const auto &table, bool last)
+    {
+        out << "    // " << label << "\n    {{";
+        for (std::size_t row = 0; row < table.size(); row++)
+        {
+            out << (row == 0 ? "{" : "      {");
+            for (std::size_t column = 0; column < table[row].size(); column++)
+                out << (column == 0 ? "" : ", ") << (table[row][column] ? "true" : "false");
+            out << (row + 1 == table.size() ? (last ? "}}}\n" : "}}},\n") : "},\n");
+        }
+    };
+
+    out << "constexpr StrategyChart " << name << " = {\n";
+    writeMoves("Hard 5 to 21", chart.hard);
+    writeMoves("Soft A,2 to A,10", chart.soft);
+    writeMoves("Pairs 2,2 to A,A", chart.pair);
+    writeFlags("Surrender hard 5 to 21", chart.surrenderHard, false);
+    writeFlags("Surrender pairs 2,2 to A,A", chart.surrenderPair, true);
+    out << "};\n";
+}
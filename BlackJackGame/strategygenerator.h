@@ -0,0 +1,81 @@
+#ifndef STRATEGYGENERATOR_H
+#define STRATEGYGENERATOR_H
+
+#include "strategychart.h"
+#include "tablerules.h"
+#include <ostream>
+#include <string>
+
+/**
+ * @brief The StrategyGenerator class computes the basic strategy chart for a set of house rules with EVEngine, and caches charts on disk.
+ * Every cell is the move with the best expected value averaged over each two card hand that lands in it, weighted by how likely that hand
+ * is to be dealt from a full shoe against the up card. Each up card is an independent column, so the columns are spread over threads.
+ * Only the deck count, the dealer's soft 17 rule, surrender and the split rules change the chart, so only they key the cache file
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/30/2025
+ */
+class StrategyGenerator
+{
+public:
+    /**
+     * @brief generate Computes the chart for a set of rules
+     * @param rules The house rules to compute the chart for
+     * @param threadCount The number of worker threads, 0 for every hardware thread
+     * @return The chart
+     */
+    static StrategyChart generate(const TableRules &rules, unsigned int threadCount = 0);
+
+    /**
+     * @brief fileName Gets the name of the cache file for a set of rules, like "chart-6d-s17-das-ls-sp4-rsa.bin"
+     * @param rules The house rules
+     * @return The file name
+     */
+    static std::string fileName(const TableRules &rules);
+
+    /**
+     * @brief save Writes a chart to a compact binary file: a header with the rules, two bits per move, one bit per surrender flag and a checksum
+     * @param chart The chart to write
+     * @param rules The rules the chart was generated for
+     * @param path The file to write
+     * @return True if the file was written
+     */
+    static bool save(const StrategyChart &chart, const TableRules &rules, const std::string &path);
+
+    /**
+     * @brief load Reads a chart written by save
+     * @param rules The rules the chart must have been generated for
+     * @param path The file to read
+     * @param chart Set to the chart if it is read
+     * @return True if the file holds a valid chart for the rules
+     */
+    static bool load(const TableRules &rules, const std::string &path, StrategyChart &chart);
+
+    /**
+     * @brief loadOrGenerate Loads the cached chart for the rules from a directory, generating and caching it if there isn't a valid one
+     * @param rules The house rules
+     * @param directory The cache directory
+     * @param generated Set to true if the chart had to be generated
+     * @return The chart
+     */
+    static StrategyChart loadOrGenerate(const TableRules &rules, const std::string &directory, bool &generated);
+
+    /**
+     * @brief writeSource Writes a chart as a C++ constexpr StrategyChart so it can be compiled in
+     * @param chart The chart to write
+     * @param name The name of the variable
+     * @param out The stream to write to
+     */
+    static void writeSource(const StrategyChart &chart, const std::string &name, std::ostream &out);
+
+private:
+    /**
+     * @brief generateColumn Fills in every cell of the chart for one dealer up card
+     * @param rules The house rules
+     * @param upIndex The index of the up card
+     * @param chart The chart to fill in
+     */
+    static void generateColumn(const TableRules &rules, int upIndex, StrategyChart &chart);
+};
+
+#endif // STRATEGYGENERATOR_H
@@ -0,0 +1,191 @@
+/**
+ * @brief Implementation of The TableMirror class. It rebuilds a table from the events GameState publishes
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/15/2025
+ */
+
+#include "tablemirror.h"
+#include "card.h"
+
+using PlayerStatus::PLAYERSTATUS;
+
+TableMirror::TableMirror() : dealerHand(0) {}
+
+void TableMirror::reset(const std::vector<Player> &players, const Hand &dealerHand)
+{
+    hands.clear();
+    statuses.clear();
+    seats.clear();
+    money.clear();
+    users.clear();
+    this->dealerHand = dealerHand;
+
+    for (const Player &player : players)
+    {
+        // A hand that isn't an original one is split from the seat before it
+        if (player.originalHand || money.empty())
+        {
+            money.push_back(player.money);
+            users.push_back(player.isUser);
+        }
+        hands.push_back(player.hand);
+        statuses.push_back(player.status);
+        seats.push_back(static_cast<int>(money.size()) - 1);
+    }
+
+    lastHands.assign(money.size(), 0);
+    changed.assign(money.size(), true);
+}
+
+void TableMirror::apply(const GameEvent &event)
+{
+    int hand = event.hand;
+    if (event.type == GAMEEVENT::MONEY)
+    {
+        if (hand < getSeatCount())
+        {
+            money[hand] += event.amount;
+            changed[hand] = true;
+        }
+        return;
+    }
+    if (event.type == GAMEEVENT::DEALER_CARD)
+    {
+        dealerHand.addCard(Card::fromCode(event.value));
+        return;
+    }
+    if (event.type == GAMEEVENT::CLEAR)
+    {
+        // Each seat's first hand is its original one, the rest are splits
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < hands.size(); i++)
+        {
+            if (i != 0 && seats[i] == seats[i - 1])
+                continue;
+            hands[kept] = Hand(hands[i].getBet());
+            statuses[kept] = statuses[i];
+            seats[kept] = seats[i];
+            kept++;
+        }
+        hands.resize(kept);
+        statuses.resize(kept);
+        seats.resize(kept);
+        dealerHand = Hand(0);
+        lastHands.assign(money.size(), 0);
+        changed.assign(money.size(), true);
+        return;
+    }
+    if (hand >= getHandCount())
+        return;
+
+    switch (event.type)
+    {
+    case GAMEEVENT::BET:
+        hands[hand].setBet(event.amount);
+        break;
+    case GAMEEVENT::CARD:
+        hands[hand].addCard(Card::fromCode(event.value));
+        break;
+    case GAMEEVENT::STATUS:
+        statuses[hand] = static_cast<PLAYERSTATUS>(event.value);
+        break;
+    case GAMEEVENT::SPLIT:
+    {
+        Hand second(hands[hand].getBet());
+        second.addCard(hands[hand].removeLastCard());
+        hands.insert(hands.begin() + hand + 1, second);
+        statuses.insert(statuses.begin() + hand + 1, PLAYERSTATUS::WAITING);
+        seats.insert(seats.begin() + hand + 1, seats[hand]);
+        break;
+    }
+    default:
+        return;
+    }
+    touch(hand);
+}
+
+bool TableMirror::takeChanged(int seat)
+{
+    if (seat < 0 || seat >= getSeatCount() || !changed[seat])
+        return false;
+    changed[seat] = false;
+    return true;
+}
+
+int TableMirror::getHandCount() const
+{
+    return static_cast<int>(hands.size());
+}
+
+int TableMirror::getSeatCount() const
+{
+    return static_cast<int>(money.size());
+}
+
+int TableMirror::getSeat(int hand) const
+{
+    return seats[hand];
+}
+
+const Hand &TableMirror::getHand(int hand) const
+{
+    return hands[hand];
+}
+
+PLAYERSTATUS TableMirror::getStatus(int hand) const
+{
+    return statuses[hand];
+}
+
+int TableMirror::getMoney(int seat) const
+{
+    return money[seat];
+}
+
+int TableMirror::getLastHand(int seat) const
+{
+    return seatStart(seat) + lastHands[seat];
+}
+
+const Hand &TableMirror::getDealerHand() const
+{
+    return dealerHand;
+}
+
+std::vector<Player> TableMirror::getPlayers() const
+{
+    std::vector<Player> players;
+    players.reserve(hands.size());
+    for (int i = 0; i < getHandCount(); i++)
+    {
+        int seat = seats[i];
+        int start = seatStart(seat);
+        int count = 0;
+        while (start + count < getHandCount() && seats[start + count] == seat)
+            count++;
+
+        // Split hands have no money or hand count of their own
+        Player player(i == start ? money[seat] : 0, hands[i].getBet(), users[seat], i == start ? count : 0, i - start);
+        player.hand = hands[i];
+        player.originalHand = i == start;
+        player.status = statuses[i];
+        players.push_back(player);
+    }
+    return players;
+}
+
+int TableMirror::seatStart(int seat) const
+{
+    int start = 0;
+    while (start < getHandCount() && seats[start] != seat)
+        start++;
+    return start;
+}
+
+void TableMirror::touch(int hand)
+{
+    int seat = seats[hand];
+    lastHands[seat] = hand - seatStart(seat);
+    changed[seat] = true;
+}
@@ -0,0 +1,160 @@
+#ifndef TABLEMIRROR_H
+#define TABLEMIRROR_H
+
+#include "gameevent.h"
+#include "hand.h"
+#include "player.h"
+#include "playerStatus.h"
+#include <vector>
+
+/**
+ * @brief The TableMirror class rebuilds a table from the GameEvents GameState publishes, so a reader following a GameEventLog
+ * knows every hand, bet, status and seat's money without being handed copies of them. It starts from a snapshot of the players,
+ * then applies events in order. It remembers which seats changed and which of a seat's hands changed last, for a view to redraw only those
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/15/2025
+ */
+class TableMirror
+{
+public:
+    /**
+     * @brief TableMirror Constructor for an empty table
+     */
+    TableMirror();
+
+    /**
+     * @brief reset Starts again from a snapshot of the table. Every seat counts as changed
+     * @param players Every hand in play order, split hands after their seat's original hand
+     * @param dealerHand The dealer's hand
+     */
+    void reset(const std::vector<Player> &players, const Hand &dealerHand = Hand(0));
+
+    /**
+     * @brief apply Applies one event. Events for hands or seats the mirror doesn't have are ignored
+     * @param event The event
+     */
+    void apply(const GameEvent &event);
+
+    /**
+     * @brief takeChanged Checks whether a seat changed since it was last taken, and marks it unchanged
+     * @param seat The seat
+     * @return True if the seat changed
+     */
+    bool takeChanged(int seat);
+
+    /**
+     * @brief getHandCount Gets the number of hands in play order
+     * @return The number of hands
+     */
+    int getHandCount() const;
+
+    /**
+     * @brief getSeatCount Gets the number of seats
+     * @return The number of seats
+     */
+    int getSeatCount() const;
+
+    /**
+     * @brief getSeat Gets the seat a hand belongs to
+     * @param hand The hand in play order
+     * @return The seat
+     */
+    int getSeat(int hand) const;
+
+    /**
+     * @brief getHand Gets a hand
+     * @param hand The hand in play order
+     * @return The hand
+     */
+    const Hand &getHand(int hand) const;
+
+    /**
+     * @brief getStatus Gets a hand's status
+     * @param hand The hand in play order
+     * @return The status
+     */
+    PlayerStatus::PLAYERSTATUS getStatus(int hand) const;
+
+    /**
+     * @brief getMoney Gets a seat's money
+     * @param seat The seat
+     * @return The money
+     */
+    int getMoney(int seat) const;
+
+    /**
+     * @brief getLastHand Gets the seat's hand that changed last, the one a seat's label shows
+     * @param seat The seat
+     * @return The hand in play order
+     */
+    int getLastHand(int seat) const;
+
+    /**
+     * @brief getDealerHand Gets the dealer's hand
+     * @return The hand
+     */
+    const Hand &getDealerHand() const;
+
+    /**
+     * @brief getPlayers Gets every hand as the players GameState would give
+     * @return The players in play order
+     */
+    std::vector<Player> getPlayers() const;
+
+private:
+    /**
+     * @brief hands Every hand in play order
+     */
+    std::vector<Hand> hands;
+
+    /**
+     * @brief statuses Every hand's status in play order
+     */
+    std::vector<PlayerStatus::PLAYERSTATUS> statuses;
+
+    /**
+     * @brief seats The seat of every hand in play order
+     */
+    std::vector<int> seats;
+
+    /**
+     * @brief money Each seat's money
+     */
+    std::vector<int> money;
+
+    /**
+     * @brief users Whether each seat is the user's
+     */
+    std::vector<bool> users;
+
+    /**
+     * @brief lastHands The hand of each seat that changed last, counted from the seat's first hand
+     */
+    std::vector<int> lastHands;
+
+    /**
+     * @brief changed Whether each seat changed since it was last taken
+     */
+    std::vector<bool> changed;
+
+    /**
+     * @brief dealerHand The dealer's hand
+     */
+    Hand dealerHand;
+
+    /**
+     * @brief seatStart Finds the first hand of a seat
+     * @param seat The seat
+     * @return The hand in play order
+     */
+    int seatStart(int seat) const;
+
+    /**
+     * @brief touch Marks a hand's seat changed with the hand as its last
+     * @param hand The hand in play order
+     */
+    void touch(int hand);
+};
+
+#endif // TABLEMIRROR_H
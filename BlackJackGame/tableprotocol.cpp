@@ -0,0 +1,195 @@
+/**
+ * @brief Implementation of The TableProtocol class. It encodes the frames a remote player and a SocketServer send each other
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/12/2025
+ */
+
+#include "tableprotocol.h"
+#include "handhistory.h"
+#include <stdexcept>
+#include <sys/resource.h>
+
+/**
+ * @brief canDoubleBit Set in the options of a TURN event if the hand can double
+ */
+static constexpr uint8_t canDoubleBit = 1;
+
+/**
+ * @brief canSplitBit Set in the options of a TURN event if the hand can split
+ */
+static constexpr uint8_t canSplitBit = 2;
+
+/**
+ * @brief canSurrenderBit Set in the options of a TURN event if the hand can surrender
+ */
+static constexpr uint8_t canSurrenderBit = 4;
+
+std::string SocketEndpoint::describe() const
+{
+    return unixPath.empty() ? "127.0.0.1:" + std::to_string(port) : unixPath;
+}
+
+long long SocketEndpoint::raiseFileLimit()
+{
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) != 0)
+        return -1;
+    limit.rlim_cur = limit.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &limit);
+    getrlimit(RLIMIT_NOFILE, &limit);
+    return static_cast<long long>(limit.rlim_cur);
+}
+
+uint8_t *TableProtocol::writeAction(uint8_t *out, const TableAction &action)
+{
+    TABLEREQUEST request = TABLEREQUEST::BET;
+    if (!action.isBet)
+    {
+        switch (action.move)
+        {
+        case MOVE::HIT:
+            request = TABLEREQUEST::HIT;
+            break;
+        case MOVE::STAND:
+            request = TABLEREQUEST::STAND;
+            break;
+        case MOVE::DOUBLE:
+            request = TABLEREQUEST::DOUBLE_DOWN;
+            break;
+        case MOVE::SPLIT:
+            request = TABLEREQUEST::SPLIT;
+            break;
+        case MOVE::SURRENDER:
+            request = TABLEREQUEST::SURRENDER;
+            break;
+        }
+    }
+
+    // The body is written after a byte left for its length, which always fits in one
+    uint8_t *body = out + 1;
+    uint8_t *next = body;
+    *next++ = static_cast<uint8_t>(request);
+    next = Varint::write(next, static_cast<uint64_t>(action.isBet ? action.bet : action.hand));
+    *out = static_cast<uint8_t>(next - body);
+    return next;
+}
+
+bool TableProtocol::readAction(const uint8_t *&in, const uint8_t *end, TableAction &action)
+{
+    const uint8_t *body;
+    const uint8_t *bodyEnd;
+    if (!frameBody(in, end, body, bodyEnd))
+        return false;
+
+    if (body == bodyEnd || *body > static_cast<uint8_t>(TABLEREQUEST::SURRENDER))
+        throw std::runtime_error("TableProtocol: unknown request");
+    TABLEREQUEST request = static_cast<TABLEREQUEST>(*body++);
+    uint64_t value = Varint::read(body, bodyEnd);
+    if (value > static_cast<uint64_t>(INT32_MAX))
+        throw std::runtime_error("TableProtocol: request value out of range");
+
+    switch (request)
+    {
+    case TABLEREQUEST::BET:
+        action = TableAction::placeBet(0, static_cast<int>(value));
+        break;
+    case TABLEREQUEST::HIT:
+        action = TableAction::play(0, static_cast<int>(value), MOVE::HIT);
+        break;
+    case TABLEREQUEST::STAND:
+        action = TableAction::play(0, static_cast<int>(value), MOVE::STAND);
+        break;
+    case TABLEREQUEST::DOUBLE_DOWN:
+        action = TableAction::play(0, static_cast<int>(value), MOVE::DOUBLE);
+        break;
+    case TABLEREQUEST::SPLIT:
+        action = TableAction::play(0, static_cast<int>(value), MOVE::SPLIT);
+        break;
+    case TABLEREQUEST::SURRENDER:
+        action = TableAction::play(0, static_cast<int>(value), MOVE::SURRENDER);
+        break;
+    }
+    return true;
+}
+
+uint8_t *TableProtocol::writeEvent(uint8_t *out, const TableEvent &event)
+{
+    uint8_t *body = out + 1;
+    uint8_t *next = body;
+    *next++ = static_cast<uint8_t>(event.type);
+    next = Varint::write(next, static_cast<uint64_t>(event.hand));
+    next = Varint::write(next, static_cast<uint64_t>(event.round));
+    next = Varint::write(next, static_cast<uint64_t>(event.money));
+
+    if (event.type == TABLEEVENT::TURN)
+    {
+        *next++ = event.upCard.getCode();
+        *next++ = static_cast<uint8_t>((event.options.canDouble ? canDoubleBit : 0) | (event.options.canSplit ? canSplitBit : 0) |
+                                       (event.options.canSurrender ? canSurrenderBit : 0));
+        next = Varint::write(next, static_cast<uint64_t>(event.options.handCount));
+        CardView cards = event.cards.getCards();
+        *next++ = static_cast<uint8_t>(cards.size());
+        for (std::size_t i = 0; i < cards.size(); i++)
+            *next++ = cards[i].getCode();
+    }
+
+    *out = static_cast<uint8_t>(next - body);
+    return next;
+}
+
+bool TableProtocol::readEvent(const uint8_t *&in, const uint8_t *end, TableEvent &event)
+{
+    const uint8_t *body;
+    const uint8_t *bodyEnd;
+    if (!frameBody(in, end, body, bodyEnd))
+        return false;
+
+    if (body == bodyEnd || *body > static_cast<uint8_t>(TABLEEVENT::CLOSED))
+        throw std::runtime_error("TableProtocol: unknown event");
+    event = TableEvent();
+    event.type = static_cast<TABLEEVENT>(*body++);
+    event.hand = static_cast<int>(Varint::read(body, bodyEnd));
+    event.round = static_cast<long long>(Varint::read(body, bodyEnd));
+    event.money = static_cast<int>(Varint::read(body, bodyEnd));
+
+    if (event.type == TABLEEVENT::TURN)
+    {
+        if (bodyEnd - body < 2 || body[0] >= Card::count)
+            throw std::runtime_error("TableProtocol: malformed turn");
+        event.upCard = Card::fromCode(body[0]);
+        event.options.canDouble = (body[1] & canDoubleBit) != 0;
+        event.options.canSplit = (body[1] & canSplitBit) != 0;
+        event.options.canSurrender = (body[1] & canSurrenderBit) != 0;
+        body += 2;
+        event.options.handCount = static_cast<int>(Varint::read(body, bodyEnd));
+
+        if (body == bodyEnd || *body > Hand::maxCards || bodyEnd - body < 1 + *body)
+            throw std::runtime_error("TableProtocol: malformed turn");
+        int cardCount = *body++;
+        for (int i = 0; i < cardCount; i++)
+        {
+            if (body[i] >= Card::count)
+                throw std::runtime_error("TableProtocol: unknown card");
+            event.cards.addCard(Card::fromCode(body[i]));
+        }
+    }
+    return true;
+}
+
+bool TableProtocol::frameBody(const uint8_t *&in, const uint8_t *end, const uint8_t *&body, const uint8_t *&bodyEnd)
+{
+    if (in == end)
+        return false;
+
+    std::size_t length = *in;
+    if (length >= 0x80 || length + 1 > maxFrameBytes)
+        throw std::runtime_error("TableProtocol: frame too long");
+    if (static_cast<std::size_t>(end - in) < length + 1)
+        return false;
+
+    body = in + 1;
+    bodyEnd = body + length;
+    in = bodyEnd;
+    return true;
+}
@@ -0,0 +1,160 @@
+#ifndef TABLEPROTOCOL_H
+#define TABLEPROTOCOL_H
+
+#include "servertable.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace TableRequestType
+{
+
+    /**
+     * @brief The TABLEREQUEST enum What a remote player asks of its table, one for each of Controller's betting and move slots.
+     * Written as the first byte of a request, followed by the amount as a varint for BET or the hand in play order as a varint for the rest
+     *
+     * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+     * @date 5/12/2025
+     */
+    enum class TABLEREQUEST : uint8_t
+    {
+        BET,
+        HIT,
+        STAND,
+        DOUBLE_DOWN,
+        SPLIT,
+        SURRENDER
+    };
+
+    /**
+     * @brief toString Converts a TABLEREQUEST to a string
+     * @param request The TABLEREQUEST to convert
+     * @return A string of the TABLEREQUEST provided
+     */
+    inline std::string toString(TABLEREQUEST request)
+    {
+        switch (request)
+        {
+        case TABLEREQUEST::BET:
+            return "Bet";
+        case TABLEREQUEST::HIT:
+            return "Hit";
+        case TABLEREQUEST::STAND:
+            return "Stand";
+        case TABLEREQUEST::DOUBLE_DOWN:
+            return "Double down";
+        case TABLEREQUEST::SPLIT:
+            return "Split";
+        case TABLEREQUEST::SURRENDER:
+            return "Surrender";
+        default:
+            return "Unknown";
+        }
+    }
+
+    /**
+     * @brief allTableRequests An array of all TABLEREQUEST values for iteration
+     */
+    static constexpr std::array<TABLEREQUEST, 6> allTableRequests = {TABLEREQUEST::BET, TABLEREQUEST::HIT, TABLEREQUEST::STAND, TABLEREQUEST::DOUBLE_DOWN,
+                                                                     TABLEREQUEST::SPLIT, TABLEREQUEST::SURRENDER};
+}
+
+using TableRequestType::TABLEREQUEST;
+
+/**
+ * @brief The SocketEndpoint struct is where a SocketServer listens and its players connect, a Unix domain socket or a loopback TCP port
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/12/2025
+ */
+struct SocketEndpoint
+{
+    /**
+     * @brief unixPath The path of the Unix domain socket, empty to use TCP
+     */
+    std::string unixPath;
+
+    /**
+     * @brief port The TCP port on 127.0.0.1
+     */
+    uint16_t port = 7777;
+
+    /**
+     * @brief describe Describes the endpoint
+     * @return The path, or the address and port
+     */
+    std::string describe() const;
+
+    /**
+     * @brief raiseFileLimit Raises this process's limit on open descriptors as far as it is allowed, for thousands of sockets
+     * @return The limit now, or -1 if it couldn't be read
+     */
+    static long long raiseFileLimit();
+};
+
+/**
+ * @brief The TableProtocol class encodes the frames a remote player and a SocketServer send each other.
+ * Every frame is its length as a varint, always one byte as frames are shorter than 128, then that many bytes.
+ * A connection is the user seat of one table, so frames never name the table or seat.
+ * Requests are a TABLEREQUEST byte and one varint. Events are a TABLEEVENT byte, then the hand, the round and the money as varints,
+ * and for TURN the dealer's up card, a byte of option bits, the seat's hand count as a varint, the number of cards and the cards, cards one byte each as Card::getCode
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/12/2025
+ */
+class TableProtocol
+{
+public:
+    /**
+     * @brief maxFrameBytes The most bytes a frame takes, length included, with room for a TURN of Hand::maxCards cards
+     */
+    static constexpr std::size_t maxFrameBytes = 64;
+
+    /**
+     * @brief writeAction Writes the frame of a seat's bet or move
+     * @param out Where to write, with room for maxFrameBytes
+     * @param action The action, its seat is not sent
+     * @return The byte after the frame
+     */
+    static uint8_t *writeAction(uint8_t *out, const TableAction &action);
+
+    /**
+     * @brief readAction Reads the frame of a bet or move if a whole one has arrived. Throws std::runtime_error if the frame is malformed
+     * @param in The first byte, moved past the frame if one was read
+     * @param end The end of the bytes that have arrived
+     * @param action Set to the action for seat 0
+     * @return True if a frame was read, false if more bytes are needed
+     */
+    static bool readAction(const uint8_t *&in, const uint8_t *end, TableAction &action);
+
+    /**
+     * @brief writeEvent Writes the frame of an event for a seat
+     * @param out Where to write, with room for maxFrameBytes
+     * @param event The event, its table and seat are not sent
+     * @return The byte after the frame
+     */
+    static uint8_t *writeEvent(uint8_t *out, const TableEvent &event);
+
+    /**
+     * @brief readEvent Reads the frame of an event if a whole one has arrived. Throws std::runtime_error if the frame is malformed
+     * @param in The first byte, moved past the frame if one was read
+     * @param end The end of the bytes that have arrived
+     * @param event Set to the event for seat 0 of table 0
+     * @return True if a frame was read, false if more bytes are needed
+     */
+    static bool readEvent(const uint8_t *&in, const uint8_t *end, TableEvent &event);
+
+private:
+    /**
+     * @brief frameBody Finds the body of the frame starting at a byte if all of it has arrived
+     * @param in The first byte of the frame, moved past it if it has all arrived
+     * @param end The end of the bytes that have arrived
+     * @param body Set to the first byte of the body
+     * @param bodyEnd Set to the end of the body
+     * @return True if the whole frame has arrived
+     */
+    static bool frameBody(const uint8_t *&in, const uint8_t *end, const uint8_t *&body, const uint8_t *&bodyEnd);
+};
+
+#endif // TABLEPROTOCOL_H
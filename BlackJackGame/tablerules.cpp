@@ -0,0 +1,92 @@
+/**
+ * @brief Implementation of The TableRules struct. It holds the house rules of a table
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/29/2025
+ */
+
+#include "tablerules.h"
+#include <cmath>
+
+TableRules TableRules::fromPreset(PRESET preset)
+{
+    TableRules rules;
+    if (preset == PRESET::GAME)
+        return rules;
+
+    // Every casino preset deals a shoe down to the cut card
+    rules.shuffleEveryRound = false;
+    rules.maxSplitHands = 4;
+
+    switch (preset)
+    {
+    case PRESET::GAME:
+        break;
+    case PRESET::VEGAS_STRIP:
+        rules.deckCount = 6;
+        rules.surrender = true;
+        rules.resplitAces = true;
+        rules.penetration = 0.75;
+        break;
+    case PRESET::DOWNTOWN:
+        rules.deckCount = 2;
+        rules.dealerHitsSoft17 = true;
+        rules.penetration = 0.65;
+        break;
+    case PRESET::ATLANTIC_CITY:
+        rules.deckCount = 8;
+        rules.surrender = true;
+        rules.penetration = 0.75;
+        break;
+    case PRESET::EUROPEAN:
+        rules.deckCount = 6;
+        rules.doubleAfterSplit = false;
+        rules.maxSplitHands = 2;
+        rules.penetration = 0.7;
+        break;
+    case PRESET::SIX_FIVE:
+        rules.deckCount = 6;
+        rules.dealerHitsSoft17 = true;
+        rules.blackjackNumerator = 6;
+        rules.blackjackDenominator = 5;
+        rules.penetration = 0.75;
+        break;
+    case PRESET::SINGLE_DECK:
+        rules.deckCount = 1;
+        rules.dealerHitsSoft17 = true;
+        rules.doubleAfterSplit = false;
+        rules.maxSplitHands = 2;
+        rules.penetration = 0.6;
+        break;
+    case PRESET::DOUBLE_DECK:
+        rules.deckCount = 2;
+        rules.resplitAces = true;
+        rules.penetration = 0.7;
+        break;
+    }
+    return rules;
+}
+
+std::string TableRules::describe() const
+{
+    std::string description = std::to_string(deckCount) + "D";
+    description += dealerHitsSoft17 ? " H17" : " S17";
+    description += " " + std::to_string(blackjackNumerator) + ":" + std::to_string(blackjackDenominator);
+    if (doubleAfterSplit)
+        description += " DAS";
+    if (maxSplitHands > 0)
+        description += " SP" + std::to_string(maxSplitHands);
+    if (resplitAces)
+        description += " RSA";
+    if (hitSplitAces)
+        description += " HSA";
+    if (surrender)
+        description += " LS";
+    if (continuousShuffle)
+        description += " CSM";
+    else if (shuffleEveryRound)
+        description += " shuffled every round";
+    else
+        description += " " + std::to_string(static_cast<int>(std::lround(penetration * 100))) + "%";
+    return description;
+}
@@ -0,0 +1,192 @@
+#ifndef TABLERULES_H
+#define TABLERULES_H
+
+#include <string>
+
+namespace RulePreset
+{
+
+    /**
+     * @brief The PRESET enum An enum for common casino rule sets
+     *
+     * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+     * @date 4/29/2025
+     */
+    enum class PRESET
+    {
+        GAME,
+        VEGAS_STRIP,
+        DOWNTOWN,
+        ATLANTIC_CITY,
+        EUROPEAN,
+        SIX_FIVE,
+        SINGLE_DECK,
+        DOUBLE_DECK
+    };
+
+    /**
+     * @brief toString Converts a PRESET to a string
+     * @param preset The PRESET to convert
+     * @return A string of the PRESET provided
+     */
+    inline std::string toString(PRESET preset)
+    {
+        switch (preset)
+        {
+        case PRESET::GAME:
+            return "Game";
+        case PRESET::VEGAS_STRIP:
+            return "Vegas Strip";
+        case PRESET::DOWNTOWN:
+            return "Downtown";
+        case PRESET::ATLANTIC_CITY:
+            return "Atlantic City";
+        case PRESET::EUROPEAN:
+            return "European";
+        case PRESET::SIX_FIVE:
+            return "6:5 Shoe";
+        case PRESET::SINGLE_DECK:
+            return "Single Deck";
+        case PRESET::DOUBLE_DECK:
+            return "Double Deck";
+        }
+
+        return "Unknown preset";
+    }
+
+    /**
+     * @brief allPresets An array of all rule presets
+     */
+    inline constexpr PRESET allPresets[] = {
+        PRESET::GAME,
+        PRESET::VEGAS_STRIP,
+        PRESET::DOWNTOWN,
+        PRESET::ATLANTIC_CITY,
+        PRESET::EUROPEAN,
+        PRESET::SIX_FIVE,
+        PRESET::SINGLE_DECK,
+        PRESET::DOUBLE_DECK};
+}
+
+using RulePreset::PRESET;
+
+/**
+ * @brief The TableRules struct holds the house rules of a table. The defaults are the rules the game has always played by
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/29/2025
+ */
+struct TableRules
+{
+    /**
+     * @brief deckCount The number of decks in the shoe
+     */
+    int deckCount = 1;
+
+    /**
+     * @brief dealerHitsSoft17 True if the dealer hits soft 17 (H17), false if they stand on all 17s (S17)
+     */
+    bool dealerHitsSoft17 = false;
+
+    /**
+     * @brief blackjackNumerator The numerator of the blackjack payout, 3 for 3:2
+     */
+    int blackjackNumerator = 3;
+
+    /**
+     * @brief blackjackDenominator The denominator of the blackjack payout, 2 for 3:2
+     */
+    int blackjackDenominator = 2;
+
+    /**
+     * @brief doubleAfterSplit True if split hands may double down
+     */
+    bool doubleAfterSplit = true;
+
+    /**
+     * @brief maxSplitHands The most hands a seat can split into, 0 for no limit
+     */
+    int maxSplitHands = 0;
+
+    /**
+     * @brief resplitAces True if a split ace that draws another ace may be split again
+     */
+    bool resplitAces = false;
+
+    /**
+     * @brief hitSplitAces True if split aces are played like any other hand, false if they get one card each and stand
+     */
+    bool hitSplitAces = false;
+
+    /**
+     * @brief surrender True if the first two cards of a seat's hand may be given up for half the bet (late surrender)
+     */
+    bool surrender = false;
+
+    /**
+     * @brief penetration The fraction of the shoe dealt before the cut card comes out and the shoe is reshuffled
+     */
+    double penetration = 0.8;
+
+    /**
+     * @brief shuffleEveryRound True if the shoe is reshuffled before every round, false to deal on until the cut card
+     */
+    bool shuffleEveryRound = true;
+
+    /**
+     * @brief continuousShuffle True if the cards come from a continuous shuffling machine that takes the discards back after every round.
+     * The penetration and shuffleEveryRound are ignored
+     */
+    bool continuousShuffle = false;
+
+    /**
+     * @brief fromPreset Creates the rules of a common casino rule set
+     * @param preset The rule set to create
+     * @return The rules of the preset
+     */
+    static TableRules fromPreset(PRESET preset);
+
+    /**
+     * @brief blackjackPayout Gets the amount a blackjack wins per unit bet
+     * @return The payout, 1.5 for 3:2
+     */
+    double blackjackPayout() const { return static_cast<double>(blackjackNumerator) / blackjackDenominator; }
+
+    /**
+     * @brief describe Gives a short summary of the rules
+     * @return The rules in the usual shorthand, like "6D S17 3:2 DAS SP4 RSA LS 75%"
+     */
+    std::string describe() const;
+};
+
+/**
+ * @brief The HandOptions struct holds the moves a hand may make right now besides hitting and standing.
+ * GameState works them out from the rules, the hand and the player's money
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 4/29/2025
+ */
+struct HandOptions
+{
+    /**
+     * @brief canDouble True if the hand may double down
+     */
+    bool canDouble = true;
+
+    /**
+     * @brief canSplit True if the hand may split
+     */
+    bool canSplit = true;
+
+    /**
+     * @brief canSurrender True if the hand may surrender
+     */
+    bool canSurrender = false;
+
+    /**
+     * @brief handCount The number of hands the seat is playing, which counts toward the most a split may make
+     */
+    int handCount = 1;
+};
+
+#endif // TABLERULES_H
@@ -0,0 +1,138 @@
+/**
+ * @brief Implementation of The TableServer class. It hosts many independent tables in one process on a fixed WorkStealingPool
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/11/2025
+ */
+
+#include "tableserver.h"
+#include <algorithm>
+#include <chrono>
+
+TableServer::TableServer(unsigned int workerCount, int tableCapacity, std::function<void(const TableEvent &event)> listener)
+    : listener(std::move(listener)), tables(tableCapacity)
+{
+    if (workerCount == 0)
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned int i = 0; i < workerCount; i++)
+        workerStats.push_back(std::make_unique<WorkerStats>());
+
+    pool = std::make_unique<WorkStealingPool>(workerCount, [this](int table, unsigned int worker)
+                                              { runTable(table, worker); });
+}
+
+TableServer::~TableServer()
+{
+    // A running table may still schedule itself, so the pool has to outlive its workers
+    pool->stop();
+}
+
+int TableServer::openTable(std::vector<Player> players, const TableRules &rules, uint64_t seed, long long roundLimit)
+{
+    std::lock_guard<std::mutex> guard(openLock);
+    int id = tableCount.load(std::memory_order_relaxed);
+    if (!freeTables.empty())
+    {
+        id = freeTables.back();
+        freeTables.pop_back();
+    }
+    else if (id >= static_cast<int>(tables.size()))
+        return -1;
+
+    // A given back table is no longer touched by any worker, so it can be replaced
+    tables[id] = std::make_unique<ServerTable>(id, std::move(players), rules, seed, roundLimit);
+    if (id == tableCount.load(std::memory_order_relaxed))
+        tableCount.store(id + 1, std::memory_order_release);
+
+    // A new table is already marked scheduled for its first round
+    pool->schedule(id);
+    return id;
+}
+
+bool TableServer::submit(int table, TableAction action)
+{
+    if (table < 0 || table >= tableCount.load(std::memory_order_acquire))
+        return false;
+
+    action.sentAt = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    bool accepted;
+    if (tables[table]->post(action, accepted))
+        pool->schedule(table);
+    return accepted;
+}
+
+void TableServer::closeTable(int table)
+{
+    if (table < 0 || table >= tableCount.load(std::memory_order_acquire))
+        return;
+
+    // A table that is queued or running is given back by its last run
+    if (tables[table]->close())
+        releaseTable(table);
+}
+
+void TableServer::runTable(int table, unsigned int worker)
+{
+    bool again;
+    bool released;
+    {
+        WorkerStats &counts = *workerStats[worker];
+        std::lock_guard<std::mutex> guard(counts.lock);
+        again = tables[table]->run(listener, counts.stats, released);
+    }
+
+    // Back of the queue, so a table of bots doesn't hold up the tables behind it
+    if (again)
+        pool->schedule(table);
+    else if (released)
+        releaseTable(table);
+}
+
+void TableServer::releaseTable(int table)
+{
+    TableEvent closed;
+    closed.table = table;
+    closed.type = TABLEEVENT::CLOSED;
+    closed.seat = -1;
+    listener(closed);
+
+    std::lock_guard<std::mutex> guard(openLock);
+    freeTables.push_back(table);
+}
+
+TableStats TableServer::getStats() const
+{
+    TableStats total;
+    for (const std::unique_ptr<WorkerStats> &counts : workerStats)
+    {
+        std::lock_guard<std::mutex> guard(counts->lock);
+        total.merge(counts->stats);
+    }
+    return total;
+}
+
+int TableServer::getTableCount() const
+{
+    return tableCount.load(std::memory_order_acquire);
+}
+
+int TableServer::getOpenTableCount() const
+{
+    // Held so a table given back isn't replaced while it is looked at
+    std::lock_guard<std::mutex> guard(openLock);
+    int open = 0;
+    int count = getTableCount();
+    for (int i = 0; i < count; i++)
+        open += tables[i]->isClosed() ? 0 : 1;
+    return open;
+}
+
+unsigned int TableServer::getWorkerCount() const
+{
+    return pool->getWorkerCount();
+}
+
+long long TableServer::getSteals() const
+{
+    return pool->getSteals();
+}
@@ -0,0 +1,164 @@
+#ifndef TABLESERVER_H
+#define TABLESERVER_H
+
+#include "servertable.h"
+#include "workstealingpool.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief The TableServer class hosts many independent tables in one process on a fixed WorkStealingPool.
+ * Seats submit actions from any thread. Each goes to its table's mailbox, and a table with mail is scheduled on the pool once,
+ * so a table only ever runs on one worker at a time while thousands of others run on the rest.
+ * Events for user seats go to a single listener on the worker that ran the table, so it has to be quick and thread safe.
+ * A table closed with closeTable gives its id back to be used by the next table opened
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/11/2025
+ */
+class TableServer
+{
+public:
+    /**
+     * @brief TableServer Constructor that starts the workers
+     * @param workerCount The number of worker threads, 0 uses every hardware thread
+     * @param tableCapacity The most tables open at once. A table that closes on its own keeps its id until closeTable gives it back
+     * @param listener Called with every event for a user seat, on a worker thread or the thread closing a table
+     */
+    TableServer(unsigned int workerCount, int tableCapacity, std::function<void(const TableEvent &event)> listener);
+
+    /**
+     * @brief ~TableServer Destructor that stops the workers before the tables are freed
+     */
+    ~TableServer();
+
+    TableServer(const TableServer &) = delete;
+    TableServer &operator=(const TableServer &) = delete;
+
+    /**
+     * @brief openTable Seats the players at a new table and starts its first round, reusing the id of a table given back by closeTable if there is one.
+     * Safe to call from any thread
+     * @param players The players, one per seat, users are sent events and bots play themselves
+     * @param rules The house rules of the table
+     * @param seed The seed the shoe is dealt from
+     * @param roundLimit The rounds to play before closing, 0 for no limit
+     * @return The table's id, or -1 if the server is full
+     */
+    int openTable(std::vector<Player> players, const TableRules &rules, uint64_t seed, long long roundLimit = 0);
+
+    /**
+     * @brief submit Sends an action to a table, stamped with the time for the latency. Safe to call from any thread
+     * @param table The table's id
+     * @param action The action
+     * @return False if there is no such table, it has closed or its mailbox is full
+     */
+    bool submit(int table, TableAction action);
+
+    /**
+     * @brief closeTable Closes a table and gives its id back once the table's last run is over. The listener is then sent a CLOSED event
+     * for seat -1, after every other event of the table and before the id is opened again. Nothing may be submitted to the id after this
+     * until openTable hands it out again. Safe to call from any thread
+     * @param table The table's id
+     */
+    void closeTable(int table);
+
+    /**
+     * @brief getStats Adds up the work every worker has done so far
+     * @return The counts and the latency of the actions
+     */
+    TableStats getStats() const;
+
+    /**
+     * @brief getTableCount Gets the number of table ids handed out, a reused id counts once
+     * @return The number of tables
+     */
+    int getTableCount() const;
+
+    /**
+     * @brief getOpenTableCount Gets the number of tables that haven't closed
+     * @return The number of open tables
+     */
+    int getOpenTableCount() const;
+
+    /**
+     * @brief getWorkerCount Gets the number of worker threads
+     * @return The number of workers
+     */
+    unsigned int getWorkerCount() const;
+
+    /**
+     * @brief getSteals Gets the number of times a worker ran a table from another worker's queue
+     * @return The number of steals
+     */
+    long long getSteals() const;
+
+private:
+    /**
+     * @brief The WorkerStats struct is one worker's counts, locked by the worker while it runs a table and by getStats
+     */
+    struct alignas(64) WorkerStats
+    {
+        /**
+         * @brief lock Held while the counts change or are read
+         */
+        std::mutex lock;
+
+        /**
+         * @brief stats The counts
+         */
+        TableStats stats;
+    };
+
+    /**
+     * @brief listener Called with every event for a user seat
+     */
+    std::function<void(const TableEvent &event)> listener;
+
+    /**
+     * @brief tables Every table by id, sized to the capacity up front so opening a table never moves one a worker is running
+     */
+    std::vector<std::unique_ptr<ServerTable>> tables;
+
+    /**
+     * @brief tableCount The number of table ids handed out, published after the table is in place
+     */
+    std::atomic<int> tableCount{0};
+
+    /**
+     * @brief openLock Held to open a table, give back its id or look through the tables
+     */
+    mutable std::mutex openLock;
+
+    /**
+     * @brief freeTables The ids of tables given back by closeTable, opened again before any new id
+     */
+    std::vector<int> freeTables;
+
+    /**
+     * @brief workerStats Every worker's counts
+     */
+    std::vector<std::unique_ptr<WorkerStats>> workerStats;
+
+    /**
+     * @brief pool The workers the tables run on
+     */
+    std::unique_ptr<WorkStealingPool> pool;
+
+    /**
+     * @brief runTable Runs a table on a worker and schedules it again if it has more to do
+     * @param table The table's id
+     * @param worker The worker's index
+     */
+    void runTable(int table, unsigned int worker);
+
+    /**
+     * @brief releaseTable Tells the listener a closed table is done with and gives its id back
+     * @param table The table's id
+     */
+    void releaseTable(int table);
+};
+
+#endif // TABLESERVER_H
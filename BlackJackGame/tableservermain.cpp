@@ -0,0 +1,221 @@
+/**
+ * @brief Main for the table server. Either serves remote players over a socket, or load tests itself by opening thousands of tables
+ * with a user seat each, playing the users from loopback clients and reporting the throughput and the latency of their actions
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/11/2025
+ */
+
+#include "loopbackclient.h"
+#include "socketserver.h"
+#include "tableserver.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * @brief printUsage Prints the command line options of the server
+ * @param program The name the program was run as
+ */
+static void printUsage(const char *program)
+{
+    std::cout << "Usage: " << program << " [--tables N] [--bots N] [--money N] [--workers N] [--clients N] [--seconds N] [--rounds N] [--seed N] [--decks N]\n"
+              << "       [--port N | --unix PATH]\n"
+              << "  --tables    Number of tables to open, each with one user seat, or the most players to serve (default 10000)\n"
+              << "  --bots      Number of bot seats at each table (default 2)\n"
+              << "  --money     Money every seat starts with (default 1000)\n"
+              << "  --workers   Number of worker threads, 0 for every hardware thread (default 0)\n"
+              << "  --clients   Number of loopback client threads playing the user seats (default 2)\n"
+              << "  --seconds   How long to run for, 0 serves until killed (default 10)\n"
+              << "  --rounds    Rounds each loopback table plays before closing, 0 for no limit (default 0)\n"
+              << "  --seed      Seed the tables' shoes are seeded from (default random)\n"
+              << "  --decks     Number of decks in each shoe (default 6)\n"
+              << "  --port      Serve remote players on this loopback TCP port instead of loopback clients\n"
+              << "  --unix      Serve remote players on this Unix domain socket instead of loopback clients\n";
+}
+
+/**
+ * @brief serveSockets Serves remote players for a time and reports what their tables did
+ * @param endpoint Where to listen
+ * @param tableCount The most players to serve
+ * @param bots The number of bot seats at each table
+ * @param money The money every seat starts with
+ * @param workers The number of worker threads
+ * @param seconds How long to serve for, 0 until killed
+ * @param seed The seed the tables' shoes are seeded from
+ * @param rules The house rules of every table
+ */
+static void serveSockets(const SocketEndpoint &endpoint, int tableCount, int bots, int money, unsigned int workers, double seconds, uint64_t seed, const TableRules &rules)
+{
+    SocketEndpoint::raiseFileLimit();
+    SocketServer server(workers, tableCount, rules, bots, money, seed);
+    server.listen(endpoint);
+    std::cout << "Listening on " << endpoint.describe() << "  Seats: 1 player, " << bots << " bots  Workers: " << server.getWorkerCount() << "\n"
+              << "Rules: " << rules.describe() << "\n"
+              << "Seed: " << seed << std::endl;
+
+    if (seconds == 0)
+    {
+        server.run();
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::thread serving([&server]()
+                        { server.run(); });
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    server.stop();
+    serving.join();
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    TableStats stats = server.getStats();
+    std::cout << std::fixed << std::setprecision(2)
+              << "Players:      " << server.getConnectionCount() << " connected at the end\n"
+              << "Rounds:       " << stats.rounds << " (" << std::setprecision(0) << stats.rounds / elapsed << " rounds/sec)\n"
+              << "Actions:      " << stats.actions << " (" << stats.actions / elapsed << " actions/sec), " << stats.rejected << " rejected\n"
+              << "Queued (us):  p50 " << stats.latency.quantile(0.5) << "  p99 " << stats.latency.quantile(0.99) << "  max " << stats.latency.quantile(1.0) << "\n"
+              << "Frames:       " << server.getFramesWritten() << " in " << server.getWrites() << " writes\n"
+              << std::defaultfloat;
+}
+
+/**
+ * @brief main Runs the server or the load test
+ * @param argc Number of args
+ * @param argv Char array of args
+ * @return int An int for the success or failues of the program
+ */
+int main(int argc, char *argv[])
+{
+    int tableCount = 10000;
+    int bots = 2;
+    int money = 1000;
+    unsigned int workers = 0;
+    int clientCount = 2;
+    double seconds = 10;
+    long long roundLimit = 0;
+    uint64_t seed = Rng::randomSeed();
+    SocketEndpoint endpoint;
+    bool serving = false;
+
+    TableRules rules;
+    rules.deckCount = 6;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--tables") == 0 && hasValue)
+            tableCount = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--bots") == 0 && hasValue)
+            bots = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--money") == 0 && hasValue)
+            money = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--workers") == 0 && hasValue)
+            workers = std::strtoul(argv[++i], nullptr, 10);
+        else if (std::strcmp(argv[i], "--clients") == 0 && hasValue)
+            clientCount = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--seconds") == 0 && hasValue)
+            seconds = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--rounds") == 0 && hasValue)
+            roundLimit = std::atoll(argv[++i]);
+        else if (std::strcmp(argv[i], "--seed") == 0 && hasValue)
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (std::strcmp(argv[i], "--decks") == 0 && hasValue)
+            rules.deckCount = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--port") == 0 && hasValue)
+        {
+            endpoint.port = static_cast<uint16_t>(std::atoi(argv[++i]));
+            serving = true;
+        }
+        else if (std::strcmp(argv[i], "--unix") == 0 && hasValue)
+        {
+            endpoint.unixPath = argv[++i];
+            serving = true;
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (tableCount < 1 || bots < 0 || bots > 6 || money < 1 || clientCount < 1 || seconds < 0 || (seconds == 0 && !serving) || roundLimit < 0 || rules.deckCount < 1)
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    if (serving)
+    {
+        try
+        {
+            serveSockets(endpoint, tableCount, bots, money, workers, seconds, seed, rules);
+        }
+        catch (const std::runtime_error &error)
+        {
+            std::cerr << error.what() << "\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    std::vector<std::unique_ptr<LoopbackClient>> clients;
+    for (int i = 0; i < clientCount; i++)
+        clients.push_back(std::make_unique<LoopbackClient>(rules));
+
+    // Each table's events always go to the same client, so its actions arrive in order
+    auto server = std::make_unique<TableServer>(workers, tableCount, [&clients](const TableEvent &event)
+                                                { clients[event.table % clients.size()]->deliver(event); });
+    for (std::unique_ptr<LoopbackClient> &client : clients)
+        client->connect(*server);
+
+    std::cout << "Tables: " << tableCount << "  Seats: 1 user, " << bots << " bots  Workers: " << server->getWorkerCount() << "  Clients: " << clientCount << "\n"
+              << "Rules: " << rules.describe() << "\n"
+              << "Seed: " << seed << "\n";
+
+    auto start = std::chrono::steady_clock::now();
+    Rng seeds(seed);
+    for (int i = 0; i < tableCount; i++)
+    {
+        std::vector<Player> players;
+        for (int seat = 0; seat <= bots; seat++)
+        {
+            players.emplace_back(money, 0, seat == 0, 1, 0);
+            players[seat].originalHand = true;
+        }
+        server->openTable(std::move(players), rules, seeds(), roundLimit);
+    }
+    double openSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    TableStats stats = server->getStats();
+    int openTables = server->getOpenTableCount();
+    long long steals = server->getSteals();
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // The server goes first so no worker delivers to a client that is gone
+    server.reset();
+    long long answered = 0;
+    long long refused = 0;
+    for (const std::unique_ptr<LoopbackClient> &client : clients)
+    {
+        answered += client->getAnswered();
+        refused += client->getRefused();
+    }
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "Opened in:    " << openSeconds << " seconds\n"
+              << "Open tables:  " << openTables << " of " << tableCount << "\n"
+              << "Rounds:       " << stats.rounds << " (" << std::setprecision(0) << stats.rounds / elapsed << " rounds/sec)\n"
+              << "Actions:      " << stats.actions << " (" << stats.actions / elapsed << " actions/sec), " << answered << " answered, "
+              << stats.rejected << " rejected, " << refused << " refused\n"
+              << "Latency (us): p50 " << stats.latency.quantile(0.5) << "  p90 " << stats.latency.quantile(0.9) << "  p99 " << stats.latency.quantile(0.99)
+              << "  p99.9 " << stats.latency.quantile(0.999) << "  max " << stats.latency.quantile(1.0) << "\n"
+              << "Steals:       " << steals << "\n"
+              << std::defaultfloat;
+    return 0;
+}
@@ -8,11 +8,9 @@
 #include "tableview.h"
 #include <QtWidgets/qgraphicseffect.h>
 
-TableView::TableView(QWidget *parent)
-    : QGraphicsView(parent), scene(new QGraphicsScene(this))
+TableView::TableView(TimerManager *timer, QWidget *parent)
+    : QGraphicsView(parent), scene(new QGraphicsScene(this)), timer(timer), timerScope(timer->createScope())
 {
-
-    timer = new TimerManager();
     setScene(scene);
 
     setRenderHints(
@@ -31,7 +29,7 @@ TableView::TableView(QWidget *parent)
 
 TableView::~TableView()
 {
-    delete timer;
+    timer->cancelScope(timerScope);
 }
 
 void TableView::createPlayerCardContainers(unsigned int playerCount)
@@ -97,6 +95,7 @@ void TableView::updateCardPosition(unsigned int playerIndex, unsigned int oldHan
             {
         playerCards[playerIndex][oldHandIndex].erase(playerCards[playerIndex][oldHandIndex].begin() + oldCardIndex);
         playerCards[playerIndex][newHandIndex].insert(playerCards[playerIndex][newHandIndex].begin() + newCardIndex, card); });
+    cardAnim->start(QAbstractAnimation::DeleteWhenStopped);
 }
 
 QPointF TableView::getCardEndPosition(int playerIndex, int handIndex, int cardIndex)
@@ -156,6 +155,7 @@ void TableView::addCardAnimated(int playerIndex, int handIndex, const QString &i
             scene->removeItem(cardItem);
             delete cardItem;
             addDealerCardAt(imagePath, endPos, rotationAngle); });
+        anim->start(QAbstractAnimation::DeleteWhenStopped);
         return;
     }
     connect(anim, &QParallelAnimationGroup::finished, this, [=]()
@@ -163,6 +163,7 @@ void TableView::addCardAnimated(int playerIndex, int handIndex, const QString &i
         scene->removeItem(cardItem);
         delete cardItem;
         addPlayerCardAt(playerIndex, handIndex, imagePath, endPos, rotationAngle); });
+    anim->start(QAbstractAnimation::DeleteWhenStopped);
 }
 
 void TableView::addPlayerCardAt(int playerIndex, int handIndex, const QString &imagePath, QPointF pos, qreal rotationAngle)
@@ -214,7 +215,8 @@ void TableView::createDealerPile()
 
                 // Optionally add a final static card after animation
                 createCardItem(":/cardImages/cards_pngsource/back_of_card.png", endPos, 90, false);
-            }); });
+            });
+            anim->start(QAbstractAnimation::DeleteWhenStopped); }, timerScope);
     }
 }
 
@@ -250,14 +252,14 @@ QParallelAnimationGroup *TableView::createAnimationCardItem(AnimatableCardItem *
 {
     // Position animation
     QPropertyAnimation *posAnim = new QPropertyAnimation(cardItem, "pos");
-    posAnim->setDuration(600);
+    posAnim->setDuration(timer->scaleDuration(600));
     posAnim->setStartValue(startPos);
     posAnim->setEndValue(endPos);
     posAnim->setEasingCurve(QEasingCurve::OutQuad);
 
     // Rotation animation
     QPropertyAnimation *rotAnim = new QPropertyAnimation(cardItem, "rotation");
-    rotAnim->setDuration(600);
+    rotAnim->setDuration(timer->scaleDuration(600));
     rotAnim->setStartValue(startRotation);
     rotAnim->setEndValue(endRotation);
     rotAnim->setEasingCurve(QEasingCurve::OutQuad);
@@ -266,7 +268,6 @@ QParallelAnimationGroup *TableView::createAnimationCardItem(AnimatableCardItem *
     QParallelAnimationGroup *group = new QParallelAnimationGroup;
     group->addAnimation(posAnim);
     group->addAnimation(rotAnim);
-    group->start(QAbstractAnimation::DeleteWhenStopped);
 
     return group;
 }
@@ -298,5 +299,5 @@ void TableView::clearTable()
 
 void TableView::stopEverything()
 {
-    timer->cancelAllTimers();
+    timer->cancelScope(timerScope);
 }
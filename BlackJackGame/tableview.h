@@ -23,9 +23,10 @@ class TableView : public QGraphicsView
 public:
     /**
      * @brief TableView Constructor for the TableView
+     * @param timer The timer the table runs on, which also sets how long the cards take to move
      * @param parent The parent object
      */
-    explicit TableView(QWidget *parent = nullptr);
+    explicit TableView(TimerManager *timer, QWidget *parent = nullptr);
 
     /**
      * @brief ~TableView Deconstructor for TableView
@@ -120,7 +121,8 @@ public:
     AnimatableCardItem *createCardItem(const QString &imagePath, QPointF startPos, qreal rotationAngle, bool setShadow);
 
     /**
-     * @brief createAnimationCardItem Uses an AnimatableCardItem to start the animation
+     * @brief createAnimationCardItem Uses an AnimatableCardItem to make the animation, started by the caller once it has connected to finished.
+     * An animation scaled to no length at all finishes as soon as it starts
      * @param cardItem The AnimatableCardItem to apply an animation to
      * @param startPos The start pos of the card
      * @param endPos The end pos of the card
@@ -193,9 +195,14 @@ private:
     void updateCardPosition(unsigned int playerIndex, unsigned int oldHandIndex, unsigned int oldCardIndex, unsigned int newHandIndex, unsigned int newCardIndex);
 
     /**
-     * @brief timer An instance of the timer class
+     * @brief timer The timer the table runs on, shared with the screens and the controller
      */
     TimerManager *timer;
+
+    /**
+     * @brief timerScope The scope of the table's own timers
+     */
+    int timerScope;
 };
 
 /**
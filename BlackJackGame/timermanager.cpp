@@ -6,38 +6,169 @@
  */
 
 #include "timermanager.h"
+#include <algorithm>
 
-TimerManager::TimerManager(QObject *parent) : QObject{parent} {}
+TimerManager::TimerManager(QObject *parent) : QObject{parent}, driver(new QTimer(this)), offset(0), virtualClock(false), timeScale(TIMESCALE::NORMAL), ticking(false)
+{
+    driver->setSingleShot(true);
+    driver->setTimerType(Qt::PreciseTimer);
+    connect(driver, &QTimer::timeout, this, &TimerManager::onTick);
+    clock.start();
+}
 
 TimerManager::~TimerManager()
 {
     cancelAllTimers();
 }
 
-void TimerManager::scheduleSingleShot(int delay, std::function<void()> callBack)
+TimerWheel::Handle TimerManager::scheduleSingleShot(int delay, std::function<void()> callBack, int scope)
 {
-    QTimer *timer = new QTimer(this);
-    timer->setSingleShot(true);
+    // The wheel only moves when something is due, so the delay is counted from the clock rather than from where the wheel last stopped
+    uint64_t now = currentTime();
+    uint64_t lag = now > wheel.getNow() ? now - wheel.getNow() : 0;
+    TimerWheel::Handle handle = wheel.schedule(static_cast<uint64_t>(std::max(delay, 0)) + lag, std::move(callBack), scope);
+    rearm();
+    return handle;
+}
 
-    // Creates the timer with the given callBack and has it delte itself afterwards
-    connect(timer, &QTimer::timeout, this, [=]()
-            {
-        callBack();
-        timers.removeOne(timer);
-        timer->deleteLater(); });
+bool TimerManager::cancel(TimerWheel::Handle handle)
+{
+    return wheel.cancel(handle);
+}
+
+int TimerManager::createScope()
+{
+    return wheel.createScope();
+}
 
-    // Add and start the timer
-    timers.append(timer);
-    timer->start(delay);
+void TimerManager::cancelScope(int scope)
+{
+    wheel.cancelScope(scope);
 }
 
 void TimerManager::cancelAllTimers()
 {
-    // Delete all timers
-    for (QTimer *timer : timers)
+    wheel.cancelAll();
+    rearm();
+}
+
+void TimerManager::setVirtualClock(bool enabled)
+{
+    if (enabled == virtualClock)
+        return;
+
+    // Anything already due runs before time stops, and time starts again from wherever it was stopped
+    if (enabled)
+        moveTo(currentTime());
+    virtualClock = enabled;
+    offset = static_cast<qint64>(wheel.getNow()) - scaledElapsed();
+    rearm();
+}
+
+void TimerManager::setTimeScale(TIMESCALE scale)
+{
+    if (scale == timeScale)
+        return;
+
+    // Time so far counts at the old speed, and carries on from there at the new one
+    if (!isStopped())
+        moveTo(currentTime());
+    timeScale = scale;
+    offset = static_cast<qint64>(wheel.getNow()) - scaledElapsed();
+    rearm();
+}
+
+TIMESCALE TimerManager::getTimeScale() const
+{
+    return timeScale;
+}
+
+int TimerManager::scaleDuration(int milliseconds) const
+{
+    int speed = TimeScale::getSpeed(timeScale);
+    return speed == 0 ? 0 : milliseconds / speed;
+}
+
+void TimerManager::advance(int milliseconds)
+{
+    moveTo(currentTime() + static_cast<uint64_t>(std::max(milliseconds, 0)));
+}
+
+void TimerManager::fastForward()
+{
+    while (wheel.getPendingCount() > 0)
+    {
+        // The wheel ignores being moved from inside one of its callbacks
+        uint64_t before = wheel.getNow();
+        moveTo(wheel.nextWake());
+        if (wheel.getNow() == before)
+            return;
+    }
+}
+
+int TimerManager::getPendingCount() const
+{
+    return wheel.getPendingCount();
+}
+
+uint64_t TimerManager::currentTime() const
+{
+    if (isStopped())
+        return wheel.getNow();
+    return static_cast<uint64_t>(scaledElapsed() + offset);
+}
+
+bool TimerManager::isStopped() const
+{
+    return virtualClock || timeScale == TIMESCALE::INSTANT;
+}
+
+qint64 TimerManager::scaledElapsed() const
+{
+    return clock.elapsed() * TimeScale::getSpeed(timeScale);
+}
+
+void TimerManager::onTick()
+{
+    // One step at a time, so the window still paints and takes input between them
+    if (timeScale == TIMESCALE::INSTANT)
+        moveTo(wheel.nextWake());
+    else
+        moveTo(currentTime());
+}
+
+void TimerManager::rearm()
+{
+    if (ticking)
+        return;
+    if (virtualClock || wheel.getPendingCount() == 0)
     {
-        timer->stop();
-        timer->deleteLater();
+        driver->stop();
+        return;
     }
-    timers.clear();
+    if (timeScale == TIMESCALE::INSTANT)
+    {
+        driver->start(0);
+        return;
+    }
+
+    // The wait is in real time, rounded up so the driver never fires before the wheel's time is due
+    uint64_t now = currentTime();
+    uint64_t wake = wheel.nextWake();
+    uint64_t speed = static_cast<uint64_t>(TimeScale::getSpeed(timeScale));
+    driver->start(wake > now ? static_cast<int>(std::min<uint64_t>((wake - now + speed - 1) / speed, 1 << 30)) : 0);
+}
+
+void TimerManager::moveTo(uint64_t time)
+{
+    // A callback moving time itself must not rearm the driver halfway through
+    bool wasTicking = ticking;
+    ticking = true;
+    wheel.advanceTo(time);
+    ticking = wasTicking;
+
+    // Moving ahead of the real clock skips that time for good
+    if (!isStopped())
+        offset = std::max(offset, static_cast<qint64>(wheel.getNow()) - scaledElapsed());
+    rearm();
 }
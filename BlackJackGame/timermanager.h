@@ -3,10 +3,18 @@
 
 #include "qobject.h"
 #include "qtimer.h"
-#include <QList>
+#include "timerwheel.h"
+#include "timescale.h"
+#include <QElapsedTimer>
+
+using TimeScale::TIMESCALE;
 
 /**
- * @brief The TimerManager class hands calling and cancelling any single shot callback functions
+ * @brief The TimerManager class hands calling and cancelling any single shot callback functions.
+ * Every callback waits on one TimerWheel, woken by a single QTimer set for the next one due, so scheduling doesn't create a QTimer each time.
+ * With the virtual clock on, time only moves when advance or fastForward is called, which runs the callbacks straight away.
+ * The time scale runs the clock faster than real time, or at INSTANT jumps it to the next callback on every pass of the event loop.
+ * Delays are always counted in the same milliseconds, so callbacks run in the same order at every scale
  *
  * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
  * @date 4/18/2025
@@ -30,19 +38,147 @@ public:
      * @brief scheduleSingleShot Schedules a singleShot timer that will execute the callBack function
      * @param delay The delay until running callBack
      * @param callBack The function to run
+     * @param scope The scope the timer belongs to, from createScope, so it can be cancelled with the rest of the scope
+     * @return The handle to cancel the timer with
      */
-    void scheduleSingleShot(int delay, std::function<void()> callBack);
+    TimerWheel::Handle scheduleSingleShot(int delay, std::function<void()> callBack, int scope = TimerWheel::noScope);
+
+    /**
+     * @brief cancel Cancels one pending timer
+     * @param handle The handle scheduleSingleShot returned
+     * @return True if the timer hadn't run yet
+     */
+    bool cancel(TimerWheel::Handle handle);
+
+    /**
+     * @brief createScope Creates a scope to group timers under, like one animation's
+     * @return The scope's id
+     */
+    int createScope();
+
+    /**
+     * @brief cancelScope Cancels every pending timer of a scope
+     * @param scope The scope's id
+     */
+    void cancelScope(int scope);
 
     /**
      * @brief cancelAllTimers Cancels all pending timers
      */
     void cancelAllTimers();
 
+    /**
+     * @brief setVirtualClock Stops or restarts the real clock. Time picks up from wherever the virtual clock left it
+     * @param enabled True to only move time with advance and fastForward
+     */
+    void setVirtualClock(bool enabled);
+
+    /**
+     * @brief setTimeScale Changes how fast the clock runs. Anything already due runs first
+     * @param scale The time scale
+     */
+    void setTimeScale(TIMESCALE scale);
+
+    /**
+     * @brief getTimeScale Gets how fast the clock runs
+     * @return The time scale
+     */
+    TIMESCALE getTimeScale() const;
+
+    /**
+     * @brief scaleDuration Scales the length of something played in real time, like an animation, to the clock's speed
+     * @param milliseconds The length at 1x
+     * @return The length at the current time scale, 0 at INSTANT
+     */
+    int scaleDuration(int milliseconds) const;
+
+    /**
+     * @brief advance Moves time forward, running every callback due on the way in order
+     * @param milliseconds How far to move
+     */
+    void advance(int milliseconds);
+
+    /**
+     * @brief fastForward Moves time forward until no callbacks are left, including ones the callbacks schedule
+     */
+    void fastForward();
+
+    /**
+     * @brief getPendingCount Gets the number of callbacks waiting to run
+     * @return The number of callbacks
+     */
+    int getPendingCount() const;
+
 private:
     /**
-     * @brief timers A list to keep track of all timers
+     * @brief wheel Holds every pending callback, its tick is milliseconds
+     */
+    TimerWheel wheel;
+
+    /**
+     * @brief driver Fires when the wheel next has to move
+     */
+    QTimer *driver;
+
+    /**
+     * @brief clock The real time since the manager was made
+     */
+    QElapsedTimer clock;
+
+    /**
+     * @brief offset Added to the real time to get the wheel's time, which stands still while the clock is virtual
+     */
+    qint64 offset;
+
+    /**
+     * @brief virtualClock True while only advance and fastForward move time
+     */
+    bool virtualClock;
+
+    /**
+     * @brief timeScale How fast the clock runs
+     */
+    TIMESCALE timeScale;
+
+    /**
+     * @brief ticking True while callbacks are running, the driver is rearmed once they are done
+     */
+    bool ticking;
+
+    /**
+     * @brief currentTime Gets the time the wheel should be at
+     * @return The real time plus the offset, or the wheel's own time while the clock is virtual
+     */
+    uint64_t currentTime() const;
+
+    /**
+     * @brief isStopped Checks whether real time is ignored, with the virtual clock on or at INSTANT
+     * @return True if the clock only moves by hand or step by step
+     */
+    bool isStopped() const;
+
+    /**
+     * @brief scaledElapsed Gets the real time since the manager was made, sped up by the time scale
+     * @return The time in milliseconds
+     */
+    qint64 scaledElapsed() const;
+
+    /**
+     * @brief onTick Moves the wheel to the current time when the driver fires, or to the next callback at INSTANT
+     */
+    void onTick();
+
+    /**
+     * @brief rearm Sets the driver for the next time the wheel has to move, or stops it if nothing is pending or the clock is virtual.
+     * At INSTANT it is set to fire as soon as the event loop is free
+     */
+    void rearm();
+
+    /**
+     * @brief moveTo Moves the wheel to a time, running what is due, and keeps the real clock in step with it
+     * @param time The time
      */
-    QList<QTimer *> timers;
+    void moveTo(uint64_t time);
 };
 
 #endif // TIMERMANAGER_H
@@ -0,0 +1,253 @@
+/**
+ * @brief Implementation of The TimerWheel class. It schedules single shot callbacks on a hierarchical wheel of buckets driven by a millisecond clock
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/13/2025
+ */
+
+#include "timerwheel.h"
+#include <algorithm>
+
+TimerWheel::TimerWheel() : now(0), freeSlot(none), pendingCount(0), nextSequence(0), advancing(false), scopeHeads(1, none)
+{
+    heads.fill(none);
+    tails.fill(none);
+    occupied.fill(0);
+}
+
+TimerWheel::Handle TimerWheel::schedule(uint64_t delay, std::function<void()> callBack, int scope)
+{
+    int slot = freeSlot;
+    if (slot == none)
+    {
+        slot = static_cast<int>(pool.size());
+        pool.emplace_back();
+    }
+    else
+        freeSlot = pool[slot].next;
+
+    Slot &timer = pool[slot];
+    timer.callBack = std::move(callBack);
+    timer.due = now + std::max<uint64_t>(delay, 1);
+    timer.sequence = nextSequence++;
+    timer.pending = true;
+    timer.scope = scope > noScope && scope < static_cast<int>(scopeHeads.size()) ? scope : noScope;
+
+    if (timer.scope != noScope)
+    {
+        timer.scopePrevious = none;
+        timer.scopeNext = scopeHeads[timer.scope];
+        if (timer.scopeNext != none)
+            pool[timer.scopeNext].scopePrevious = slot;
+        scopeHeads[timer.scope] = slot;
+    }
+
+    place(slot);
+    pendingCount++;
+    return (static_cast<Handle>(timer.generation) << 32) | static_cast<Handle>(slot + 1);
+}
+
+bool TimerWheel::cancel(Handle handle)
+{
+    int slot = static_cast<int>(handle & 0xFFFFFFFF) - 1;
+    if (slot < 0 || slot >= static_cast<int>(pool.size()) || !pool[slot].pending || pool[slot].generation != static_cast<uint32_t>(handle >> 32))
+        return false;
+
+    release(slot);
+    return true;
+}
+
+int TimerWheel::createScope()
+{
+    scopeHeads.push_back(none);
+    return static_cast<int>(scopeHeads.size()) - 1;
+}
+
+void TimerWheel::cancelScope(int scope)
+{
+    if (scope <= noScope || scope >= static_cast<int>(scopeHeads.size()))
+        return;
+    while (scopeHeads[scope] != none)
+        release(scopeHeads[scope]);
+}
+
+void TimerWheel::cancelAll()
+{
+    for (int slot = 0; slot < static_cast<int>(pool.size()); slot++)
+        if (pool[slot].pending)
+            release(slot);
+}
+
+void TimerWheel::advanceTo(uint64_t tick)
+{
+    // A callback moving the clock would fire timers out from under the loop below
+    if (advancing)
+        return;
+
+    advancing = true;
+    while (now < tick)
+    {
+        if (pendingCount == 0)
+        {
+            now = tick;
+            break;
+        }
+
+        // Hop straight to the next tick with a timer, never past a multiple of 64 where the coarser levels have to move down
+        now = std::min(nextWake(), tick);
+        if ((now & (bucketCount - 1)) == 0)
+            cascade();
+        fireDue();
+    }
+    advancing = false;
+}
+
+uint64_t TimerWheel::nextWake() const
+{
+    if (pendingCount == 0)
+        return now;
+
+    int index = nextOccupied();
+    if (index < bucketCount)
+        return (now & ~static_cast<uint64_t>(bucketCount - 1)) + index;
+    return (now | (bucketCount - 1)) + 1;
+}
+
+uint64_t TimerWheel::getNow() const
+{
+    return now;
+}
+
+int TimerWheel::getPendingCount() const
+{
+    return pendingCount;
+}
+
+void TimerWheel::place(int slot)
+{
+    Slot &timer = pool[slot];
+    uint64_t delta = timer.due - now;
+
+    // The finest level whose span covers the delay. A timer past the last level waits in the furthest bucket it can reach and is placed again from there
+    int level = 0;
+    while (level < levelCount - 1 && delta >> (bucketBits * (level + 1)) != 0)
+        level++;
+    uint64_t position = delta >> (bucketBits * levelCount) != 0 ? now + (static_cast<uint64_t>(1) << (bucketBits * levelCount)) - 1 : timer.due;
+    int index = static_cast<int>((position >> (bucketBits * level)) & (bucketCount - 1));
+    int bucket = level * bucketCount + index;
+
+    // Timers moved down from a coarser level were scheduled before the ones already here
+    int after = tails[bucket];
+    while (after != none && pool[after].sequence > timer.sequence)
+        after = pool[after].previous;
+
+    timer.bucket = bucket;
+    timer.previous = after;
+    timer.next = after == none ? heads[bucket] : pool[after].next;
+    if (timer.next == none)
+        tails[bucket] = slot;
+    else
+        pool[timer.next].previous = slot;
+    if (after == none)
+        heads[bucket] = slot;
+    else
+        pool[after].next = slot;
+    occupied[level] |= static_cast<uint64_t>(1) << index;
+}
+
+void TimerWheel::unlink(int slot)
+{
+    Slot &timer = pool[slot];
+    if (timer.previous == none)
+        heads[timer.bucket] = timer.next;
+    else
+        pool[timer.previous].next = timer.next;
+    if (timer.next == none)
+        tails[timer.bucket] = timer.previous;
+    else
+        pool[timer.next].previous = timer.previous;
+
+    if (heads[timer.bucket] == none)
+        occupied[timer.bucket / bucketCount] &= ~(static_cast<uint64_t>(1) << (timer.bucket % bucketCount));
+}
+
+void TimerWheel::release(int slot)
+{
+    unlink(slot);
+
+    Slot &timer = pool[slot];
+    if (timer.scope != noScope)
+    {
+        if (timer.scopePrevious == none)
+            scopeHeads[timer.scope] = timer.scopeNext;
+        else
+            pool[timer.scopePrevious].scopeNext = timer.scopeNext;
+        if (timer.scopeNext != none)
+            pool[timer.scopeNext].scopePrevious = timer.scopePrevious;
+    }
+
+    timer.callBack = nullptr;
+    timer.pending = false;
+    timer.generation++;
+    timer.next = freeSlot;
+    freeSlot = slot;
+    pendingCount--;
+}
+
+void TimerWheel::cascade()
+{
+    for (int level = 1; level < levelCount; level++)
+    {
+        int index = static_cast<int>((now >> (bucketBits * level)) & (bucketCount - 1));
+        int bucket = level * bucketCount + index;
+        int slot = heads[bucket];
+        heads[bucket] = none;
+        tails[bucket] = none;
+        occupied[level] &= ~(static_cast<uint64_t>(1) << index);
+
+        while (slot != none)
+        {
+            int next = pool[slot].next;
+            place(slot);
+            slot = next;
+        }
+
+        // The next level only comes due when this one wraps around
+        if (index != 0)
+            break;
+    }
+}
+
+void TimerWheel::fireDue()
+{
+    int bucket = static_cast<int>(now & (bucketCount - 1));
+    while (heads[bucket] != none)
+    {
+        int slot = heads[bucket];
+        std::function<void()> callBack = std::move(pool[slot].callBack);
+        release(slot);
+        callBack();
+    }
+}
+
+int TimerWheel::nextOccupied() const
+{
+    int index = static_cast<int>(now & (bucketCount - 1));
+    if (index == bucketCount - 1)
+        return bucketCount;
+    uint64_t later = occupied[0] & (~static_cast<uint64_t>(0) << (index + 1));
+    if (later == 0)
+        return bucketCount;
+
+#if defined(__GNUC__)
+    return __builtin_ctzll(later);
+#else
+    int first = 0;
+    while ((later & 1) == 0)
+    {
+        later >>= 1;
+        first++;
+    }
+    return first;
+#endif
+}
@@ -0,0 +1,263 @@
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief The TimerWheel class schedules single shot callbacks on a millisecond clock it is told about, so it can be driven by one real timer
+ * or fast forwarded by hand. It is a hierarchical wheel of four levels of 64 buckets: a timer due within 64 ticks sits in the bucket of its tick,
+ * later ones sit in a coarser level and move down as the clock nears them, so scheduling and cancelling are O(1) however many timers are pending.
+ * Callbacks live in a pool of slots reused as timers fire. Timers due on the same tick fire in the order they were scheduled.
+ * A timer can belong to a scope, and cancelling the scope cancels every timer still pending in it
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/13/2025
+ */
+class TimerWheel
+{
+public:
+    /**
+     * @brief Handle Identifies a scheduled timer, stale once it fires or is cancelled so it can never cancel a later timer in the same slot. 0 is never a timer
+     */
+    using Handle = uint64_t;
+
+    /**
+     * @brief noScope The scope of timers that only end by firing, cancel or cancelAll
+     */
+    static constexpr int noScope = 0;
+
+    /**
+     * @brief TimerWheel Constructor that starts the clock at 0 with nothing pending
+     */
+    TimerWheel();
+
+    /**
+     * @brief schedule Schedules a callback
+     * @param delay The ticks until it fires, at least one so a callback can't schedule itself on the tick being fired
+     * @param callBack The function to run
+     * @param scope The scope the timer belongs to, from createScope, or noScope
+     * @return The timer's handle
+     */
+    Handle schedule(uint64_t delay, std::function<void()> callBack, int scope = noScope);
+
+    /**
+     * @brief cancel Cancels a timer if it is still pending
+     * @param handle The timer's handle
+     * @return True if the timer was pending
+     */
+    bool cancel(Handle handle);
+
+    /**
+     * @brief createScope Creates a scope to group timers under
+     * @return The scope's id
+     */
+    int createScope();
+
+    /**
+     * @brief cancelScope Cancels every pending timer of a scope. The scope can still be scheduled in afterwards
+     * @param scope The scope's id
+     */
+    void cancelScope(int scope);
+
+    /**
+     * @brief cancelAll Cancels every pending timer
+     */
+    void cancelAll();
+
+    /**
+     * @brief advanceTo Moves the clock forward, firing every timer due on the way in order. Calls from inside a callback are ignored
+     * @param tick The tick to move to, earlier ticks leave the clock where it is
+     */
+    void advanceTo(uint64_t tick);
+
+    /**
+     * @brief nextWake Gets the tick the clock next has to be advanced to. It is exact for timers due within the current 64 ticks,
+     * and otherwise the start of the next 64, where later timers are moved closer
+     * @return The tick, or the current tick if nothing is pending
+     */
+    uint64_t nextWake() const;
+
+    /**
+     * @brief getNow Gets the current tick
+     * @return The tick
+     */
+    uint64_t getNow() const;
+
+    /**
+     * @brief getPendingCount Gets the number of timers waiting to fire
+     * @return The number of timers
+     */
+    int getPendingCount() const;
+
+private:
+    /**
+     * @brief bucketBits The bits of the tick each level covers
+     */
+    static constexpr int bucketBits = 6;
+
+    /**
+     * @brief bucketCount The buckets in each level
+     */
+    static constexpr int bucketCount = 1 << bucketBits;
+
+    /**
+     * @brief levelCount The levels of the wheel, covering 2^24 ticks, over four hours of milliseconds. Later timers wait in the last bucket they reach
+     */
+    static constexpr int levelCount = 4;
+
+    /**
+     * @brief none The index that ends a list
+     */
+    static constexpr int none = -1;
+
+    /**
+     * @brief The Slot struct is a timer's place in the pool, linked into its bucket and its scope
+     */
+    struct Slot
+    {
+        /**
+         * @brief callBack The function to run, empty while the slot is free
+         */
+        std::function<void()> callBack;
+
+        /**
+         * @brief due The tick the timer fires on
+         */
+        uint64_t due = 0;
+
+        /**
+         * @brief sequence Orders timers by when they were scheduled, so timers due together fire in that order even after moving between levels
+         */
+        uint64_t sequence = 0;
+
+        /**
+         * @brief generation Counts the timers the slot has held, to tell stale handles apart
+         */
+        uint32_t generation = 0;
+
+        /**
+         * @brief bucket The bucket the timer is in, level * bucketCount + index
+         */
+        int bucket = none;
+
+        /**
+         * @brief previous The timer before this one in its bucket
+         */
+        int previous = none;
+
+        /**
+         * @brief next The timer after this one in its bucket, or the next free slot while free
+         */
+        int next = none;
+
+        /**
+         * @brief scope The scope the timer belongs to
+         */
+        int scope = noScope;
+
+        /**
+         * @brief scopePrevious The timer before this one in its scope
+         */
+        int scopePrevious = none;
+
+        /**
+         * @brief scopeNext The timer after this one in its scope
+         */
+        int scopeNext = none;
+
+        /**
+         * @brief pending True while the timer is waiting to fire
+         */
+        bool pending = false;
+    };
+
+    /**
+     * @brief now The current tick
+     */
+    uint64_t now;
+
+    /**
+     * @brief pool Every timer slot, free ones chained through next
+     */
+    std::vector<Slot> pool;
+
+    /**
+     * @brief freeSlot The first free slot
+     */
+    int freeSlot;
+
+    /**
+     * @brief pendingCount The number of timers waiting to fire
+     */
+    int pendingCount;
+
+    /**
+     * @brief nextSequence The sequence of the next timer scheduled
+     */
+    uint64_t nextSequence;
+
+    /**
+     * @brief advancing True while callbacks are being fired
+     */
+    bool advancing;
+
+    /**
+     * @brief heads The first timer of each bucket
+     */
+    std::array<int, levelCount * bucketCount> heads;
+
+    /**
+     * @brief tails The last timer of each bucket
+     */
+    std::array<int, levelCount * bucketCount> tails;
+
+    /**
+     * @brief occupied A bit for every bucket of a level that holds a timer
+     */
+    std::array<uint64_t, levelCount> occupied;
+
+    /**
+     * @brief scopeHeads The first timer of each scope, scope 0 is never linked
+     */
+    std::vector<int> scopeHeads;
+
+    /**
+     * @brief place Links a timer into the bucket for its due tick, relative to now, after the timers in it scheduled before it.
+     * A new timer is always the latest so it goes straight to the end
+     * @param slot The timer's slot
+     */
+    void place(int slot);
+
+    /**
+     * @brief unlink Takes a timer out of its bucket
+     * @param slot The timer's slot
+     */
+    void unlink(int slot);
+
+    /**
+     * @brief release Cancels a pending timer and returns its slot to the pool
+     * @param slot The timer's slot
+     */
+    void release(int slot);
+
+    /**
+     * @brief cascade Moves the timers of the coarser levels that have come due within the next 64 ticks down, called as now reaches a multiple of 64
+     */
+    void cascade();
+
+    /**
+     * @brief fireDue Fires every timer due now, one at a time so a callback may schedule or cancel anything
+     */
+    void fireDue();
+
+    /**
+     * @brief nextOccupied Finds the first bucket of level 0 past now's that holds a timer before the next multiple of 64
+     * @return The bucket's index, or bucketCount if there is none
+     */
+    int nextOccupied() const;
+};
+
+#endif // TIMERWHEEL_H
@@ -0,0 +1,84 @@
+#ifndef TIMESCALE_H
+#define TIMESCALE_H
+
+#include <string>
+#include <ostream>
+
+namespace TimeScale
+{
+
+    /**
+     * @brief The TIMESCALE enum How fast the table's clock runs. Every wait is still counted in the same milliseconds, so a faster clock
+     * plays the same events in the same order, only sooner
+     *
+     * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+     * @date 5/14/2025
+     */
+    enum class TIMESCALE
+    {
+        NORMAL,
+        FAST,
+        INSTANT
+    };
+
+    /**
+     * @brief toString Converts a TIMESCALE to a string
+     * @param scale The TIMESCALE to convert
+     * @return A string of the TIMESCALE provided
+     */
+    inline std::string toString(TIMESCALE scale)
+    {
+        switch (scale)
+        {
+        case TIMESCALE::NORMAL:
+            return "1x";
+        case TIMESCALE::FAST:
+            return "10x";
+        case TIMESCALE::INSTANT:
+            return "Instant";
+        }
+
+        return "Unknown time scale";
+    }
+
+    /**
+     * @brief operator << Prints out the string of the TIMESCALE when used with the ostream operator
+     * @param os The stream to add the string to
+     * @param scale The TIMESCALE to convert
+     * @return The ostream with the TIMESCALE as a string
+     */
+    inline std::ostream &operator<<(std::ostream &os, TIMESCALE scale)
+    {
+        return os << toString(scale);
+    }
+
+    /**
+     * @brief getSpeed Gets how many times faster than real time a TIMESCALE runs
+     * @param scale The TIMESCALE
+     * @return The speed, or 0 for INSTANT, which never waits on real time
+     */
+    inline int getSpeed(TIMESCALE scale)
+    {
+        switch (scale)
+        {
+        case TIMESCALE::NORMAL:
+            return 1;
+        case TIMESCALE::FAST:
+            return 10;
+        case TIMESCALE::INSTANT:
+            return 0;
+        }
+
+        return 1;
+    }
+
+    /**
+     * @brief allTimeScales An array of all the TIMESCALE values
+     */
+    inline constexpr TIMESCALE allTimeScales[] = {
+        TIMESCALE::NORMAL,
+        TIMESCALE::FAST,
+        TIMESCALE::INSTANT};
+
+}
+#endif // TIMESCALE_H
@@ -151,6 +151,9 @@ void TutorialPopup::onContinuePressed()
         case MOVE::SPLIT:
             button = ui->splitButton;
             break;
+        // The tutorial table doesn't offer surrender
+        case MOVE::SURRENDER:
+            break;
         }
         if (button)
         {
@@ -0,0 +1,116 @@
+/**
+ * @brief Implementation of The WorkStealingPool class. It runs tasks on a fixed set of worker threads that steal from each other's queues when idle
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/11/2025
+ */
+
+#include "workstealingpool.h"
+#include <algorithm>
+
+thread_local const WorkStealingPool *WorkStealingPool::currentPool = nullptr;
+thread_local unsigned int WorkStealingPool::currentWorker = 0;
+
+WorkStealingPool::WorkStealingPool(unsigned int workerCount, std::function<void(int task, unsigned int worker)> run) : run(std::move(run))
+{
+    if (workerCount == 0)
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned int i = 0; i < workerCount; i++)
+        queues.push_back(std::make_unique<Queue>());
+
+    workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; i++)
+        workers.emplace_back([this, i]()
+                             { work(i); });
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    stop();
+}
+
+void WorkStealingPool::stop()
+{
+    {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        stopping = true;
+    }
+    wake.notify_all();
+
+    for (std::thread &worker : workers)
+        if (worker.joinable())
+            worker.join();
+}
+
+void WorkStealingPool::schedule(int task)
+{
+    // A task scheduled by a running task stays on its worker, where the data it just touched is still in cache
+    unsigned int index = currentPool == this ? currentWorker : nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    {
+        std::lock_guard<std::mutex> guard(queues[index]->lock);
+        queues[index]->tasks.push_back(task);
+    }
+    pending.fetch_add(1);
+
+    // A worker counts itself as sleeping before it checks pending, so one of the two always sees the other
+    if (sleeping.load() > 0)
+    {
+        {
+            std::lock_guard<std::mutex> guard(sleepLock);
+        }
+        wake.notify_one();
+    }
+}
+
+unsigned int WorkStealingPool::getWorkerCount() const
+{
+    return static_cast<unsigned int>(workers.size());
+}
+
+long long WorkStealingPool::getSteals() const
+{
+    return steals.load(std::memory_order_relaxed);
+}
+
+void WorkStealingPool::work(unsigned int index)
+{
+    currentPool = this;
+    currentWorker = index;
+
+    while (!stopping.load(std::memory_order_relaxed))
+    {
+        int task;
+        if (take(index, task))
+        {
+            pending.fetch_sub(1);
+            run(task, index);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> guard(sleepLock);
+        sleeping.fetch_add(1);
+        wake.wait(guard, [this]()
+                  { return stopping.load() || pending.load() > 0; });
+        sleeping.fetch_sub(1);
+    }
+}
+
+bool WorkStealingPool::take(unsigned int index, int &task)
+{
+    std::size_t count = queues.size();
+    for (std::size_t offset = 0; offset < count; offset++)
+    {
+        Queue &queue = *queues[(index + offset) % count];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        if (queue.tasks.empty())
+            continue;
+
+        task = queue.tasks.front();
+        queue.tasks.pop_front();
+        if (offset > 0)
+            steals.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
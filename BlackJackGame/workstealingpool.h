@@ -0,0 +1,155 @@
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief The WorkStealingPool class runs tasks, named by a number, on a fixed set of worker threads.
+ * Each worker has its own queue. A task scheduled from a worker goes on that worker's queue and any other goes round robin,
+ * and a worker with nothing queued steals from the others before it sleeps, so no worker idles while another has a backlog.
+ * Every queue is taken from oldest first, by its owner and by thieves, which keeps the wait of a task bounded by the backlog ahead of it
+ *
+ * @authors Noah Zaffos, Caleb Standfield, Ethan Perkins, Jas Sandhu, Nash Hawkins
+ * @date 5/11/2025
+ */
+class WorkStealingPool
+{
+public:
+    /**
+     * @brief WorkStealingPool Constructor that starts the workers
+     * @param workerCount The number of worker threads, 0 uses every hardware thread
+     * @param run Runs a task, called on a worker thread with the task and the worker's index
+     */
+    WorkStealingPool(unsigned int workerCount, std::function<void(int task, unsigned int worker)> run);
+
+    /**
+     * @brief ~WorkStealingPool Destructor that stops the workers, dropping any tasks they haven't started
+     */
+    ~WorkStealingPool();
+
+    /**
+     * @brief stop Stops the workers and waits for the tasks they are running to finish. Tasks scheduled after are never run
+     */
+    void stop();
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+    /**
+     * @brief schedule Queues a task to run once. Safe to call from any thread, including from a running task
+     * @param task The task
+     */
+    void schedule(int task);
+
+    /**
+     * @brief getWorkerCount Gets the number of worker threads
+     * @return The number of workers
+     */
+    unsigned int getWorkerCount() const;
+
+    /**
+     * @brief getSteals Gets the number of tasks a worker took from another worker's queue
+     * @return The number of steals
+     */
+    long long getSteals() const;
+
+private:
+    /**
+     * @brief The Queue struct is one worker's tasks, padded to its own cache lines so the workers' locks don't share one
+     */
+    struct alignas(64) Queue
+    {
+        /**
+         * @brief lock Held to add or take a task
+         */
+        std::mutex lock;
+
+        /**
+         * @brief tasks The tasks waiting, oldest at the front
+         */
+        std::deque<int> tasks;
+    };
+
+    /**
+     * @brief run Runs a task
+     */
+    std::function<void(int task, unsigned int worker)> run;
+
+    /**
+     * @brief queues Every worker's queue
+     */
+    std::vector<std::unique_ptr<Queue>> queues;
+
+    /**
+     * @brief workers The worker threads
+     */
+    std::vector<std::thread> workers;
+
+    /**
+     * @brief sleepLock Held by a worker going to sleep and by a scheduler waking one
+     */
+    std::mutex sleepLock;
+
+    /**
+     * @brief wake Signalled when a task is scheduled and a worker is asleep, or the pool is stopping
+     */
+    std::condition_variable wake;
+
+    /**
+     * @brief pending The number of tasks queued and not yet taken
+     */
+    std::atomic<long long> pending{0};
+
+    /**
+     * @brief sleeping The number of workers asleep or about to sleep
+     */
+    std::atomic<int> sleeping{0};
+
+    /**
+     * @brief stopping True once stop has been called
+     */
+    std::atomic<bool> stopping{false};
+
+    /**
+     * @brief nextQueue The queue the next task scheduled from outside the pool goes on
+     */
+    std::atomic<unsigned int> nextQueue{0};
+
+    /**
+     * @brief steals The number of tasks taken from another worker's queue
+     */
+    std::atomic<long long> steals{0};
+
+    /**
+     * @brief work The loop of one worker thread
+     * @param index The worker's index
+     */
+    void work(unsigned int index);
+
+    /**
+     * @brief take Takes the oldest task from the worker's own queue, or steals the oldest from another
+     * @param index The worker's index
+     * @param task Set to the task taken
+     * @return False if every queue was empty
+     */
+    bool take(unsigned int index, int &task);
+
+    /**
+     * @brief currentPool The pool the calling thread works for, null off the pool's threads
+     */
+    static thread_local const WorkStealingPool *currentPool;
+
+    /**
+     * @brief currentWorker The index of the calling thread in currentPool
+     */
+    static thread_local unsigned int currentWorker;
+};
+
+#endif // WORKSTEALINGPOOL_H